@@ -0,0 +1,83 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic< size_t > sNumAllocations{ 0 };
+}
+
+namespace NBenchUtils
+{
+    size_t numAllocations()
+    {
+        return sNumAllocations.load( std::memory_order_relaxed );
+    }
+}
+
+// the replaceable global allocation functions, the nothrow forms call these
+void * operator new( std::size_t size )
+{
+    sNumAllocations.fetch_add( 1, std::memory_order_relaxed );
+    if ( !size )
+        size = 1;
+    while ( true )
+    {
+        if ( auto retVal = std::malloc( size ) )
+            return retVal;
+        auto handler = std::get_new_handler();
+        if ( !handler )
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+void * operator new[]( std::size_t size )
+{
+    return ::operator new( size );
+}
+
+void operator delete( void * ptr ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete[]( void * ptr ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete( void * ptr, std::size_t ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete[]( void * ptr, std::size_t ) noexcept
+{
+    std::free( ptr );
+}
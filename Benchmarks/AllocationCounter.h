@@ -0,0 +1,59 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef __BENCHMARKS_ALLOCATIONCOUNTER_H
+#define __BENCHMARKS_ALLOCATIONCOUNTER_H
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+
+namespace NBenchUtils
+{
+    // calls to the global operator new so far, from every thread
+    // Qt containers allocate with malloc, their allocations are not counted
+    size_t numAllocations();
+
+    // Reports the allocations per iteration of the benchmark loop as the "allocs" counter
+    // construct it right before the loop, so the setup is not counted
+    class CAllocationCounter
+    {
+    public:
+        explicit CAllocationCounter( benchmark::State & state ) :
+            fState( state ),
+            fStart( numAllocations() )
+        {
+        }
+        ~CAllocationCounter()
+        {
+            auto numAllocs = numAllocations() - fStart;
+            fState.counters[ "allocs" ] = benchmark::Counter( static_cast< double >( numAllocs ), benchmark::Counter::kAvgIterations );
+        }
+
+        CAllocationCounter( const CAllocationCounter & ) = delete;
+        CAllocationCounter & operator=( const CAllocationCounter & ) = delete;
+    private:
+        benchmark::State & fState;
+        size_t fStart;
+    };
+}
+#endif
@@ -0,0 +1,146 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../FileUtils.h"
+#include "../LineReader.h"
+#include "AllocationCounter.h"
+#include "Corpus.h"
+
+#include <QString>
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::vector< std::string > fileListPaths( size_t numFiles )
+    {
+        std::vector< std::string > retVal;
+        NFileUtils::CLineReader reader( NBenchUtils::makeFileListText( numFiles ) );
+        std::string_view line;
+        while ( reader.nextLine( line ) )
+        {
+            if ( !line.empty() && ( line[ 0 ] == '.' ) )
+                retVal.emplace_back( line );
+        }
+        return retVal;
+    }
+
+    void BM_normalizePath( benchmark::State & state )
+    {
+        auto paths = fileListPaths( static_cast< size_t >( state.range( 0 ) ) );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            for ( auto && ii : paths )
+            {
+                auto path = NFileUtils::normalizePath( ii, "/proj/chip" );
+                benchmark::DoNotOptimize( path );
+            }
+        }
+        state.SetItemsProcessed( static_cast< int64_t >( state.iterations() * paths.size() ) );
+    }
+    BENCHMARK( BM_normalizePath )->Arg( 1024 );
+
+    void BM_getRelativePath( benchmark::State & state )
+    {
+        std::vector< std::string > paths;
+        for ( auto && ii : fileListPaths( static_cast< size_t >( state.range( 0 ) ) ) )
+            paths.push_back( NFileUtils::normalizePath( ii, "/proj/chip" ) );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            for ( auto && ii : paths )
+            {
+                auto path = NFileUtils::getRelativePath( ii, "/proj/chip/rtl/block_7" );
+                benchmark::DoNotOptimize( path );
+            }
+        }
+        state.SetItemsProcessed( static_cast< int64_t >( state.iterations() * paths.size() ) );
+    }
+    BENCHMARK( BM_getRelativePath )->Arg( 1024 );
+
+    void BM_expandEnvVars( benchmark::State & state )
+    {
+        std::vector< QString > paths;
+        for ( auto && ii : NBenchUtils::makeEnvFileList( static_cast< size_t >( state.range( 0 ) ) ) )
+            paths.push_back( QString::fromStdString( ii ) );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            for ( auto && ii : paths )
+            {
+                auto path = NFileUtils::expandEnvVars( ii );
+                benchmark::DoNotOptimize( path );
+            }
+        }
+        state.SetItemsProcessed( static_cast< int64_t >( state.iterations() * paths.size() ) );
+    }
+    BENCHMARK( BM_expandEnvVars )->Arg( 1024 );
+
+    void BM_fileListTokens( benchmark::State & state )
+    {
+        auto text = NBenchUtils::makeFileListText( static_cast< size_t >( state.range( 0 ) ) );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            NFileUtils::CLineReader reader( text );
+            std::string_view token;
+            size_t count = 0;
+            while ( reader.nextToken( token ) )
+                count++;
+            benchmark::DoNotOptimize( count );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * text.size() ) );
+    }
+    BENCHMARK( BM_fileListTokens )->Arg( 16384 );
+
+    // depth 3 with 8 sub directories each, 585 directories
+    void BM_getSubDirs( benchmark::State & state )
+    {
+        NBenchUtils::CDirTree tree( 3, 8, static_cast< size_t >( state.range( 0 ) ) );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto dirs = NFileUtils::getSubDirs( tree.root(), true, true );
+            benchmark::DoNotOptimize( dirs );
+        }
+        state.SetItemsProcessed( static_cast< int64_t >( state.iterations() * tree.dirs().size() ) );
+    }
+    BENCHMARK( BM_getSubDirs )->Arg( 0 )->Arg( 4 );
+
+    void BM_isRegularFile( benchmark::State & state )
+    {
+        NBenchUtils::CDirTree tree( 2, 4, 8 );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            size_t count = 0;
+            for ( auto && ii : tree.files() )
+                count += NFileUtils::isRegularFile( ii ) ? 1 : 0;
+            benchmark::DoNotOptimize( count );
+        }
+        state.SetItemsProcessed( static_cast< int64_t >( state.iterations() * tree.files().size() ) );
+    }
+    BENCHMARK( BM_isRegularFile );
+}
@@ -0,0 +1,916 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../StringUtils.h"
+#include "../StringTokenizer.h"
+#include "../RegExCache.h"
+#include "../ByteRegEx.h"
+#include "../RegExSet.h"
+#include "../WildcardPatternSet.h"
+#include "../BitVector.h"
+#include "../StringComparisonClasses.h"
+#include "../MultiStringSearch.h"
+#include "../MultiStringReplace.h"
+#include "../ReportWriter.h"
+#include "../HierNameStore.h"
+#include "../EnvironmentSnapshot.h"
+#include "../TransferCodecs.h"
+#include "../LineReader.h"
+#include "../CSVReader.h"
+#include "../HtmlEntities.h"
+#include "../DateTimeParser.h"
+#include "../IntFormat.h"
+#include "../IdentifierLexer.h"
+#include "../NoCaseStringSet.h"
+#include "../QtUtils.h"
+#include "../FromString.h"
+#include "AllocationCounter.h"
+#include "Corpus.h"
+
+#include <benchmark/benchmark.h>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+    void BM_splitString( benchmark::State & state )
+    {
+        auto line = NBenchUtils::makeDelimitedLine( static_cast< size_t >( state.range( 0 ) ), ',' );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto tokens = NStringUtils::splitString( line, ',' );
+            benchmark::DoNotOptimize( tokens );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * line.size() ) );
+    }
+    BENCHMARK( BM_splitString )->Arg( 16 )->Arg( 1024 )->Arg( 65536 );
+
+    void BM_StringTokenizer( benchmark::State & state )
+    {
+        auto line = NBenchUtils::makeDelimitedLine( static_cast< size_t >( state.range( 0 ) ), ',' );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            NStringUtils::CStringTokenizer tokenizer( line, ',' );
+            size_t count = 0;
+            for ( auto && ii : tokenizer )
+                count += ii.length();
+            benchmark::DoNotOptimize( count );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * line.size() ) );
+    }
+    BENCHMARK( BM_StringTokenizer )->Arg( 16 )->Arg( 1024 )->Arg( 65536 );
+
+    void BM_splitStringQuoted( benchmark::State & state )
+    {
+        auto line = NBenchUtils::makeDelimitedLine( static_cast< size_t >( state.range( 0 ) ), ' ' ) + " \"quoted value here\" tail";
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto tokens = NStringUtils::splitString( line, " \t", true, true, true );
+            benchmark::DoNotOptimize( tokens );
+        }
+    }
+    BENCHMARK( BM_splitStringQuoted )->Arg( 1024 );
+
+    void BM_StringTokenizerQuoted( benchmark::State & state )
+    {
+        auto line = NBenchUtils::makeDelimitedLine( static_cast< size_t >( state.range( 0 ) ), ' ' ) + " \"quoted value here\" tail";
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            NStringUtils::CStringTokenizer tokenizer( line, " \t", true, true, true );
+            auto tokens = tokenizer.all();
+            benchmark::DoNotOptimize( tokens );
+        }
+    }
+    BENCHMARK( BM_StringTokenizerQuoted )->Arg( 1024 );
+
+    void BM_matchRegExprLoop( benchmark::State & state )
+    {
+        auto patterns = NBenchUtils::makePatterns( static_cast< size_t >( state.range( 0 ) ) );
+        auto names = NBenchUtils::makeNames( 1024 );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            size_t count = 0;
+            for ( auto && name : names )
+            {
+                for ( auto && pattern : patterns )
+                {
+                    if ( NStringUtils::matchRegExpr( name.c_str(), pattern.c_str() ) )
+                        count++;
+                }
+            }
+            benchmark::DoNotOptimize( count );
+        }
+        state.SetItemsProcessed( static_cast< int64_t >( state.iterations() * names.size() ) );
+    }
+    BENCHMARK( BM_matchRegExprLoop )->Arg( 16 )->Arg( 1024 )->Arg( 16384 );
+
+    void BM_WildcardPatternSet( benchmark::State & state )
+    {
+        NStringUtils::CWildcardPatternSet patternSet;
+        for ( auto && ii : NBenchUtils::makePatterns( static_cast< size_t >( state.range( 0 ) ) ) )
+            patternSet.addPattern( ii );
+        auto names = NBenchUtils::makeNames( 1024 );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            size_t count = 0;
+            for ( auto && name : names )
+                count += patternSet.match( name ).size();
+            benchmark::DoNotOptimize( count );
+        }
+        state.SetItemsProcessed( static_cast< int64_t >( state.iterations() * names.size() ) );
+    }
+    BENCHMARK( BM_WildcardPatternSet )->Arg( 16 )->Arg( 1024 )->Arg( 16384 );
+
+    // range( 0 ) == 0 is the QString round trip through QRegularExpression, 1 the byte matcher splitStringRegEx now uses
+    void BM_splitStringRegEx( benchmark::State & state )
+    {
+        auto line = NBenchUtils::makeDelimitedLine( 1024, ',' );
+        std::string pattern( "\\s*,\\s*" );
+        auto regExp = NStringUtils::CRegExCache::instance()->get( pattern );
+        auto byteRegExp = NStringUtils::CRegExCache::instance()->getByteRegEx( pattern );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            std::list< std::string > fields;
+            if ( state.range( 0 ) == 0 )
+            {
+                for ( auto && ii : QString::fromStdString( line ).split( regExp ) )
+                    fields.push_back( ii.toStdString() );
+            }
+            else
+                fields = byteRegExp->split( line );
+            benchmark::DoNotOptimize( fields );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * line.size() ) );
+    }
+    BENCHMARK( BM_splitStringRegEx )->Arg( 0 )->Arg( 1 );
+
+    void BM_isExactMatchRegEx( benchmark::State & state )
+    {
+        auto names = NBenchUtils::makeNames( 1024 );
+        std::string pattern( "top\\.core\\d+\\.u1\\d*\\.reg[0-2]" );
+        auto regExp = NStringUtils::CRegExCache::instance()->get( "\\A(" + pattern + ")\\z" );
+        auto byteRegExp = NStringUtils::CRegExCache::instance()->getByteRegEx( pattern );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            size_t count = 0;
+            for ( auto && name : names )
+            {
+                if ( ( state.range( 0 ) == 0 ) ? regExp.match( QString::fromStdString( name ) ).hasMatch() : byteRegExp->exactMatch( name ) )
+                    count++;
+            }
+            benchmark::DoNotOptimize( count );
+        }
+        state.SetItemsProcessed( static_cast< int64_t >( state.iterations() * names.size() ) );
+    }
+    BENCHMARK( BM_isExactMatchRegEx )->Arg( 0 )->Arg( 1 );
+
+    // 0 - the addToRegEx alternation, 1 - the prefix factored CRegExSet::pattern(), 2 - CRegExSet::exactMatch
+    void BM_RegExSetMatch( benchmark::State & state )
+    {
+        auto names = NBenchUtils::makeNames( 1024 );
+        NStringUtils::CRegExSet regExSet;
+        std::string alternation;
+        for ( size_t ii = 0; ii < names.size(); ii += 2 )
+        {
+            regExSet.addLiteral( names[ ii ] );
+            alternation = NStringUtils::addToRegEx( alternation, NStringUtils::encodeRegEx( names[ ii ] ) );
+        }
+        auto pattern = ( state.range( 0 ) == 0 ) ? alternation : regExSet.pattern();
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            size_t count = 0;
+            for ( auto && name : names )
+            {
+                if ( ( state.range( 0 ) == 2 ) ? regExSet.exactMatch( name ) : NStringUtils::isExactMatchRegEx( name, pattern, false ) )
+                    count++;
+            }
+            benchmark::DoNotOptimize( count );
+        }
+        state.SetItemsProcessed( static_cast< int64_t >( state.iterations() * names.size() ) );
+    }
+    BENCHMARK( BM_RegExSetMatch )->Arg( 0 )->Arg( 1 )->Arg( 2 );
+
+    void BM_hexToBin( benchmark::State & state )
+    {
+        auto numBits = static_cast< size_t >( state.range( 0 ) );
+        auto hex = NBenchUtils::makeHexString( numBits );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto bin = NStringUtils::hexToBin( hex, numBits );
+            benchmark::DoNotOptimize( bin );
+        }
+    }
+    BENCHMARK( BM_hexToBin )->Arg( 512 )->Arg( 4096 );
+
+    void BM_BitVectorHexToBin( benchmark::State & state )
+    {
+        auto numBits = static_cast< size_t >( state.range( 0 ) );
+        auto hex = NBenchUtils::makeHexString( numBits );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto bin = NStringUtils::toBinString( NStringUtils::hexToBitVector( hex, numBits ) );
+            benchmark::DoNotOptimize( bin );
+        }
+    }
+    BENCHMARK( BM_BitVectorHexToBin )->Arg( 512 )->Arg( 4096 );
+
+    void BM_BitVectorDecimal( benchmark::State & state )
+    {
+        auto value = NStringUtils::hexToBitVector( NBenchUtils::makeHexString( static_cast< size_t >( state.range( 0 ) ) ) );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto dec = NStringUtils::binToDec( NStringUtils::decToBitVector( NStringUtils::binToDec( value, false ), value.width() ), false );
+            benchmark::DoNotOptimize( dec );
+        }
+    }
+    BENCHMARK( BM_BitVectorDecimal )->Arg( 512 )->Arg( 4096 );
+
+    std::vector< std::string > makeLibPaths( size_t numPaths )
+    {
+        std::vector< std::string > retVal;
+        for ( size_t ii = 0; ii < numPaths; ++ii )
+            retVal.push_back( "/usr/lib/x86_64-linux-gnu/Lib_Component_" + std::to_string( ii ) + ( ( ii % 2 ) ? ".SO" : ".so" ) );
+        return retVal;
+    }
+
+    void BM_toLowerStdHash( benchmark::State & state )
+    {
+        auto paths = makeLibPaths( 1024 );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            size_t value = 0;
+            for ( auto && ii : paths )
+                value ^= std::hash< std::string >()( NStringUtils::tolower( ii ) );
+            benchmark::DoNotOptimize( value );
+        }
+        state.SetItemsProcessed( static_cast< int64_t >( state.iterations() * paths.size() ) );
+    }
+    BENCHMARK( BM_toLowerStdHash );
+
+    void BM_noCaseStringHash( benchmark::State & state )
+    {
+        auto paths = makeLibPaths( 1024 );
+        NStringUtils::noCaseStringHash hash;
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            size_t value = 0;
+            for ( auto && ii : paths )
+                value ^= hash( ii );
+            benchmark::DoNotOptimize( value );
+        }
+        state.SetItemsProcessed( static_cast< int64_t >( state.iterations() * paths.size() ) );
+    }
+    BENCHMARK( BM_noCaseStringHash );
+
+    // 0 - std::set with noCaseStringCmp, 1 - std::unordered_set with noCaseStringHash, 2 - CNoCaseStringSet
+    // the lookups differ in case from the stored paths, every other one is missing
+    void BM_noCaseStringSet( benchmark::State & state )
+    {
+        auto paths = makeLibPaths( 1024 );
+        std::vector< std::string > lookups;
+        for ( size_t ii = 0; ii < paths.size(); ++ii )
+            lookups.push_back( NStringUtils::toupper( paths[ ii ] ) + ( ( ii % 2 ) ? ".1" : "" ) );
+        std::set< std::string, NStringUtils::noCaseStringCmp > sorted( paths.begin(), paths.end() );
+        std::unordered_set< std::string, NStringUtils::noCaseStringHash, NStringUtils::noCaseStringEq > hashed( paths.begin(), paths.end() );
+        NStringUtils::CNoCaseStringSet flat( paths.begin(), paths.end() );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            size_t found = 0;
+            for ( auto && ii : lookups )
+            {
+                if ( state.range( 0 ) == 0 )
+                    found += sorted.count( ii );
+                else if ( state.range( 0 ) == 1 )
+                    found += hashed.count( ii );
+                else
+                    found += flat.count( ii );
+            }
+            benchmark::DoNotOptimize( found );
+        }
+        state.SetItemsProcessed( static_cast< int64_t >( state.iterations() * lookups.size() ) );
+    }
+    BENCHMARK( BM_noCaseStringSet )->Arg( 0 )->Arg( 1 )->Arg( 2 );
+
+    void BM_noCaseStringEq( benchmark::State & state )
+    {
+        auto paths = makeLibPaths( 1024 );
+        auto upper = paths;
+        for ( auto && ii : upper )
+            ii = NStringUtils::toupper( ii );
+        NStringUtils::noCaseStringEq eq;
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            size_t count = 0;
+            for ( size_t ii = 0; ii < paths.size(); ++ii )
+                count += eq( paths[ ii ], upper[ ii ] ) ? 1 : 0;
+            benchmark::DoNotOptimize( count );
+        }
+        state.SetItemsProcessed( static_cast< int64_t >( state.iterations() * paths.size() ) );
+    }
+    BENCHMARK( BM_noCaseStringEq );
+
+    std::vector< std::string > makeLogKeywords()
+    {
+        return { "error", "warning", "info", "fatal", "critical", "note", "debug", "trace", "severe", "notice" };
+    }
+
+    void BM_strCaseFind( benchmark::State & state )
+    {
+        auto line = NBenchUtils::makeDelimitedLine( static_cast< size_t >( state.range( 0 ) ), ' ' ) + " Fatal: done";
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto pos = NStringUtils::strCaseFind( line, "FATAL" );
+            benchmark::DoNotOptimize( pos );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * line.size() ) );
+    }
+    BENCHMARK( BM_strCaseFind )->Arg( 16 )->Arg( 1024 );
+
+    void BM_strCaseFindLoop( benchmark::State & state )
+    {
+        auto line = NBenchUtils::makeDelimitedLine( static_cast< size_t >( state.range( 0 ) ), ' ' ) + " Fatal: done";
+        auto keywords = makeLogKeywords();
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            size_t count = 0;
+            for ( auto && ii : keywords )
+                count += ( NStringUtils::strCaseFind( line, ii ) != std::string::npos ) ? 1 : 0;
+            benchmark::DoNotOptimize( count );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * line.size() ) );
+    }
+    BENCHMARK( BM_strCaseFindLoop )->Arg( 16 )->Arg( 1024 );
+
+    void BM_MultiStringSearch( benchmark::State & state )
+    {
+        auto line = NBenchUtils::makeDelimitedLine( static_cast< size_t >( state.range( 0 ) ), ' ' ) + " Fatal: done";
+        NStringUtils::CMultiStringSearch keywords( makeLogKeywords() );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto matches = keywords.findAll( line );
+            benchmark::DoNotOptimize( matches );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * line.size() ) );
+    }
+    BENCHMARK( BM_MultiStringSearch )->Arg( 16 )->Arg( 1024 );
+
+    QList< QStringList > makeReportData( int numRows )
+    {
+        QList< QStringList > retVal;
+        for ( int ii = 0; ii < numRows; ++ii )
+            retVal << QStringList( { QString( "top.u%1.inst" ).arg( ( ii * 7919 ) % numRows ), QString::number( ii ), QString( ii % 23, 'x' ) } );
+        return retVal;
+    }
+
+    void BM_asReport( benchmark::State & state )
+    {
+        auto data = makeReportData( static_cast< int >( state.range( 0 ) ) );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto report = NStringUtils::asReport( { "Instance", "Index", "Comment" }, {}, data, true );
+            benchmark::DoNotOptimize( report );
+        }
+        state.SetItemsProcessed( state.iterations() * data.size() );
+    }
+    BENCHMARK( BM_asReport )->Arg( 1000 )->Arg( 100000 );
+
+    void BM_ReportWriter( benchmark::State & state )
+    {
+        auto data = makeReportData( static_cast< int >( state.range( 0 ) ) );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            std::ostringstream oss;
+            NStringUtils::CReportWriter writer( oss, { "Instance", "Index", "Comment" }, {}, true );
+            writer.setSampleSize( 1000 );
+            for ( auto && ii : data )
+                writer.addRow( ii );
+            writer.finish();
+            benchmark::DoNotOptimize( oss );
+        }
+        state.SetItemsProcessed( state.iterations() * data.size() );
+    }
+    BENCHMARK( BM_ReportWriter )->Arg( 1000 )->Arg( 100000 );
+
+    std::vector< std::string > makeHierNames( size_t numNames )
+    {
+        std::vector< std::string > retVal;
+        retVal.reserve( numNames );
+        for ( size_t ii = 0; ii < numNames; ++ii )
+            retVal.push_back( "top/core_" + std::to_string( ii % 4 ) + "/alu_block_" + std::to_string( ( ii / 4 ) % 16 ) + "/reg_file/bit_" + std::to_string( ii ) );
+        return retVal;
+    }
+
+    void BM_splitSDCPatternParent( benchmark::State & state )
+    {
+        auto names = makeHierNames( 1024 );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            for ( auto && ii : names )
+            {
+                bool aOK;
+                auto segments = NStringUtils::splitSDCPattern( ii, false, '/', aOK, nullptr );
+                segments.pop_back();
+                benchmark::DoNotOptimize( segments );
+            }
+        }
+        state.SetItemsProcessed( state.iterations() * names.size() );
+    }
+    BENCHMARK( BM_splitSDCPatternParent );
+
+    void BM_HierNameStoreParent( benchmark::State & state )
+    {
+        auto names = makeHierNames( 1024 );
+        NStringUtils::CHierNameStore store;
+        for ( auto && ii : names )
+            store.add( ii );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            for ( auto && ii : names )
+            {
+                auto parent = store.parent( store.find( ii ) );
+                benchmark::DoNotOptimize( parent );
+            }
+        }
+        state.SetItemsProcessed( state.iterations() * names.size() );
+    }
+    BENCHMARK( BM_HierNameStoreParent );
+
+    void BM_joinString( benchmark::State & state )
+    {
+        std::vector< std::string > list;
+        for ( int64_t ii = 0; ii < state.range( 0 ); ++ii )
+            list.push_back( "field_" + std::to_string( ii ) );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto joined = NStringUtils::joinString( list, ", " );
+            benchmark::DoNotOptimize( joined );
+        }
+        state.SetItemsProcessed( state.iterations() * list.size() );
+    }
+    BENCHMARK( BM_joinString )->Arg( 8 )->Arg( 1024 );
+
+    void BM_getFMTString( benchmark::State & state )
+    {
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto msg = NStringUtils::getFMTString( "%s:%d: %d errors (%.1f%%)", "top/core_0/alu.v", 1234, 17, 3.25 );
+            benchmark::DoNotOptimize( msg );
+        }
+    }
+    BENCHMARK( BM_getFMTString );
+
+    void BM_formatTo( benchmark::State & state )
+    {
+        std::string msg;
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            msg.clear();
+            NStringUtils::formatTo( msg, SAB_FORMAT( "{}:{}: {} errors ({:.1f}%)" ), "top/core_0/alu.v", 1234, 17, 3.25 );
+            benchmark::DoNotOptimize( msg );
+        }
+    }
+    BENCHMARK( BM_formatTo );
+
+    void BM_replaceAllChained( benchmark::State & state )
+    {
+        auto line = NBenchUtils::makeDelimitedLine( static_cast< size_t >( state.range( 0 ) ), '/' ) + "[3].q";
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto curr = NStringUtils::replaceAll( line, '/', '_' );
+            curr = NStringUtils::replaceAll( curr, '[', '_' );
+            curr = NStringUtils::replaceAll( curr, "]", "" );
+            curr = NStringUtils::replaceAll( curr, '.', '_' );
+            curr = NStringUtils::replaceAll( curr, "_with_a", "_w" );
+            benchmark::DoNotOptimize( curr );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * line.size() ) );
+    }
+    BENCHMARK( BM_replaceAllChained )->Arg( 16 )->Arg( 1024 );
+
+    void BM_MultiStringReplace( benchmark::State & state )
+    {
+        auto line = NBenchUtils::makeDelimitedLine( static_cast< size_t >( state.range( 0 ) ), '/' ) + "[3].q";
+        NStringUtils::CMultiStringReplace replacements( { { "/", "_" }, { "[", "_" }, { "]", "" }, { ".", "_" }, { "_with_a", "_w" } } );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto curr = replacements.replace( line );
+            benchmark::DoNotOptimize( curr );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * line.size() ) );
+    }
+    BENCHMARK( BM_MultiStringReplace )->Arg( 16 )->Arg( 1024 );
+
+    void BM_expandEnvVariable( benchmark::State & state )
+    {
+        auto fileList = NBenchUtils::makeEnvFileList( 1024 );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            for ( auto && ii : fileList )
+            {
+                auto expanded = NStringUtils::expandEnvVariable( ii );
+                benchmark::DoNotOptimize( expanded );
+            }
+        }
+        state.SetItemsProcessed( state.iterations() * fileList.size() );
+    }
+    BENCHMARK( BM_expandEnvVariable );
+
+    void BM_EnvVarExpander( benchmark::State & state )
+    {
+        auto fileList = NBenchUtils::makeEnvFileList( 1024 );
+        NStringUtils::CEnvironmentSnapshot env( false );
+        NStringUtils::CEnvVarExpander expander( env );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto curr = fileList;
+            expander.expandAll( curr );
+            benchmark::DoNotOptimize( curr );
+        }
+        state.SetItemsProcessed( state.iterations() * fileList.size() );
+    }
+    BENCHMARK( BM_EnvVarExpander );
+
+    std::string makeBinaryData( size_t len )
+    {
+        std::string retVal( len, 0 );
+        uint32_t seed = 12345;
+        for ( auto && ii : retVal )
+        {
+            seed = seed * 1103515245 + 12345;
+            ii = static_cast< char >( seed >> 16 );
+        }
+        return retVal;
+    }
+
+    void BM_TransferDecode( benchmark::State & state )
+    {
+        auto encoding = static_cast< NStringUtils::ETransferEncoding >( state.range( 0 ) );
+        auto encoded = NStringUtils::encodeString( makeBinaryData( 1024 * 1024 ), encoding );
+        std::string decoded;
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            decoded.clear();
+            NStringUtils::CStreamDecoder decoder( encoding );
+            decoder.decode( encoded.data(), encoded.length(), decoded );
+            decoder.finish( decoded );
+            benchmark::DoNotOptimize( decoded );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * encoded.size() ) );
+    }
+    BENCHMARK( BM_TransferDecode )->Arg( static_cast< int >( NStringUtils::ETransferEncoding::eBase64 ) )->Arg( static_cast< int >( NStringUtils::ETransferEncoding::eUUEncode ) )->Arg( static_cast< int >( NStringUtils::ETransferEncoding::eQuotedPrintable ) );
+
+    void BM_validateBase64Lines( benchmark::State & state )
+    {
+        auto encoded = NStringUtils::encodeString( makeBinaryData( 1024 * 1024 ), NStringUtils::ETransferEncoding::eBase64 );
+        std::vector< std::string > lines;
+        NStringUtils::CStringTokenizer tokenizer( encoded, '\n', true );
+        for ( auto && ii : tokenizer )
+            lines.emplace_back( ii );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            bool aOK = true;
+            for ( auto && ii : lines )
+                aOK = NStringUtils::validateBase64String( ii ) && aOK;
+            benchmark::DoNotOptimize( aOK );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * encoded.size() ) );
+    }
+    BENCHMARK( BM_validateBase64Lines );
+
+    std::string makeSourceText( size_t numLines )
+    {
+        std::string retVal;
+        for ( size_t ii = 0; ii < numLines; ++ii )
+            retVal += "    assign sig_" + std::to_string( ii ) + " = a[" + std::to_string( ii % 32 ) + "] & b; // line " + std::to_string( ii ) + "\n";
+        return retVal;
+    }
+
+    void BM_LineReaderTokens( benchmark::State & state )
+    {
+        auto text = makeSourceText( 100000 );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            NFileUtils::CLineReader reader( text );
+            std::string_view token;
+            size_t numTokens = 0;
+            while ( reader.nextToken( token ) )
+                numTokens++;
+            benchmark::DoNotOptimize( numTokens );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * text.size() ) );
+    }
+    BENCHMARK( BM_LineReaderTokens );
+
+    void BM_LineReaderIndex( benchmark::State & state )
+    {
+        auto text = makeSourceText( 100000 );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            NFileUtils::CLineReader reader( text );
+            auto line = reader.line( 99999 );
+            benchmark::DoNotOptimize( line );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * text.size() ) );
+    }
+    BENCHMARK( BM_LineReaderIndex );
+
+    void BM_writeEscaped( benchmark::State & state )
+    {
+        // mostly hierarchical names, every 16th needs escaping
+        std::vector< std::string > names;
+        for ( size_t ii = 0; ii < 4096; ++ii )
+            names.push_back( "top.core_" + std::to_string( ii % 8 ) + ".alu.reg_file_" + std::to_string( ii ) + ( ( ii % 16 ) ? "[31]" : "<31>" ) );
+        size_t numBytes = 0;
+        for ( auto && ii : names )
+            numBytes += ii.length();
+
+        std::string out;
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            out.clear();
+            for ( auto && ii : names )
+                NStringUtils::appendEscaped( out, ii );
+            benchmark::DoNotOptimize( out );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * numBytes ) );
+    }
+    BENCHMARK( BM_writeEscaped );
+
+    std::string makeNumericColumn( size_t numRows )
+    {
+        std::string retVal;
+        for ( size_t ii = 0; ii < numRows; ++ii )
+            retVal += "cell_" + std::to_string( ii ) + "," + std::to_string( ii * 37 % 100000 ) + "," + std::to_string( ii * 0.125 ) + "\n";
+        return retVal;
+    }
+
+    void BM_fromStringDouble( benchmark::State & state )
+    {
+        std::vector< std::string > values;
+        for ( size_t ii = 0; ii < 1024; ++ii )
+            values.push_back( std::to_string( ii * 0.125 ) );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            double sum = 0;
+            for ( auto && ii : values )
+            {
+                double value;
+                if ( fromString( value, ii ) )
+                    sum += value;
+            }
+            benchmark::DoNotOptimize( sum );
+        }
+        state.SetItemsProcessed( state.iterations() * values.size() );
+    }
+    BENCHMARK( BM_fromStringDouble );
+
+    void BM_parseColumn( benchmark::State & state )
+    {
+        auto text = makeNumericColumn( 100000 );
+        std::vector< double > values;
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            values.clear();
+            NFromString::parseColumn( text, ',', 2, values );
+            benchmark::DoNotOptimize( values );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * text.size() ) );
+    }
+    BENCHMARK( BM_parseColumn );
+
+    void BM_hexToInt( benchmark::State & state )
+    {
+        std::vector< std::string > literals;
+        for ( uint64_t ii = 0; ii < 1024; ++ii )
+            literals.push_back( NStringUtils::getFMTString( "0x%016llX", static_cast< unsigned long long >( ii * 0x9E3779B97F4A7C15ULL ) ) );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            uint64_t sum = 0;
+            for ( auto && ii : literals )
+            {
+                uint64_t value;
+                if ( NStringUtils::hexToInt( value, ii ) )
+                    sum += value;
+            }
+            benchmark::DoNotOptimize( sum );
+        }
+        state.SetItemsProcessed( state.iterations() * literals.size() );
+    }
+    BENCHMARK( BM_hexToInt );
+
+    void BM_parseHexWords( benchmark::State & state )
+    {
+        std::string text;
+        for ( uint64_t ii = 0; ii < 100000; ++ii )
+            text += NStringUtils::getFMTString( "%08llx\n", static_cast< unsigned long long >( ( ii * 2654435761ULL ) & 0xFFFFFFFF ) );
+        std::vector< uint64_t > words;
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            words.clear();
+            NStringUtils::parseHexWords( text, words, 32 );
+            benchmark::DoNotOptimize( words );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * text.size() ) );
+    }
+    BENCHMARK( BM_parseHexWords );
+
+    // 0 - NQtUtils::splitLineCSV per line, 1 - CCSVParser, 2 - CCSVLoader
+    void BM_parseCSV( benchmark::State & state )
+    {
+        auto text = NBenchUtils::makeCSV( 100000 );
+        std::vector< QString > lines;
+        if ( state.range( 0 ) == 0 )
+        {
+            for ( auto && ii : NStringUtils::splitString( text, '\n', true ) )
+                lines.push_back( QString::fromStdString( ii ) );
+        }
+        NFileUtils::CCSVRecords records;
+        NFileUtils::CCSVLoader loader;
+        loader.setChunkSize( 1024 * 1024 );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            size_t count = 0;
+            if ( state.range( 0 ) == 0 )
+            {
+                for ( auto && line : lines )
+                    count += NQtUtils::splitLineCSV( line ).empty() ? 0 : 1;
+            }
+            else if ( state.range( 0 ) == 1 )
+            {
+                records.clear();
+                NFileUtils::CCSVParser parser( text );
+                parser.parseAll( records );
+                count = records.size();
+            }
+            else
+            {
+                loader.load( text, [ &count ]( const NFileUtils::CCSVRecords & batch ) { count += batch.size(); return true; } );
+            }
+            benchmark::DoNotOptimize( count );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * text.size() ) );
+    }
+    BENCHMARK( BM_parseCSV )->Arg( 0 )->Arg( 1 )->Arg( 2 );
+
+    // 0 - NQtUtils::fromHtmlEscaped, 1 - NStringUtils::fromHtmlEscaped into a reused buffer
+    void BM_fromHtmlEscaped( benchmark::State & state )
+    {
+        std::string text;
+        for ( size_t ii = 0; ii < 10000; ++ii )
+            text += "&lt;td class=&quot;u" + std::to_string( ii ) + "&quot;&gt;caf&eacute; &amp; cr&egrave;me &#x20AC;" + std::to_string( ii ) + "&lt;/td&gt;\n";
+        auto qText = QString::fromStdString( text );
+        std::string buffer;
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            if ( state.range( 0 ) == 0 )
+                benchmark::DoNotOptimize( NQtUtils::fromHtmlEscaped( qText ) );
+            else
+                benchmark::DoNotOptimize( NStringUtils::fromHtmlEscaped( text, buffer ) );
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * text.size() ) );
+    }
+    BENCHMARK( BM_fromHtmlEscaped )->Arg( 0 )->Arg( 1 );
+
+    // 0 - ISO timestamps, 1 - Qt::TextDate timestamps
+    void BM_getDateTime( benchmark::State & state )
+    {
+        QStringList values;
+        auto start = QDateTime( QDate( 2021, 1, 1 ), QTime( 0, 0 ) );
+        for ( int ii = 0; ii < 1000; ++ii )
+            values << start.addSecs( ii * 3607 ).toString( ( state.range( 0 ) == 0 ) ? Qt::ISODate : Qt::TextDate );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            for ( auto && ii : values )
+                benchmark::DoNotOptimize( NQtUtils::getDateTime( ii ) );
+        }
+        state.SetItemsProcessed( static_cast< int64_t >( state.iterations() * values.count() ) );
+    }
+    BENCHMARK( BM_getDateTime )->Arg( 0 )->Arg( 1 );
+
+    // 0 - toBinString per value, 1 - formatIntegers binary, 2 - formatIntegers hex, all newline separated
+    void BM_formatIntegers( benchmark::State & state )
+    {
+        std::vector< uint32_t > values( 1 << 16 );
+        uint32_t curr = 0x9E3779B9;
+        for ( auto && ii : values )
+        {
+            curr = curr * 1664525 + 1013904223;
+            ii = curr;
+        }
+        NStringUtils::SIntFormat format;
+        format.fRadix = ( state.range( 0 ) == 2 ) ? NStringUtils::ERadix::eHex : NStringUtils::ERadix::eBinary;
+        format.fSeparator = "\n";
+        std::string text;
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            text.clear();
+            if ( state.range( 0 ) == 0 )
+            {
+                for ( auto && ii : values )
+                {
+                    text += NStringUtils::toBinString( ii );
+                    text += '\n';
+                }
+            }
+            else
+                NStringUtils::appendIntegers( text, values.data(), values.size(), format );
+            benchmark::DoNotOptimize( text.data() );
+        }
+        state.SetItemsProcessed( static_cast< int64_t >( state.iterations() * values.size() ) );
+    }
+    BENCHMARK( BM_formatIntegers )->Arg( 0 )->Arg( 1 )->Arg( 2 );
+
+    // 0 - CIdentifierLexer::next one identifier at a time, 1 - tokenize into a reused span array
+    void BM_identifierLexer( benchmark::State & state )
+    {
+        auto text = NBenchUtils::makeVerilog( 2000 );
+        NStringUtils::CIdentifierLexer lexer;
+        std::vector< std::string_view > ids;
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            if ( state.range( 0 ) == 0 )
+            {
+                size_t pos = 0;
+                size_t length = 0;
+                std::string_view id;
+                while ( lexer.next( text, pos, id ) )
+                    length += id.length();
+                benchmark::DoNotOptimize( length );
+            }
+            else
+            {
+                ids.clear();
+                lexer.tokenize( text, ids );
+                benchmark::DoNotOptimize( ids.data() );
+            }
+        }
+        state.SetBytesProcessed( static_cast< int64_t >( state.iterations() * text.size() ) );
+    }
+    BENCHMARK( BM_identifierLexer )->Arg( 0 )->Arg( 1 );
+}
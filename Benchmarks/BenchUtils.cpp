@@ -0,0 +1,107 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../utils.h"
+#include "AllocationCounter.h"
+#include "Corpus.h"
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // 720720 has 240 factors, 999983 is prime
+    void BM_computeFactors( benchmark::State & state )
+    {
+        auto num = static_cast< int64_t >( state.range( 0 ) );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto factors = NUtils::computeFactors( num );
+            benchmark::DoNotOptimize( factors );
+        }
+    }
+    BENCHMARK( BM_computeFactors )->Arg( 720720 )->Arg( 999983 );
+
+    void BM_computePrimeFactors( benchmark::State & state )
+    {
+        auto num = static_cast< int64_t >( state.range( 0 ) );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto factors = NUtils::computePrimeFactors( num );
+            benchmark::DoNotOptimize( factors );
+        }
+    }
+    BENCHMARK( BM_computePrimeFactors )->Arg( 720720 )->Arg( 999983 );
+
+    void BM_isSemiPerfect( benchmark::State & state )
+    {
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            size_t count = 0;
+            for ( int64_t ii = 2; ii < state.range( 0 ); ++ii )
+                count += NUtils::isSemiPerfect( ii ).first ? 1 : 0;
+            benchmark::DoNotOptimize( count );
+        }
+        state.SetItemsProcessed( state.iterations() * ( state.range( 0 ) - 2 ) );
+    }
+    BENCHMARK( BM_isSemiPerfect )->Arg( 300 );
+
+    // the bit strings as base 2 numbers, back to base 36
+    void BM_toStringBase( benchmark::State & state )
+    {
+        std::vector< int64_t > values;
+        for ( auto && ii : NBenchUtils::makeBitStrings( 1024, 62 ) )
+        {
+            if ( ii.find_first_not_of( "01" ) == std::string::npos )
+                values.push_back( NUtils::fromString( ii, 2 ) );
+        }
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            for ( auto && ii : values )
+            {
+                auto str = NUtils::toString( ii, 36 );
+                benchmark::DoNotOptimize( str );
+            }
+        }
+        state.SetItemsProcessed( static_cast< int64_t >( state.iterations() * values.size() ) );
+    }
+    BENCHMARK( BM_toStringBase );
+
+    void BM_getTimeString( benchmark::State & state )
+    {
+        auto duration = std::chrono::system_clock::duration( std::chrono::hours( 26 ) + std::chrono::minutes( 3 ) + std::chrono::milliseconds( 4567 ) );
+        NBenchUtils::CAllocationCounter allocs( state );
+        for ( auto _ : state )
+        {
+            auto str = NUtils::getTimeString( duration, false, true );
+            benchmark::DoNotOptimize( str );
+        }
+    }
+    BENCHMARK( BM_getTimeString );
+}
@@ -0,0 +1,169 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "Corpus.h"
+
+#include <QtGlobal>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+namespace NBenchUtils
+{
+    std::string makeDelimitedLine( size_t numFields, char delim )
+    {
+        std::string retVal;
+        for ( size_t ii = 0; ii < numFields; ++ii )
+        {
+            if ( ii )
+                retVal += delim;
+            retVal += "field_" + std::to_string( ii );
+            if ( ( ii % 7 ) == 0 )
+                retVal += "_with_a_longer_tail";
+        }
+        return retVal;
+    }
+
+    std::vector< std::string > makeNames( size_t numNames )
+    {
+        std::vector< std::string > retVal;
+        for ( size_t ii = 0; ii < numNames; ++ii )
+            retVal.push_back( "top.core" + std::to_string( ( ii * 7 ) % 64 ) + ".u" + std::to_string( ( ii * 131 ) % 5000 ) + ".reg" + std::to_string( ii % 4 ) );
+        return retVal;
+    }
+
+    std::vector< std::string > makePatterns( size_t numPatterns )
+    {
+        std::vector< std::string > retVal;
+        for ( size_t ii = 0; ii < numPatterns; ++ii )
+            retVal.push_back( "top.core" + std::to_string( ii % 64 ) + ".u" + std::to_string( ii ) + ( ( ii % 5 ) ? ".reg?" : "*" ) );
+        return retVal;
+    }
+
+    std::string makeHexString( size_t numBits )
+    {
+        std::string retVal;
+        for ( size_t ii = 0; ii < numBits / 4; ++ii )
+            retVal += "0123456789abcdef"[ ( ii * 7 ) % 16 ];
+        return retVal;
+    }
+
+    std::vector< std::string > makeBitStrings( size_t numStrings, size_t numBits )
+    {
+        std::vector< std::string > retVal;
+        uint64_t state = 0x9E3779B97F4A7C15ULL;
+        for ( size_t ii = 0; ii < numStrings; ++ii )
+        {
+            std::string curr;
+            curr.reserve( numBits );
+            for ( size_t jj = 0; jj < numBits; ++jj )
+            {
+                state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+                curr += ( ( state >> 33 ) & 1 ) ? '1' : '0';
+            }
+            if ( ( ii % 16 ) == 0 )
+                curr[ ii % numBits ] = ( ii % 32 ) ? 'x' : 'z';
+            retVal.push_back( curr );
+        }
+        return retVal;
+    }
+
+    std::string makeCSV( size_t numRecords )
+    {
+        std::string retVal;
+        for ( size_t ii = 0; ii < numRecords; ++ii )
+            retVal += "top.core" + std::to_string( ii % 64 ) + ".u" + std::to_string( ii ) + "," + std::to_string( ii * 7 ) + ",\"slack, \"\"worst\"\"\",0.25\n";
+        return retVal;
+    }
+
+    std::vector< std::string > makeEnvFileList( size_t numFiles )
+    {
+        qputenv( "SAB_BENCH_ROOT", "/proj/chip" );
+        qputenv( "SAB_BENCH_RTL", "${SAB_BENCH_ROOT}/rtl" );
+        std::vector< std::string > retVal;
+        for ( size_t ii = 0; ii < numFiles; ++ii )
+            retVal.push_back( "$SAB_BENCH_RTL/block_" + std::to_string( ii % 64 ) + "/$(SAB_BENCH_ROOT)_" + std::to_string( ii ) + ".v" );
+        return retVal;
+    }
+
+    std::string makeVerilog( size_t numModules )
+    {
+        std::string retVal = "// generated RTL\n`timescale 1ns/1ps\n";
+        for ( size_t ii = 0; ii < numModules; ++ii )
+        {
+            auto index = std::to_string( ii );
+            retVal += "module block_" + index + " ( input wire clk, input wire rst_n, input wire [31:0] data_in, output reg [31:0] data_out );\n";
+            retVal += "    /* registered datapath\n       for block " + index + " */\n";
+            retVal += "    reg [31:0] \\pipe_stage[" + index + "] ;\n";
+            retVal += "    always @( posedge clk or negedge rst_n )\n        if ( !rst_n )\n            data_out <= 32'h0000_0000; // reset\n";
+            retVal += "        else\n            data_out <= data_in + 32'd" + index + " + \\pipe_stage[" + index + "] ;\n";
+            retVal += "    initial $display( \"block_%0d ready\", " + index + " );\nendmodule\n\n";
+        }
+        return retVal;
+    }
+
+    std::string makeFileListText( size_t numFiles )
+    {
+        std::string retVal = "// generated file list\n";
+        for ( size_t ii = 0; ii < numFiles; ++ii )
+        {
+            auto block = "block_" + std::to_string( ii % 64 );
+            if ( ( ii % 64 ) == 0 )
+                retVal += "+incdir+./rtl/" + block + "/include\n";
+            if ( ( ii % 50 ) == 0 )
+                retVal += "// " + block + " cells\n-v ../lib/cells_" + std::to_string( ii % 3 ) + ".v\n";
+            retVal += "./rtl/" + block + "/../" + block + "/u" + std::to_string( ii ) + ( ( ii % 3 ) ? ".sv\n" : ".v\n" );
+        }
+        return retVal;
+    }
+
+    CDirTree::CDirTree( size_t depth, size_t breadth, size_t filesPerDir )
+    {
+        fRoot = ( std::filesystem::temp_directory_path() / ( "sab_bench_tree_" + std::to_string( std::chrono::steady_clock::now().time_since_epoch().count() ) ) ).generic_string();
+        std::filesystem::remove_all( fRoot );
+        addDir( fRoot, depth, breadth, filesPerDir );
+    }
+
+    CDirTree::~CDirTree()
+    {
+        std::error_code ec;
+        std::filesystem::remove_all( fRoot, ec );
+    }
+
+    void CDirTree::addDir( const std::string & dir, size_t depth, size_t breadth, size_t filesPerDir )
+    {
+        std::filesystem::create_directories( dir );
+        fDirs.push_back( dir );
+        for ( size_t ii = 0; ii < filesPerDir; ++ii )
+        {
+            auto fileName = dir + "/file_" + std::to_string( ii ) + ( ( ii % 2 ) ? ".cpp" : ".h" );
+            std::ofstream( fileName ) << "// " << fileName << "\n";
+            fFiles.push_back( fileName );
+        }
+        if ( !depth )
+            return;
+        for ( size_t ii = 0; ii < breadth; ++ii )
+            addDir( dir + "/dir_" + std::to_string( ii ), depth - 1, breadth, filesPerDir );
+    }
+}
@@ -0,0 +1,77 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef __BENCHMARKS_CORPUS_H
+#define __BENCHMARKS_CORPUS_H
+
+#include <string>
+#include <vector>
+
+// Deterministic inputs shaped like the data the library sees in practice
+namespace NBenchUtils
+{
+    // field_0,field_1... every 7th field longer
+    std::string makeDelimitedLine( size_t numFields, char delim );
+
+    // hierarchical instance names, top.coreN.uM.regK
+    std::vector< std::string > makeNames( size_t numNames );
+    // wildcard patterns over the same hierarchy
+    std::vector< std::string > makePatterns( size_t numPatterns );
+
+    std::string makeHexString( size_t numBits );
+    // '0'/'1' strings of numBits, a few with 'x' and 'z' bits
+    std::vector< std::string > makeBitStrings( size_t numStrings, size_t numBits );
+
+    // name,value,"quoted, ""field""",number records
+    std::string makeCSV( size_t numRecords );
+
+    // paths referencing $SAB_BENCH_RTL, which references ${SAB_BENCH_ROOT}, both are set
+    std::vector< std::string > makeEnvFileList( size_t numFiles );
+    // Verilog modules, port lists, comments, sized literals and an escaped identifier per module
+    std::string makeVerilog( size_t numModules );
+
+    // the text of a -f file list, comments, +incdir+ and -v options and paths with ./ and ../
+    std::string makeFileListText( size_t numFiles );
+
+    // a directory tree in the temp directory, removed by the destructor
+    class CDirTree
+    {
+    public:
+        CDirTree( size_t depth, size_t breadth, size_t filesPerDir );
+        ~CDirTree();
+
+        CDirTree( const CDirTree & ) = delete;
+        CDirTree & operator=( const CDirTree & ) = delete;
+
+        const std::string & root() const { return fRoot; }
+        const std::vector< std::string > & dirs() const { return fDirs; }
+        const std::vector< std::string > & files() const { return fFiles; }
+    private:
+        void addDir( const std::string & dir, size_t depth, size_t breadth, size_t filesPerDir );
+
+        std::string fRoot;
+        std::vector< std::string > fDirs;
+        std::vector< std::string > fFiles;
+    };
+}
+#endif
@@ -0,0 +1,188 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct SResult
+    {
+        double fRealTime{ 0 }; // ns per iteration
+        double fAllocs{ -1 }; // per iteration, -1 when not counted
+    };
+
+    double toNanoSeconds( double value, const std::string & unit )
+    {
+        if ( unit == "us" )
+            return value * 1e3;
+        if ( unit == "ms" )
+            return value * 1e6;
+        if ( unit == "s" )
+            return value * 1e9;
+        return value;
+    }
+
+    // keeps the results for the baseline comparison, the console output is unchanged
+    class CCollectingReporter : public benchmark::ConsoleReporter
+    {
+    public:
+        void ReportRuns( const std::vector< Run > & runs ) override
+        {
+            for ( auto && run : runs )
+            {
+                SResult result;
+                result.fRealTime = run.GetAdjustedRealTime() * 1e9 / benchmark::GetTimeUnitMultiplier( run.time_unit );
+                auto allocs = run.counters.find( "allocs" );
+                if ( allocs != run.counters.end() )
+                    result.fAllocs = allocs->second.value;
+                fResults[ run.benchmark_name() ] = result;
+            }
+            ConsoleReporter::ReportRuns( runs );
+        }
+
+        const std::map< std::string, SResult > & results() const { return fResults; }
+    private:
+        std::map< std::string, SResult > fResults;
+    };
+
+    // the results stored by --benchmark_out=<file> --benchmark_out_format=json
+    bool loadBaseline( const QString & fileName, std::map< std::string, SResult > & baseline, QString & msg )
+    {
+        QFile file( fileName );
+        if ( !file.open( QIODevice::ReadOnly ) )
+        {
+            msg = QString( "Could not open baseline '%1': %2" ).arg( fileName ).arg( file.errorString() );
+            return false;
+        }
+
+        QJsonParseError error;
+        auto doc = QJsonDocument::fromJson( file.readAll(), &error );
+        if ( doc.isNull() )
+        {
+            msg = QString( "Invalid baseline '%1': %2" ).arg( fileName ).arg( error.errorString() );
+            return false;
+        }
+
+        for ( auto && ii : doc.object().value( "benchmarks" ).toArray() )
+        {
+            auto benchmark = ii.toObject();
+            SResult result;
+            result.fRealTime = toNanoSeconds( benchmark.value( "real_time" ).toDouble(), benchmark.value( "time_unit" ).toString( "ns" ).toStdString() );
+            result.fAllocs = benchmark.value( "allocs" ).toDouble( -1 );
+            baseline[ benchmark.value( "name" ).toString().toStdString() ] = result;
+        }
+        return true;
+    }
+
+    // a regression is slower by more than threshold percent, or more allocations
+    int compareToBaseline( const std::map< std::string, SResult > & results, const std::map< std::string, SResult > & baseline, double threshold )
+    {
+        int numRegressions = 0;
+        std::printf( "\n%-50s %14s %14s %9s %12s\n", "Benchmark", "Baseline ns", "Current ns", "Change", "Allocs" );
+        for ( auto && ii : results )
+        {
+            auto pos = baseline.find( ii.first );
+            if ( pos == baseline.end() )
+            {
+                std::printf( "%-50s %14s %14.1f %9s\n", ii.first.c_str(), "-", ii.second.fRealTime, "new" );
+                continue;
+            }
+
+            auto change = ( pos->second.fRealTime > 0 ) ? ( 100.0 * ( ii.second.fRealTime - pos->second.fRealTime ) / pos->second.fRealTime ) : 0.0;
+            bool moreAllocs = ( pos->second.fAllocs >= 0 ) && ( ii.second.fAllocs > ( pos->second.fAllocs + 0.5 ) );
+            bool regression = ( change > threshold ) || moreAllocs;
+            if ( regression )
+                numRegressions++;
+
+            std::string allocs;
+            if ( ii.second.fAllocs >= 0 )
+                allocs = std::to_string( static_cast< long long >( pos->second.fAllocs + 0.5 ) ) + "->" + std::to_string( static_cast< long long >( ii.second.fAllocs + 0.5 ) );
+            std::printf( "%-50s %14.1f %14.1f %+8.1f%% %12s%s\n", ii.first.c_str(), pos->second.fRealTime, ii.second.fRealTime, change, allocs.c_str(), regression ? "  REGRESSION" : "" );
+        }
+        std::printf( "%d regression(s), threshold %.1f%%\n", numRegressions, threshold );
+        return numRegressions;
+    }
+
+    // removes --sab_<name>=value from the arguments, benchmark::Initialize rejects unknown ones
+    bool takeArg( int & argc, char ** argv, const char * name, std::string & value )
+    {
+        auto prefix = std::string( "--sab_" ) + name + "=";
+        for ( int ii = 1; ii < argc; ++ii )
+        {
+            if ( std::strncmp( argv[ ii ], prefix.c_str(), prefix.length() ) != 0 )
+                continue;
+            value = argv[ ii ] + prefix.length();
+            for ( int jj = ii; jj < ( argc - 1 ); ++jj )
+                argv[ jj ] = argv[ jj + 1 ];
+            argc--;
+            return true;
+        }
+        return false;
+    }
+}
+
+// besides the google benchmark options
+//   --sab_baseline=<file>    compares to the JSON written by --benchmark_out=<file> --benchmark_out_format=json,
+//                            exits with 1 on a regression
+//   --sab_threshold=<pct>    slow down allowed before a regression is reported, 10 by default
+int main( int argc, char ** argv )
+{
+    std::string baselineFile;
+    std::string threshold = "10";
+    takeArg( argc, argv, "baseline", baselineFile );
+    takeArg( argc, argv, "threshold", threshold );
+
+    QCoreApplication appl( argc, argv );
+    ::benchmark::Initialize( &argc, argv );
+    if ( ::benchmark::ReportUnrecognizedArguments( argc, argv ) )
+        return 1;
+
+    std::map< std::string, SResult > baseline;
+    if ( !baselineFile.empty() )
+    {
+        QString msg;
+        if ( !loadBaseline( QString::fromStdString( baselineFile ), baseline, msg ) )
+        {
+            std::fprintf( stderr, "%s\n", qPrintable( msg ) );
+            return 1;
+        }
+    }
+
+    CCollectingReporter reporter;
+    ::benchmark::RunSpecifiedBenchmarks( &reporter );
+    ::benchmark::Shutdown();
+
+    if ( !baselineFile.empty() && compareToBaseline( reporter.results(), baseline, std::stod( threshold ) ) )
+        return 1;
+    return 0;
+}
@@ -0,0 +1,593 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "BitVector.h"
+#include "SIMDUtils.h"
+
+#include <algorithm>
+#include <array>
+
+namespace NStringUtils
+{
+    namespace
+    {
+        const int8_t kDigitX = 16;
+        const int8_t kDigitZ = 17;
+        const int8_t kSeparator = -2;
+        const int8_t kInvalid = -1;
+
+        const std::array< int8_t, 256 > & digitTable()
+        {
+            static const auto sTable = []()
+            {
+                std::array< int8_t, 256 > retVal;
+                retVal.fill( kInvalid );
+                for ( int ii = 0; ii < 10; ++ii )
+                    retVal[ '0' + ii ] = static_cast< int8_t >( ii );
+                for ( int ii = 0; ii < 6; ++ii )
+                {
+                    retVal[ 'a' + ii ] = static_cast< int8_t >( 10 + ii );
+                    retVal[ 'A' + ii ] = static_cast< int8_t >( 10 + ii );
+                }
+                retVal[ 'x' ] = retVal[ 'X' ] = retVal[ '?' ] = kDigitX;
+                retVal[ 'z' ] = retVal[ 'Z' ] = kDigitZ;
+                retVal[ '_' ] = kSeparator;
+                return retVal;
+            }();
+            return sTable;
+        }
+
+        // the 8 characters for each known byte, MSB first
+        const std::array< std::array< char, 8 >, 256 > & byteTable()
+        {
+            static const auto sTable = []()
+            {
+                std::array< std::array< char, 8 >, 256 > retVal;
+                for ( int ii = 0; ii < 256; ++ii )
+                {
+                    for ( int jj = 0; jj < 8; ++jj )
+                        retVal[ ii ][ jj ] = ( ii & ( 0x80 >> jj ) ) ? '1' : '0';
+                }
+                return retVal;
+            }();
+            return sTable;
+        }
+
+        uint64_t lowMask( unsigned int count )
+        {
+            return ( count >= 64 ) ? ~uint64_t( 0 ) : ( ( uint64_t( 1 ) << count ) - 1 );
+        }
+
+        // limbs are little endian 32 bit, limbs = limbs * mul + add
+        void mulAdd( std::vector< uint32_t > & limbs, uint32_t mul, uint32_t add )
+        {
+            uint64_t carry = add;
+            for ( auto && ii : limbs )
+            {
+                auto curr = static_cast< uint64_t >( ii ) * mul + carry;
+                ii = static_cast< uint32_t >( curr );
+                carry = curr >> 32;
+            }
+            if ( carry )
+                limbs.push_back( static_cast< uint32_t >( carry ) );
+        }
+
+        // limbs = limbs / div, returns the remainder
+        uint32_t divMod( std::vector< uint32_t > & limbs, uint32_t div )
+        {
+            uint64_t rem = 0;
+            for ( auto ii = limbs.rbegin(); ii != limbs.rend(); ++ii )
+            {
+                auto curr = ( rem << 32 ) | *ii;
+                *ii = static_cast< uint32_t >( curr / div );
+                rem = curr % div;
+            }
+            while ( !limbs.empty() && ( limbs.back() == 0 ) )
+                limbs.pop_back();
+            return static_cast< uint32_t >( rem );
+        }
+
+        void twosComplement( std::vector< uint64_t > & words )
+        {
+            uint64_t carry = 1;
+            for ( auto && ii : words )
+            {
+                ii = ~ii + carry;
+                carry = ( carry && ( ii == 0 ) ) ? 1 : 0;
+            }
+        }
+
+        char unknownDigit( uint64_t value, uint64_t unknown, uint64_t mask )
+        {
+            if ( unknown == mask )
+            {
+                if ( value == mask )
+                    return 'x';
+                if ( value == 0 )
+                    return 'z';
+            }
+            return ( value & unknown ) ? 'X' : 'Z';
+        }
+    }
+
+    CBitVector::CBitVector( size_t width, EBitValue fill )
+    {
+        resize( width, fill );
+    }
+
+    void CBitVector::resize( size_t width, EBitValue fill )
+    {
+        auto oldWidth = fWidth;
+        fWidth = width;
+        fValue.resize( numWords( width ), 0 );
+        fUnknown.resize( numWords( width ), 0 );
+        clearUnused();
+
+        auto fillValue = ( static_cast< uint8_t >( fill ) & 1 ) ? ~uint64_t( 0 ) : 0;
+        auto fillUnknown = ( static_cast< uint8_t >( fill ) & 2 ) ? ~uint64_t( 0 ) : 0;
+        if ( !fillValue && !fillUnknown )
+            return;
+        for ( auto pos = oldWidth; pos < width; pos += 64 )
+            orBits( pos, 64, fillValue, fillUnknown );
+        clearUnused();
+    }
+
+    void CBitVector::clearUnused()
+    {
+        auto extra = static_cast< unsigned int >( fWidth % 64 );
+        if ( !extra || fValue.empty() )
+            return;
+        fValue.back() &= lowMask( extra );
+        fUnknown.back() &= lowMask( extra );
+    }
+
+    void CBitVector::orBits( size_t pos, unsigned int count, uint64_t value, uint64_t unknown )
+    {
+        if ( pos >= fWidth )
+            return;
+        value &= lowMask( count );
+        unknown &= lowMask( count );
+
+        auto word = pos / 64;
+        auto shift = static_cast< unsigned int >( pos % 64 );
+        fValue[ word ] |= value << shift;
+        fUnknown[ word ] |= unknown << shift;
+        if ( shift && ( ( shift + count ) > 64 ) && ( ( word + 1 ) < fValue.size() ) )
+        {
+            fValue[ word + 1 ] |= value >> ( 64 - shift );
+            fUnknown[ word + 1 ] |= unknown >> ( 64 - shift );
+        }
+    }
+
+    void CBitVector::getBits( size_t pos, unsigned int count, uint64_t & value, uint64_t & unknown ) const
+    {
+        value = unknown = 0;
+        if ( pos >= fWidth )
+            return;
+
+        auto word = pos / 64;
+        auto shift = static_cast< unsigned int >( pos % 64 );
+        value = fValue[ word ] >> shift;
+        unknown = fUnknown[ word ] >> shift;
+        if ( shift && ( ( shift + count ) > 64 ) && ( ( word + 1 ) < fValue.size() ) )
+        {
+            value |= fValue[ word + 1 ] << ( 64 - shift );
+            unknown |= fUnknown[ word + 1 ] << ( 64 - shift );
+        }
+        value &= lowMask( count );
+        unknown &= lowMask( count );
+    }
+
+    CBitVector::EBitValue CBitVector::bit( size_t pos ) const
+    {
+        uint64_t value, unknown;
+        getBits( pos, 1, value, unknown );
+        return static_cast< EBitValue >( value | ( unknown << 1 ) );
+    }
+
+    void CBitVector::setBit( size_t pos, EBitValue value )
+    {
+        if ( pos >= fWidth )
+            return;
+        auto mask = uint64_t( 1 ) << ( pos % 64 );
+        fValue[ pos / 64 ] &= ~mask;
+        fUnknown[ pos / 64 ] &= ~mask;
+        orBits( pos, 1, static_cast< uint8_t >( value ) & 1, ( static_cast< uint8_t >( value ) >> 1 ) & 1 );
+    }
+
+    bool CBitVector::isKnown() const
+    {
+        return std::all_of( fUnknown.begin(), fUnknown.end(), []( uint64_t ii ) { return ii == 0; } );
+    }
+
+    bool CBitVector::hasX() const
+    {
+        for ( size_t ii = 0; ii < fValue.size(); ++ii )
+        {
+            if ( fValue[ ii ] & fUnknown[ ii ] )
+                return true;
+        }
+        return false;
+    }
+
+    bool CBitVector::hasZ() const
+    {
+        for ( size_t ii = 0; ii < fValue.size(); ++ii )
+        {
+            if ( ~fValue[ ii ] & fUnknown[ ii ] )
+                return true;
+        }
+        return false;
+    }
+
+    bool CBitVector::toUInt64( uint64_t & value ) const
+    {
+        value = 0;
+        if ( !isKnown() )
+            return false;
+        if ( std::any_of( fValue.begin() + std::min< size_t >( 1, fValue.size() ), fValue.end(), []( uint64_t ii ) { return ii != 0; } ) )
+            return false;
+        if ( !fValue.empty() )
+            value = fValue.front();
+        return true;
+    }
+
+    bool CBitVector::operator==( const CBitVector & rhs ) const
+    {
+        return ( fWidth == rhs.fWidth ) && ( fValue == rhs.fValue ) && ( fUnknown == rhs.fUnknown );
+    }
+
+    CBitVector CBitVector::fromRadixString( std::string_view str, unsigned int bitsPerDigit, size_t width, bool * aOK )
+    {
+        auto && table = digitTable();
+        auto maxDigit = 1 << bitsPerDigit;
+
+        bool lclOK = true;
+        size_t numDigits = 0;
+        for ( auto && ch : str )
+        {
+            auto digit = table[ static_cast< unsigned char >( ch ) ];
+            if ( digit == kSeparator )
+                continue;
+            if ( ( digit == kInvalid ) || ( ( digit < kDigitX ) && ( digit >= maxDigit ) ) )
+                lclOK = false;
+            numDigits++;
+        }
+        if ( aOK )
+            *aOK = lclOK && ( numDigits != 0 );
+
+        if ( width == std::string::npos )
+            width = numDigits * bitsPerDigit;
+        CBitVector retVal( width );
+
+        auto mask = lowMask( bitsPerDigit );
+        size_t pos = 0;
+        int8_t lastDigit = 0;
+        for ( auto ii = str.rbegin(); ( ii != str.rend() ) && ( pos < width ); ++ii )
+        {
+            auto digit = table[ static_cast< unsigned char >( *ii ) ];
+            if ( digit == kSeparator )
+                continue;
+            if ( ( digit == kInvalid ) || ( ( digit < kDigitX ) && ( digit >= maxDigit ) ) )
+                digit = kDigitX; // same as hexToBin( char ), invalid digits become X
+
+            if ( digit == kDigitX )
+                retVal.orBits( pos, bitsPerDigit, mask, mask );
+            else if ( digit == kDigitZ )
+                retVal.orBits( pos, bitsPerDigit, 0, mask );
+            else
+                retVal.orBits( pos, bitsPerDigit, static_cast< uint64_t >( digit ), 0 );
+            lastDigit = digit;
+            pos += bitsPerDigit;
+        }
+
+        // a leading x or z fills the remaining width
+        if ( ( pos < width ) && ( lastDigit >= kDigitX ) )
+        {
+            for ( ; pos < width; pos += 64 )
+                retVal.orBits( pos, 64, ( lastDigit == kDigitX ) ? ~uint64_t( 0 ) : 0, ~uint64_t( 0 ) );
+        }
+        retVal.clearUnused();
+        return retVal;
+    }
+
+    CBitVector CBitVector::fromBinString( std::string_view str, size_t width, bool * aOK )
+    {
+#ifdef SAB_HAS_SSE2
+        // 16 characters at a time when the string is nothing but 0s and 1s
+        if ( ( str.length() >= 16 ) && ( str.find( '_' ) == std::string_view::npos ) )
+        {
+            static const auto sReverse = []()
+            {
+                std::array< uint8_t, 256 > retVal;
+                for ( int ii = 0; ii < 256; ++ii )
+                {
+                    uint8_t rev = 0;
+                    for ( int jj = 0; jj < 8; ++jj )
+                        rev |= ( ( ii >> jj ) & 1 ) << ( 7 - jj );
+                    retVal[ ii ] = rev;
+                }
+                return retVal;
+            }();
+
+            if ( width == std::string::npos )
+                width = str.length();
+            CBitVector retVal( width );
+
+            auto zeros = _mm_set1_epi8( '0' );
+            auto ones = _mm_set1_epi8( '1' );
+            bool allBinary = true;
+            size_t pos = 0;
+            auto end = str.length();
+            for ( ; allBinary && ( end >= 16 ) && ( pos < width ); end -= 16, pos += 16 )
+            {
+                auto block = _mm_loadu_si128( reinterpret_cast< const __m128i * >( str.data() + end - 16 ) );
+                auto isOne = _mm_cmpeq_epi8( block, ones );
+                auto isBinary = _mm_or_si128( isOne, _mm_cmpeq_epi8( block, zeros ) );
+                if ( _mm_movemask_epi8( isBinary ) != 0xFFFF )
+                {
+                    allBinary = false;
+                    break;
+                }
+                auto mask = static_cast< uint32_t >( _mm_movemask_epi8( isOne ) );
+                // byte 0 of the block is the most significant bit
+                auto bits = ( static_cast< uint64_t >( sReverse[ mask & 0xFF ] ) << 8 ) | sReverse[ mask >> 8 ];
+                retVal.orBits( pos, 16, bits, 0 );
+            }
+            for ( ; allBinary && ( end > 0 ) && ( pos < width ); --end, ++pos )
+            {
+                auto ch = str[ end - 1 ];
+                if ( ( ch != '0' ) && ( ch != '1' ) )
+                    allBinary = false;
+                else if ( ch == '1' )
+                    retVal.orBits( pos, 1, 1, 0 );
+            }
+            if ( allBinary )
+            {
+                // anything past the width is truncated, but must still be valid
+                for ( size_t ii = 0; allBinary && ( ii < end ); ++ii )
+                    allBinary = ( str[ ii ] == '0' ) || ( str[ ii ] == '1' );
+            }
+            if ( allBinary )
+            {
+                retVal.clearUnused();
+                if ( aOK )
+                    *aOK = true;
+                return retVal;
+            }
+        }
+#endif
+        return fromRadixString( str, 1, width, aOK );
+    }
+
+    CBitVector CBitVector::fromOctString( std::string_view str, size_t width, bool * aOK )
+    {
+        return fromRadixString( str, 3, width, aOK );
+    }
+
+    CBitVector CBitVector::fromHexString( std::string_view str, size_t width, bool * aOK )
+    {
+        return fromRadixString( str, 4, width, aOK );
+    }
+
+    CBitVector CBitVector::fromDecString( std::string_view str, size_t width, bool * aOK )
+    {
+        if ( aOK )
+            *aOK = false;
+
+        static const std::string_view whitespaces( " \t\f\v\n\r" );
+        auto startIdx = str.find_first_not_of( whitespaces );
+        if ( startIdx == std::string_view::npos )
+            return CBitVector( ( width == std::string::npos ) ? 0 : width );
+        str = str.substr( startIdx, str.find_last_not_of( whitespaces ) - startIdx + 1 );
+
+        bool negative = false;
+        if ( ( str.front() == '-' ) || ( str.front() == '+' ) )
+        {
+            negative = ( str.front() == '-' );
+            str.remove_prefix( 1 );
+        }
+
+        // a decimal value is either all digits, or a single x/z
+        auto && table = digitTable();
+        std::vector< uint32_t > limbs;
+        uint32_t chunk = 0;
+        uint32_t chunkMul = 1;
+        size_t numDigits = 0;
+        int8_t unknownDigit = 0;
+        for ( auto && ch : str )
+        {
+            auto digit = table[ static_cast< unsigned char >( ch ) ];
+            if ( digit == kSeparator )
+                continue;
+            numDigits++;
+            if ( ( digit == kDigitX ) || ( digit == kDigitZ ) )
+            {
+                if ( unknownDigit && ( unknownDigit != digit ) )
+                    return CBitVector( ( width == std::string::npos ) ? 0 : width );
+                unknownDigit = digit;
+                continue;
+            }
+            if ( ( digit < 0 ) || ( digit > 9 ) )
+                return CBitVector( ( width == std::string::npos ) ? 0 : width );
+
+            chunk = chunk * 10 + static_cast< uint32_t >( digit );
+            chunkMul *= 10;
+            if ( chunkMul == 1000000000 )
+            {
+                mulAdd( limbs, chunkMul, chunk );
+                chunk = 0;
+                chunkMul = 1;
+            }
+        }
+        if ( !numDigits || ( unknownDigit && ( ( numDigits != 1 ) || negative ) ) )
+            return CBitVector( ( width == std::string::npos ) ? 0 : width );
+
+        if ( unknownDigit )
+        {
+            if ( aOK )
+                *aOK = true;
+            return CBitVector( ( width == std::string::npos ) ? 1 : width, ( unknownDigit == kDigitX ) ? EBitValue::eX : EBitValue::eZ );
+        }
+
+        if ( chunkMul != 1 )
+            mulAdd( limbs, chunkMul, chunk );
+        while ( !limbs.empty() && ( limbs.back() == 0 ) )
+            limbs.pop_back();
+
+        if ( width == std::string::npos )
+        {
+            size_t numBits = 0;
+            if ( !limbs.empty() )
+            {
+                numBits = ( limbs.size() - 1 ) * 32;
+                for ( auto top = limbs.back(); top; top >>= 1 )
+                    numBits++;
+            }
+            width = std::max< size_t >( numBits, 1 ) + ( negative ? 1 : 0 );
+        }
+
+        CBitVector retVal( width );
+        for ( size_t ii = 0; ( ii < limbs.size() ) && ( ( ii / 2 ) < retVal.fValue.size() ); ++ii )
+            retVal.fValue[ ii / 2 ] |= static_cast< uint64_t >( limbs[ ii ] ) << ( ( ii % 2 ) * 32 );
+        if ( negative )
+            twosComplement( retVal.fValue );
+        retVal.clearUnused();
+
+        if ( aOK )
+            *aOK = true;
+        return retVal;
+    }
+
+    std::string CBitVector::toBinString() const
+    {
+        std::string retVal( fWidth, '0' );
+        auto && table = byteTable();
+        auto out = retVal.begin();
+        for ( auto pos = fWidth; pos > 0; )
+        {
+            if ( ( pos % 8 ) == 0 )
+            {
+                auto word = ( pos - 8 ) / 64;
+                auto shift = ( pos - 8 ) % 64;
+                if ( ( ( fUnknown[ word ] >> shift ) & 0xFF ) == 0 )
+                {
+                    auto && chars = table[ ( fValue[ word ] >> shift ) & 0xFF ];
+                    out = std::copy( chars.begin(), chars.end(), out );
+                    pos -= 8;
+                    continue;
+                }
+            }
+            --pos;
+            *out++ = "01zx"[ static_cast< uint8_t >( bit( pos ) ) ];
+        }
+        return retVal;
+    }
+
+    std::string CBitVector::toRadixString( unsigned int bitsPerDigit ) const
+    {
+        auto numDigits = ( fWidth + bitsPerDigit - 1 ) / bitsPerDigit;
+        std::string retVal( numDigits, '0' );
+        for ( size_t ii = 0; ii < numDigits; ++ii )
+        {
+            auto pos = ii * bitsPerDigit;
+            auto count = static_cast< unsigned int >( std::min< size_t >( bitsPerDigit, fWidth - pos ) );
+            uint64_t value, unknown;
+            getBits( pos, count, value, unknown );
+            auto & ch = retVal[ numDigits - 1 - ii ];
+            if ( !unknown )
+                ch = "0123456789abcdef"[ value ];
+            else
+                ch = unknownDigit( value, unknown, lowMask( count ) );
+        }
+        return retVal;
+    }
+
+    std::string CBitVector::toOctString() const
+    {
+        return toRadixString( 3 );
+    }
+
+    std::string CBitVector::toHexString() const
+    {
+        return toRadixString( 4 );
+    }
+
+    std::string CBitVector::toDecString( bool isSigned ) const
+    {
+        if ( fWidth == 0 )
+            return std::string();
+
+        if ( !isKnown() )
+        {
+            bool allUnknown = true;
+            for ( size_t ii = 0; allUnknown && ( ii < fUnknown.size() ); ++ii )
+            {
+                auto mask = ( ( ii + 1 ) == fUnknown.size() && ( fWidth % 64 ) ) ? lowMask( static_cast< unsigned int >( fWidth % 64 ) ) : ~uint64_t( 0 );
+                allUnknown = ( fUnknown[ ii ] == mask );
+            }
+            auto anyX = hasX();
+            auto anyZ = hasZ();
+            if ( allUnknown && !anyZ )
+                return "x";
+            if ( allUnknown && !anyX )
+                return "z";
+            return anyX ? "X" : "Z";
+        }
+
+        auto words = fValue;
+        bool negative = isSigned && ( bit( fWidth - 1 ) == EBitValue::eOne );
+        if ( negative )
+        {
+            twosComplement( words );
+            if ( fWidth % 64 )
+                words.back() &= lowMask( static_cast< unsigned int >( fWidth % 64 ) );
+        }
+
+        std::vector< uint32_t > limbs;
+        limbs.reserve( words.size() * 2 );
+        for ( auto && ii : words )
+        {
+            limbs.push_back( static_cast< uint32_t >( ii ) );
+            limbs.push_back( static_cast< uint32_t >( ii >> 32 ) );
+        }
+        while ( !limbs.empty() && ( limbs.back() == 0 ) )
+            limbs.pop_back();
+
+        std::vector< uint32_t > chunks;
+        while ( !limbs.empty() )
+            chunks.push_back( divMod( limbs, 1000000000 ) );
+
+        std::string retVal = negative ? "-" : "";
+        if ( chunks.empty() )
+            return retVal + "0";
+
+        retVal += std::to_string( chunks.back() );
+        for ( auto ii = chunks.rbegin() + 1; ii != chunks.rend(); ++ii )
+        {
+            auto curr = std::to_string( *ii );
+            retVal.append( 9 - curr.length(), '0' );
+            retVal += curr;
+        }
+        return retVal;
+    }
+}
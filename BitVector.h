@@ -0,0 +1,120 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __BITVECTOR_H
+#define __BITVECTOR_H
+
+#include <climits>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace NStringUtils
+{
+    // Arbitrary width 4-state (0/1/X/Z) bit vector
+    // Every bit is stored as two planes, the value plane and the unknown plane, so
+    // 0=(0,0) 1=(1,0) Z=(0,1) X=(1,1).  Bit 0 is the LSB, the strings are MSB first.
+    //
+    // Conversions follow the Verilog rules: a leading x/z digit is extended into any
+    // extra width, a digit that is all x (z) prints as 'x' ('z'), a partially unknown
+    // digit prints as 'X' (or 'Z' when it has no x bits).  Values wider than the
+    // requested width are truncated.
+    class CBitVector
+    {
+    public:
+        enum class EBitValue : uint8_t
+        {
+            eZero = 0,
+            eOne = 1,
+            eZ = 2,
+            eX = 3
+        };
+
+        CBitVector() = default;
+        explicit CBitVector( size_t width, EBitValue fill = EBitValue::eZero );
+
+        template< typename T >
+        static CBitVector fromInt( T value, size_t width = sizeof( T ) * CHAR_BIT )
+        {
+            static_assert( std::is_integral< T >::value && ( sizeof( T ) <= sizeof( uint64_t ) ), "fromInt requires an integral type of 64 bits or less" );
+            bool negative = std::is_signed< T >::value && ( value < 0 );
+            CBitVector retVal( width, negative ? EBitValue::eOne : EBitValue::eZero );
+            if ( !retVal.fValue.empty() )
+            {
+                auto bits = static_cast< uint64_t >( static_cast< typename std::make_unsigned< T >::type >( value ) );
+                if constexpr ( sizeof( T ) < sizeof( uint64_t ) )
+                {
+                    if ( negative )
+                        bits |= ~uint64_t( 0 ) << ( sizeof( T ) * CHAR_BIT );
+                }
+                retVal.fValue[ 0 ] = bits;
+                retVal.clearUnused();
+            }
+            return retVal;
+        }
+
+        // width of npos uses the number of digits in the string, '_' separators are ignored
+        static CBitVector fromBinString( std::string_view str, size_t width = std::string::npos, bool * aOK = nullptr );
+        static CBitVector fromOctString( std::string_view str, size_t width = std::string::npos, bool * aOK = nullptr );
+        static CBitVector fromHexString( std::string_view str, size_t width = std::string::npos, bool * aOK = nullptr );
+        // optional leading sign, a negative value is stored in two's complement
+        // width of npos uses the smallest width that holds the value (plus a sign bit when negative)
+        static CBitVector fromDecString( std::string_view str, size_t width = std::string::npos, bool * aOK = nullptr );
+
+        size_t width() const { return fWidth; }
+        bool empty() const { return fWidth == 0; }
+        void resize( size_t width, EBitValue fill = EBitValue::eZero );
+
+        EBitValue bit( size_t pos ) const;
+        void setBit( size_t pos, EBitValue value );
+
+        bool isKnown() const; // no X or Z bits
+        bool hasX() const;
+        bool hasZ() const;
+        // false when the vector has unknown bits or does not fit
+        bool toUInt64( uint64_t & value ) const;
+
+        std::string toBinString() const;
+        std::string toOctString() const;
+        std::string toHexString() const;
+        std::string toDecString( bool isSigned = false ) const;
+
+        bool operator==( const CBitVector & rhs ) const;
+        bool operator!=( const CBitVector & rhs ) const { return !operator==( rhs ); }
+    private:
+        static CBitVector fromRadixString( std::string_view str, unsigned int bitsPerDigit, size_t width, bool * aOK );
+        static size_t numWords( size_t width ) { return ( width + 63 ) / 64; }
+
+        void orBits( size_t pos, unsigned int count, uint64_t value, uint64_t unknown );
+        void getBits( size_t pos, unsigned int count, uint64_t & value, uint64_t & unknown ) const;
+        std::string toRadixString( unsigned int bitsPerDigit ) const;
+        void clearUnused();
+
+        size_t fWidth{ 0 };
+        std::vector< uint64_t > fValue;
+        std::vector< uint64_t > fUnknown;
+    };
+}
+
+#endif
@@ -0,0 +1,1142 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "ByteRegEx.h"
+
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <utility>
+
+namespace NStringUtils
+{
+    namespace
+    {
+        constexpr uint32_t kInfinite = UINT32_MAX;
+        constexpr uint32_t kMaxRepeat = 1000;
+        constexpr size_t kMaxProgramSize = 20000;
+        constexpr size_t kMaxDFAStates = 512;
+        constexpr size_t kMaxDFAProgramSize = 1000;
+
+        bool isWordChar( std::string_view data, size_t pos )
+        {
+            if ( pos >= data.size() )
+                return false;
+            auto ch = static_cast< unsigned char >( data[ pos ] );
+            return ( ( ch >= 'a' ) && ( ch <= 'z' ) ) || ( ( ch >= 'A' ) && ( ch <= 'Z' ) ) || ( ( ch >= '0' ) && ( ch <= '9' ) ) || ( ch == '_' );
+        }
+
+        int hexValue( char ch )
+        {
+            if ( ( ch >= '0' ) && ( ch <= '9' ) )
+                return ch - '0';
+            if ( ( ch >= 'a' ) && ( ch <= 'f' ) )
+                return ch - 'a' + 10;
+            if ( ( ch >= 'A' ) && ( ch <= 'F' ) )
+                return ch - 'A' + 10;
+            return -1;
+        }
+    }
+
+    // recursive descent over the pattern into a tree, which is then flattened into the program
+    class CByteRegEx::CParser
+    {
+    public:
+        CParser( CByteRegEx & regEx ) :
+            fRegEx( regEx ),
+            fPattern( regEx.fPattern )
+        {
+        }
+
+        bool parse()
+        {
+            auto root = parseAlternation();
+            if ( !fError.empty() )
+                return false;
+            if ( fPos < fPattern.length() ) // only a ')' stops the top level
+                return fail( "unmatched closing parenthesis" );
+
+            fRegEx.fIsLiteral = isLiteral( root );
+            if ( fRegEx.fIsLiteral )
+            {
+                for ( auto && ii : fNodes[ root ].fChildren )
+                    fRegEx.fLiteral.push_back( static_cast< char >( fNodes[ ii ].fValue ) );
+            }
+
+            if ( !emit( root ) )
+                return false;
+            fRegEx.fProgram.push_back( { EOp::eMatch } );
+            return true;
+        }
+
+        const std::string & error() const { return fError; }
+    private:
+        enum class ENodeType
+        {
+            eEmpty,
+            eByte,
+            eClass,
+            eAssert,
+            eConcat,
+            eAlternation,
+            eRepeat
+        };
+        struct SNode
+        {
+            ENodeType fType{ ENodeType::eEmpty };
+            uint32_t fValue{ 0 }; // byte, class index or assertion op
+            std::vector< size_t > fChildren;
+            uint32_t fMin{ 0 };
+            uint32_t fMax{ 0 };
+            bool fGreedy{ true };
+        };
+
+        bool fail( const std::string & msg )
+        {
+            if ( fError.empty() )
+                fError = msg + " at offset " + std::to_string( fPos );
+            return false;
+        }
+        size_t failNode( const std::string & msg )
+        {
+            fail( msg );
+            return 0;
+        }
+        bool atEnd() const { return fPos >= fPattern.length(); }
+        char peek( size_t offset = 0 ) const { return ( ( fPos + offset ) < fPattern.length() ) ? fPattern[ fPos + offset ] : 0; }
+
+        size_t addNode( ENodeType type, uint32_t value = 0 )
+        {
+            SNode node;
+            node.fType = type;
+            node.fValue = value;
+            fNodes.push_back( node );
+            return fNodes.size() - 1;
+        }
+
+        size_t addClass( SClass set, bool negate )
+        {
+            if ( fRegEx.fNoCase )
+            {
+                for ( int ii = 'a'; ii <= 'z'; ++ii )
+                {
+                    auto upper = ii - 'a' + 'A';
+                    if ( set.contains( static_cast< unsigned char >( ii ) ) || set.contains( static_cast< unsigned char >( upper ) ) )
+                    {
+                        addByte( set, ii );
+                        addByte( set, upper );
+                    }
+                }
+            }
+            if ( negate )
+            {
+                for ( auto && ii : set.fBits )
+                    ii = ~ii;
+            }
+            fRegEx.fClasses.push_back( set );
+            return addNode( ENodeType::eClass, static_cast< uint32_t >( fRegEx.fClasses.size() - 1 ) );
+        }
+
+        static void addByte( SClass & set, int ch ) { set.fBits[ ch >> 6 ] |= ( uint64_t( 1 ) << ( ch & 63 ) ); }
+        static void addRange( SClass & set, int first, int last )
+        {
+            for ( int ii = first; ii <= last; ++ii )
+                addByte( set, ii );
+        }
+
+        // \d \w \s and their negations, false for any other letter
+        static bool addEscapeClass( SClass & set, char ch )
+        {
+            SClass tmp;
+            switch ( ch )
+            {
+                case 'd':
+                case 'D':
+                    addRange( tmp, '0', '9' );
+                    break;
+                case 'w':
+                case 'W':
+                    addRange( tmp, '0', '9' );
+                    addRange( tmp, 'a', 'z' );
+                    addRange( tmp, 'A', 'Z' );
+                    addByte( tmp, '_' );
+                    break;
+                case 's':
+                case 'S':
+                    addRange( tmp, '\t', '\r' );
+                    addByte( tmp, ' ' );
+                    break;
+                default:
+                    return false;
+            }
+            bool negate = ( ch >= 'A' ) && ( ch <= 'Z' );
+            for ( size_t ii = 0; ii < 4; ++ii )
+                set.fBits[ ii ] |= negate ? ~tmp.fBits[ ii ] : tmp.fBits[ ii ];
+            return true;
+        }
+
+        // the byte for a single character escape (the character after the '\'), -1 when it is not one
+        int escapedByte( bool inClass )
+        {
+            auto ch = peek();
+            switch ( ch )
+            {
+                case 'n': fPos++; return '\n';
+                case 't': fPos++; return '\t';
+                case 'r': fPos++; return '\r';
+                case 'f': fPos++; return '\f';
+                case 'a': fPos++; return '\a';
+                case 'e': fPos++; return 0x1B;
+                case 'b':
+                    if ( !inClass )
+                        return -1;
+                    fPos++;
+                    return '\b';
+                case 'x':
+                {
+                    auto hi = hexValue( peek( 1 ) );
+                    if ( hi < 0 )
+                        return -1; // \x{...} and \x alone
+                    fPos += 2;
+                    auto lo = hexValue( peek() );
+                    if ( lo < 0 )
+                        return hi;
+                    fPos++;
+                    auto value = ( hi << 4 ) | lo;
+                    return ( value < 0x80 ) ? value : -1; // a code point in UTF mode
+                }
+                default:
+                    break;
+            }
+            auto uch = static_cast< unsigned char >( ch );
+            if ( ( uch < 0x80 ) && ( uch != 0 ) && !std::isalnum( uch ) )
+            {
+                fPos++;
+                return uch;
+            }
+            return -1;
+        }
+
+        size_t parseAlternation()
+        {
+            auto first = parseConcat();
+            if ( ( peek() != '|' ) || !fError.empty() )
+                return first;
+
+            auto retVal = addNode( ENodeType::eAlternation );
+            fNodes[ retVal ].fChildren.push_back( first );
+            while ( fError.empty() && ( peek() == '|' ) )
+            {
+                fPos++;
+                auto next = parseConcat();
+                fNodes[ retVal ].fChildren.push_back( next );
+            }
+            return retVal;
+        }
+
+        size_t parseConcat()
+        {
+            auto retVal = addNode( ENodeType::eConcat );
+            while ( fError.empty() && !atEnd() && ( peek() != '|' ) && ( peek() != ')' ) )
+            {
+                auto next = parseRepeat();
+                fNodes[ retVal ].fChildren.push_back( next );
+            }
+            return retVal;
+        }
+
+        // *, +, ?, {n}, {n,} or {n,m} at the current position
+        bool parseQuantifier( uint32_t & min, uint32_t & max, bool consume )
+        {
+            auto pos = fPos;
+            auto ch = peek();
+            if ( ch == '*' )
+            {
+                min = 0;
+                max = kInfinite;
+                pos++;
+            }
+            else if ( ch == '+' )
+            {
+                min = 1;
+                max = kInfinite;
+                pos++;
+            }
+            else if ( ch == '?' )
+            {
+                min = 0;
+                max = 1;
+                pos++;
+            }
+            else if ( ch == '{' )
+            {
+                // anything that is not a well formed quantifier is a literal '{'
+                auto readNumber = [ & ]( uint32_t & value )
+                {
+                    auto startPos = pos;
+                    uint64_t tmp = 0;
+                    for ( ; ( pos < fPattern.length() ) && std::isdigit( static_cast< unsigned char >( fPattern[ pos ] ) ); ++pos )
+                        tmp = std::min< uint64_t >( tmp * 10 + ( fPattern[ pos ] - '0' ), kMaxRepeat + 1 );
+                    value = static_cast< uint32_t >( tmp );
+                    return pos != startPos;
+                };
+
+                pos++;
+                if ( !readNumber( min ) )
+                    return false;
+                max = min;
+                if ( ( pos < fPattern.length() ) && ( fPattern[ pos ] == ',' ) )
+                {
+                    pos++;
+                    if ( !readNumber( max ) )
+                        max = kInfinite;
+                }
+                if ( ( pos >= fPattern.length() ) || ( fPattern[ pos ] != '}' ) )
+                    return false;
+                pos++;
+            }
+            else
+                return false;
+
+            if ( consume )
+                fPos = pos;
+            return true;
+        }
+
+        size_t parseRepeat()
+        {
+            auto atom = parseAtom();
+            if ( !fError.empty() )
+                return atom;
+
+            uint32_t min = 0;
+            uint32_t max = 0;
+            if ( !parseQuantifier( min, max, true ) )
+                return atom;
+
+            if ( fNodes[ atom ].fType == ENodeType::eAssert )
+                return failNode( "unsupported quantified assertion" );
+            if ( min > max )
+                return failNode( "numbers out of order in {} quantifier" );
+            if ( max == 0 ) // PCRE still lets the skipped item affect its start of match optimizations
+                return failNode( "unsupported zero repeat count" );
+            if ( ( min > kMaxRepeat ) || ( ( max != kInfinite ) && ( max > kMaxRepeat ) ) )
+                return failNode( "unsupported repeat count" );
+
+            bool greedy = true;
+            if ( peek() == '?' )
+            {
+                greedy = false;
+                fPos++;
+            }
+            else if ( peek() == '+' )
+                return failNode( "unsupported possessive quantifier" );
+
+            uint32_t dummyMin, dummyMax;
+            if ( parseQuantifier( dummyMin, dummyMax, false ) )
+                return failNode( "unsupported nested quantifier" );
+
+            auto retVal = addNode( ENodeType::eRepeat );
+            fNodes[ retVal ].fChildren.push_back( atom );
+            fNodes[ retVal ].fMin = min;
+            fNodes[ retVal ].fMax = max;
+            fNodes[ retVal ].fGreedy = greedy;
+            return retVal;
+        }
+
+        size_t parseAtom()
+        {
+            auto ch = peek();
+            switch ( ch )
+            {
+                case '(':
+                {
+                    fPos++;
+                    if ( peek() == '?' )
+                    {
+                        if ( peek( 1 ) != ':' )
+                            return failNode( "unsupported group type" );
+                        fPos += 2;
+                    }
+                    auto retVal = parseAlternation();
+                    if ( !fError.empty() )
+                        return retVal;
+                    if ( peek() != ')' )
+                        return failNode( "missing closing parenthesis" );
+                    fPos++;
+                    return retVal;
+                }
+                case '[':
+                    fPos++;
+                    return parseClass();
+                case '.':
+                {
+                    fPos++;
+                    SClass set;
+                    addRange( set, 0, 255 );
+                    set.fBits[ 0 ] &= ~( uint64_t( 1 ) << '\n' );
+                    return addClass( set, false );
+                }
+                case '^':
+                    fPos++;
+                    return addNode( ENodeType::eAssert, static_cast< uint32_t >( EOp::eBegin ) );
+                case '$':
+                    fPos++;
+                    return addNode( ENodeType::eAssert, static_cast< uint32_t >( EOp::eEndOrNewline ) );
+                case '*':
+                case '+':
+                case '?':
+                    return failNode( "quantifier does not follow a repeatable item" );
+                case '{':
+                {
+                    uint32_t min, max;
+                    if ( parseQuantifier( min, max, false ) )
+                        return failNode( "quantifier does not follow a repeatable item" );
+                    break;
+                }
+                case '\\':
+                    fPos++;
+                    return parseEscape();
+                default:
+                    break;
+            }
+
+            if ( static_cast< unsigned char >( ch ) >= 0x80 )
+                return failNode( "unsupported non-ASCII character" );
+            fPos++;
+            return addNode( ENodeType::eByte, static_cast< unsigned char >( ch ) );
+        }
+
+        size_t parseEscape()
+        {
+            if ( atEnd() )
+                return failNode( "\\ at end of pattern" );
+
+            auto ch = peek();
+            EOp op = EOp::eMatch;
+            switch ( ch )
+            {
+                case 'A': op = EOp::eBegin; break;
+                case 'z': op = EOp::eEnd; break;
+                case 'Z': op = EOp::eEndOrNewline; break;
+                case 'b': op = EOp::eWordBoundary; break;
+                case 'B': op = EOp::eNotWordBoundary; break;
+                default:
+                    break;
+            }
+            if ( op != EOp::eMatch )
+            {
+                fPos++;
+                return addNode( ENodeType::eAssert, static_cast< uint32_t >( op ) );
+            }
+
+            SClass set;
+            if ( addEscapeClass( set, ch ) )
+            {
+                fPos++;
+                return addClass( set, false );
+            }
+
+            auto value = escapedByte( false );
+            if ( value < 0 )
+                return failNode( std::string( "unsupported escape sequence \\" ) + ch );
+            return addNode( ENodeType::eByte, static_cast< uint32_t >( value ) );
+        }
+
+        size_t parseClass()
+        {
+            SClass set;
+            bool negate = false;
+            if ( peek() == '^' )
+            {
+                negate = true;
+                fPos++;
+            }
+
+            bool first = true;
+            while ( true )
+            {
+                if ( atEnd() )
+                    return failNode( "missing terminating ] for character class" );
+
+                auto ch = peek();
+                if ( ( ch == ']' ) && !first )
+                {
+                    fPos++;
+                    break;
+                }
+                first = false;
+                if ( ( ch == '[' ) && ( ( peek( 1 ) == ':' ) || ( peek( 1 ) == '.' ) || ( peek( 1 ) == '=' ) ) )
+                    return failNode( "unsupported POSIX class" );
+
+                int low = parseClassChar( set );
+                if ( !fError.empty() )
+                    return 0;
+                if ( low < 0 ) // \d and friends, already added
+                {
+                    if ( ( peek() == '-' ) && ( peek( 1 ) != ']' ) )
+                        return failNode( "invalid range in character class" );
+                    continue;
+                }
+
+                if ( ( peek() == '-' ) && ( peek( 1 ) != ']' ) && ( peek( 1 ) != 0 ) )
+                {
+                    fPos++;
+                    int high = parseClassChar( set );
+                    if ( !fError.empty() )
+                        return 0;
+                    if ( high < 0 )
+                        return failNode( "unsupported class escape in a range" );
+                    if ( high < low )
+                        return failNode( "range out of order in character class" );
+                    addRange( set, low, high );
+                }
+                else
+                    addByte( set, low );
+            }
+            return addClass( set, negate );
+        }
+
+        // one character of a class, -1 when it was a class escape that has been added to set
+        int parseClassChar( SClass & set )
+        {
+            auto ch = peek();
+            if ( static_cast< unsigned char >( ch ) >= 0x80 )
+            {
+                fail( "unsupported non-ASCII character" );
+                return 0;
+            }
+            fPos++;
+            if ( ch != '\\' )
+                return static_cast< unsigned char >( ch );
+
+            if ( atEnd() )
+            {
+                fail( "\\ at end of pattern" );
+                return 0;
+            }
+            if ( addEscapeClass( set, peek() ) )
+            {
+                fPos++;
+                return -1;
+            }
+            auto value = escapedByte( true );
+            if ( value < 0 )
+            {
+                fail( std::string( "unsupported escape sequence \\" ) + peek() );
+                return 0;
+            }
+            return value;
+        }
+
+        // a non empty sequence of bytes, without any operators
+        bool isLiteral( size_t node ) const
+        {
+            if ( ( fNodes[ node ].fType != ENodeType::eConcat ) || fNodes[ node ].fChildren.empty() )
+                return false;
+            for ( auto && ii : fNodes[ node ].fChildren )
+            {
+                if ( fNodes[ ii ].fType != ENodeType::eByte )
+                    return false;
+            }
+            return true;
+        }
+
+        bool nullable( size_t node ) const
+        {
+            switch ( fNodes[ node ].fType )
+            {
+                case ENodeType::eByte:
+                case ENodeType::eClass:
+                    return false;
+                case ENodeType::eConcat:
+                    for ( auto && ii : fNodes[ node ].fChildren )
+                    {
+                        if ( !nullable( ii ) )
+                            return false;
+                    }
+                    return true;
+                case ENodeType::eAlternation:
+                    for ( auto && ii : fNodes[ node ].fChildren )
+                    {
+                        if ( nullable( ii ) )
+                            return true;
+                    }
+                    return false;
+                case ENodeType::eRepeat:
+                    return ( fNodes[ node ].fMin == 0 ) || nullable( fNodes[ node ].fChildren.front() );
+                default:
+                    return true;
+            }
+        }
+
+        uint32_t pc() const { return static_cast< uint32_t >( fRegEx.fProgram.size() ); }
+        bool add( EOp op, uint32_t x = 0, uint32_t y = 0 )
+        {
+            if ( fRegEx.fProgram.size() >= kMaxProgramSize )
+                return fail( "pattern too large" );
+            fRegEx.fProgram.push_back( { op, x, y } );
+            return true;
+        }
+
+        bool emit( size_t idx )
+        {
+            auto & node = fNodes[ idx ];
+            switch ( node.fType )
+            {
+                case ENodeType::eEmpty:
+                    return true;
+                case ENodeType::eByte:
+                {
+                    auto ch = static_cast< int >( node.fValue );
+                    if ( fRegEx.fNoCase && std::isalpha( ch ) )
+                    {
+                        auto & cls = fCaseClasses[ std::tolower( ch ) - 'a' ];
+                        if ( cls == kInfinite )
+                        {
+                            SClass set;
+                            addByte( set, ch );
+                            cls = fNodes[ addClass( set, false ) ].fValue;
+                        }
+                        return add( EOp::eClass, cls );
+                    }
+                    return add( EOp::eByte, node.fValue );
+                }
+                case ENodeType::eClass:
+                    return add( EOp::eClass, node.fValue );
+                case ENodeType::eAssert:
+                    return add( static_cast< EOp >( node.fValue ) );
+                case ENodeType::eConcat:
+                {
+                    auto children = node.fChildren; // emit may grow fNodes
+                    for ( auto && ii : children )
+                    {
+                        if ( !emit( ii ) )
+                            return false;
+                    }
+                    return true;
+                }
+                case ENodeType::eAlternation:
+                {
+                    // split L1, next; L1: a; jmp end; next: split L2, next2; ... last
+                    auto children = node.fChildren;
+                    std::vector< uint32_t > jumps;
+                    for ( size_t ii = 0; ii < children.size(); ++ii )
+                    {
+                        if ( ( ii + 1 ) == children.size() )
+                        {
+                            if ( !emit( children[ ii ] ) )
+                                return false;
+                            break;
+                        }
+                        auto split = pc();
+                        if ( !add( EOp::eSplit, split + 1 ) || !emit( children[ ii ] ) )
+                            return false;
+                        jumps.push_back( pc() );
+                        if ( !add( EOp::eJmp ) )
+                            return false;
+                        fRegEx.fProgram[ split ].fY = pc();
+                    }
+                    for ( auto && ii : jumps )
+                        fRegEx.fProgram[ ii ].fX = pc();
+                    return true;
+                }
+                case ENodeType::eRepeat:
+                {
+                    auto child = node.fChildren.front();
+                    auto min = node.fMin;
+                    auto max = node.fMax;
+                    auto greedy = node.fGreedy;
+                    auto setSplit = [ this, greedy ]( uint32_t split, uint32_t body, uint32_t out )
+                    {
+                        fRegEx.fProgram[ split ].fX = greedy ? body : out;
+                        fRegEx.fProgram[ split ].fY = greedy ? out : body;
+                    };
+
+                    if ( max == kInfinite )
+                    {
+                        // PCRE stops such a loop after an iteration that matched nothing, a rule the VM
+                        // can not follow without per thread state
+                        if ( nullable( child ) )
+                            return fail( "unsupported unbounded repeat of an item that can match an empty string" );
+                        if ( min == 0 )
+                        {
+                            // L: split body, out; body; jmp L; out:
+                            auto split = pc();
+                            if ( !add( EOp::eSplit ) || !emit( child ) || !add( EOp::eJmp, split ) )
+                                return false;
+                            setSplit( split, split + 1, pc() );
+                            return true;
+                        }
+                        // min - 1 copies, then L: body; split L, out
+                        for ( uint32_t ii = 1; ii < min; ++ii )
+                        {
+                            if ( !emit( child ) )
+                                return false;
+                        }
+                        auto body = pc();
+                        if ( !emit( child ) )
+                            return false;
+                        auto split = pc();
+                        if ( !add( EOp::eSplit ) )
+                            return false;
+                        setSplit( split, body, pc() );
+                        return true;
+                    }
+
+                    for ( uint32_t ii = 0; ii < min; ++ii )
+                    {
+                        if ( !emit( child ) )
+                            return false;
+                    }
+                    // nested optional copies, (x(x(x)?)?)?, every split skips to the end
+                    std::vector< uint32_t > splits;
+                    for ( auto ii = min; ii < max; ++ii )
+                    {
+                        splits.push_back( pc() );
+                        if ( !add( EOp::eSplit ) || !emit( child ) )
+                            return false;
+                    }
+                    for ( auto && ii : splits )
+                        setSplit( ii, ii + 1, pc() );
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        CByteRegEx & fRegEx;
+        const std::string & fPattern;
+        size_t fPos{ 0 };
+        std::string fError;
+        std::vector< SNode > fNodes;
+        uint32_t fCaseClasses[ 26 ]{ kInfinite, kInfinite, kInfinite, kInfinite, kInfinite, kInfinite, kInfinite, kInfinite, kInfinite, kInfinite, kInfinite, kInfinite, kInfinite,
+                                     kInfinite, kInfinite, kInfinite, kInfinite, kInfinite, kInfinite, kInfinite, kInfinite, kInfinite, kInfinite, kInfinite, kInfinite, kInfinite };
+    };
+
+    // the threads of one step, in priority order, at most one per program counter
+    struct CByteRegEx::SThreads
+    {
+        SThreads( size_t programSize ) :
+            fMark( programSize, 0 )
+        {
+            fThreads.reserve( programSize );
+            fStack.reserve( programSize );
+        }
+
+        void clear()
+        {
+            fThreads.clear();
+            if ( ++fGeneration == 0 )
+            {
+                std::fill( fMark.begin(), fMark.end(), 0 );
+                fGeneration = 1;
+            }
+        }
+        bool empty() const { return fThreads.empty(); }
+        void swap( SThreads & rhs )
+        {
+            std::swap( fMark, rhs.fMark );
+            std::swap( fThreads, rhs.fThreads );
+            std::swap( fGeneration, rhs.fGeneration );
+        }
+
+        std::vector< uint32_t > fMark; // == fGeneration when the pc has been visited this step
+        uint32_t fGeneration{ 0 };
+        std::vector< std::pair< uint32_t, size_t > > fThreads; // pc, start of the match
+        std::vector< uint32_t > fStack;
+    };
+
+    CByteRegEx::CByteRegEx( const std::string & pattern, bool nocase ) :
+        fPattern( pattern ),
+        fNoCase( nocase )
+    {
+        CParser parser( *this );
+        if ( !parser.parse() )
+        {
+            fErrorString = parser.error();
+            fProgram.clear();
+            fClasses.clear();
+            fIsLiteral = false;
+            fLiteral.clear();
+            return;
+        }
+
+        // the bytes that can start a match, assertions only narrow the set
+        std::vector< bool > seen( fProgram.size(), false );
+        std::vector< uint32_t > stack{ 0 };
+        fAnyFirst = false;
+        while ( !stack.empty() && !fAnyFirst )
+        {
+            auto pc = stack.back();
+            stack.pop_back();
+            if ( seen[ pc ] )
+                continue;
+            seen[ pc ] = true;
+
+            auto & inst = fProgram[ pc ];
+            switch ( inst.fOp )
+            {
+                case EOp::eByte:
+                    fFirstBytes.add( static_cast< char >( inst.fX ) );
+                    break;
+                case EOp::eClass:
+                    for ( int ii = 0; ii < 256; ++ii )
+                    {
+                        if ( fClasses[ inst.fX ].contains( static_cast< unsigned char >( ii ) ) )
+                            fFirstBytes.add( static_cast< char >( ii ) );
+                    }
+                    break;
+                case EOp::eSplit:
+                    stack.push_back( inst.fY );
+                    stack.push_back( inst.fX );
+                    break;
+                case EOp::eJmp:
+                    stack.push_back( inst.fX );
+                    break;
+                case EOp::eMatch:
+                    fAnyFirst = true;
+                    break;
+                default:
+                    stack.push_back( pc + 1 );
+                    break;
+            }
+        }
+        if ( fFirstBytes.size() == 256 )
+            fAnyFirst = true;
+
+        buildDFA();
+    }
+
+    void CByteRegEx::buildDFA()
+    {
+        if ( fProgram.size() > kMaxDFAProgramSize )
+            return;
+        for ( auto && ii : fProgram )
+        {
+            if ( ( ii.fOp != EOp::eByte ) && ( ii.fOp != EOp::eClass ) && ( ii.fOp != EOp::eSplit ) && ( ii.fOp != EOp::eJmp ) && ( ii.fOp != EOp::eMatch ) )
+                return;
+        }
+
+        // bytes that every instruction treats the same way share a class
+        std::vector< uint32_t > consumers;
+        for ( uint32_t pc = 0; pc < fProgram.size(); ++pc )
+        {
+            if ( ( fProgram[ pc ].fOp == EOp::eByte ) || ( fProgram[ pc ].fOp == EOp::eClass ) )
+                consumers.push_back( pc );
+        }
+        std::map< std::vector< bool >, uint8_t > signatures;
+        uint8_t representative[ 256 ];
+        for ( int ch = 0; ch < 256; ++ch )
+        {
+            std::vector< bool > signature;
+            signature.reserve( consumers.size() );
+            for ( auto && pc : consumers )
+                signature.push_back( matches( fProgram[ pc ], static_cast< unsigned char >( ch ) ) );
+            auto pos = signatures.emplace( signature, static_cast< uint8_t >( signatures.size() ) ).first;
+            fByteClass[ ch ] = pos->second;
+            representative[ pos->second ] = static_cast< uint8_t >( ch );
+        }
+        fNumByteClasses = static_cast< uint32_t >( signatures.size() );
+
+        // subset construction, a state is the sorted set of consuming (or matching) pcs after the closure
+        std::vector< bool > seen( fProgram.size() );
+        auto closure = [ & ]( const std::vector< uint32_t > & pcs )
+        {
+            std::fill( seen.begin(), seen.end(), false );
+            std::vector< uint32_t > retVal;
+            std::vector< uint32_t > stack( pcs.rbegin(), pcs.rend() );
+            while ( !stack.empty() )
+            {
+                auto pc = stack.back();
+                stack.pop_back();
+                if ( seen[ pc ] )
+                    continue;
+                seen[ pc ] = true;
+                auto & inst = fProgram[ pc ];
+                if ( inst.fOp == EOp::eJmp )
+                    stack.push_back( inst.fX );
+                else if ( inst.fOp == EOp::eSplit )
+                {
+                    stack.push_back( inst.fY );
+                    stack.push_back( inst.fX );
+                }
+                else
+                    retVal.push_back( pc );
+            }
+            std::sort( retVal.begin(), retVal.end() );
+            return retVal;
+        };
+
+        std::map< std::vector< uint32_t >, uint32_t > stateIDs;
+        std::vector< std::vector< uint32_t > > states{ closure( { 0 } ) };
+        stateIDs[ states.front() ] = 0;
+        for ( size_t state = 0; state < states.size(); ++state )
+        {
+            fDFAAccept.push_back( std::any_of( states[ state ].begin(), states[ state ].end(), [ this ]( uint32_t pc ) { return fProgram[ pc ].fOp == EOp::eMatch; } ) );
+            for ( uint32_t cls = 0; cls < fNumByteClasses; ++cls )
+            {
+                std::vector< uint32_t > next;
+                for ( auto && pc : states[ state ] )
+                {
+                    if ( ( fProgram[ pc ].fOp != EOp::eMatch ) && matches( fProgram[ pc ], representative[ cls ] ) )
+                        next.push_back( pc + 1 );
+                }
+                if ( next.empty() )
+                {
+                    fDFA.push_back( kDeadState );
+                    continue;
+                }
+                next = closure( next );
+                auto pos = stateIDs.find( next );
+                if ( pos == stateIDs.end() )
+                {
+                    if ( states.size() >= kMaxDFAStates )
+                    {
+                        fDFA.clear();
+                        fDFAAccept.clear();
+                        return;
+                    }
+                    pos = stateIDs.emplace( next, static_cast< uint32_t >( states.size() ) ).first;
+                    states.push_back( next );
+                }
+                fDFA.push_back( pos->second );
+            }
+        }
+    }
+
+    void CByteRegEx::addThread( SThreads & threads, uint32_t pc, size_t start, std::string_view data, size_t pos ) const
+    {
+        // depth first, the preferred branch of a split is pushed last so it is explored first
+        auto & stack = threads.fStack;
+        stack.push_back( pc );
+        while ( !stack.empty() )
+        {
+            pc = stack.back();
+            stack.pop_back();
+            if ( threads.fMark[ pc ] == threads.fGeneration )
+                continue;
+            threads.fMark[ pc ] = threads.fGeneration;
+
+            auto & inst = fProgram[ pc ];
+            switch ( inst.fOp )
+            {
+                case EOp::eJmp:
+                    stack.push_back( inst.fX );
+                    break;
+                case EOp::eSplit:
+                    stack.push_back( inst.fY );
+                    stack.push_back( inst.fX );
+                    break;
+                case EOp::eBegin:
+                    if ( pos == 0 )
+                        stack.push_back( pc + 1 );
+                    break;
+                case EOp::eEnd:
+                    if ( pos == data.length() )
+                        stack.push_back( pc + 1 );
+                    break;
+                case EOp::eEndOrNewline:
+                    if ( ( pos == data.length() ) || ( ( ( pos + 1 ) == data.length() ) && ( data[ pos ] == '\n' ) ) )
+                        stack.push_back( pc + 1 );
+                    break;
+                case EOp::eWordBoundary:
+                case EOp::eNotWordBoundary:
+                {
+                    bool boundary = ( pos != 0 && isWordChar( data, pos - 1 ) ) != isWordChar( data, pos );
+                    if ( boundary == ( inst.fOp == EOp::eWordBoundary ) )
+                        stack.push_back( pc + 1 );
+                    break;
+                }
+                default:
+                    threads.fThreads.emplace_back( pc, start );
+                    break;
+            }
+        }
+    }
+
+    size_t CByteRegEx::nextCandidate( std::string_view data, size_t pos ) const
+    {
+        return NSIMDUtils::findFirstOf( data.data(), data.length(), pos, fFirstBytes );
+    }
+
+    bool CByteRegEx::search( SThreads & curr, SThreads & next, std::string_view data, size_t from, size_t & start, size_t & end, bool anchored, bool notEmptyAtStart, bool atEnd ) const
+    {
+        if ( from > data.length() )
+            return false;
+
+        if ( fIsLiteral && !atEnd )
+        {
+            size_t pos = std::string::npos;
+            if ( anchored )
+            {
+                if ( ( data.length() - from ) >= fLiteral.length()
+                     && ( fNoCase ? NSIMDUtils::equalsNoCase( data.data() + from, fLiteral.length(), fLiteral.data(), fLiteral.length() ) : ( data.compare( from, fLiteral.length(), fLiteral ) == 0 ) ) )
+                    pos = from;
+            }
+            else if ( fNoCase )
+            {
+                pos = NSIMDUtils::findNoCase( data.data() + from, data.length() - from, fLiteral.data(), fLiteral.length() );
+                if ( pos != std::string::npos )
+                    pos += from;
+            }
+            else
+                pos = data.find( fLiteral, from );
+
+            if ( pos == std::string::npos )
+                return false;
+            start = pos;
+            end = pos + fLiteral.length();
+            return true;
+        }
+
+        bool matched = false;
+        curr.clear();
+        for ( size_t pos = from; ; ++pos )
+        {
+            if ( !matched && ( !anchored || ( pos == from ) ) )
+            {
+                if ( curr.empty() )
+                {
+                    curr.clear(); // forget the pcs marked by closures that died on an assertion
+                    if ( !anchored && !fAnyFirst )
+                    {
+                        pos = nextCandidate( data, pos );
+                        if ( pos == std::string::npos )
+                            break;
+                    }
+                }
+                addThread( curr, 0, pos, data, pos );
+            }
+            if ( curr.empty() )
+            {
+                if ( matched || anchored || ( pos >= data.length() ) )
+                    break;
+                continue;
+            }
+
+            next.clear();
+            for ( auto && thread : curr.fThreads )
+            {
+                auto & inst = fProgram[ thread.first ];
+                if ( inst.fOp == EOp::eMatch )
+                {
+                    if ( notEmptyAtStart && ( thread.second == from ) && ( pos == from ) )
+                        continue;
+                    if ( atEnd && ( pos != data.length() ) )
+                        continue;
+                    // the lower priority threads are cut off, the higher priority ones may still find a (longer) match
+                    matched = true;
+                    start = thread.second;
+                    end = pos;
+                    break;
+                }
+                if ( ( pos < data.length() ) && matches( inst, static_cast< unsigned char >( data[ pos ] ) ) )
+                    addThread( next, thread.first + 1, thread.second, data, pos + 1 );
+            }
+            curr.swap( next );
+            if ( pos >= data.length() )
+                break;
+        }
+        return matched;
+    }
+
+    bool CByteRegEx::search( std::string_view data, size_t from, size_t & start, size_t & end, bool anchored, bool notEmptyAtStart ) const
+    {
+        if ( !isValid() )
+            return false;
+        SThreads curr( fProgram.size() );
+        SThreads next( fProgram.size() );
+        return search( curr, next, data, from, start, end, anchored, notEmptyAtStart, false );
+    }
+
+    bool CByteRegEx::hasMatch( std::string_view data ) const
+    {
+        size_t start, end;
+        return search( data, 0, start, end );
+    }
+
+    bool CByteRegEx::exactMatch( std::string_view data ) const
+    {
+        if ( !isValid() )
+            return false;
+        if ( fIsLiteral )
+            return fNoCase ? NSIMDUtils::equalsNoCase( data.data(), data.length(), fLiteral.data(), fLiteral.length() ) : ( data == fLiteral );
+        if ( !fDFA.empty() )
+        {
+            uint32_t state = 0;
+            for ( auto && ch : data )
+            {
+                state = fDFA[ state * fNumByteClasses + fByteClass[ static_cast< unsigned char >( ch ) ] ];
+                if ( state == kDeadState )
+                    return false;
+            }
+            return fDFAAccept[ state ];
+        }
+
+        SThreads curr( fProgram.size() );
+        SThreads next( fProgram.size() );
+        size_t start, end;
+        return search( curr, next, data, 0, start, end, true, false, true );
+    }
+
+    std::list< std::string > CByteRegEx::split( std::string_view data, bool skipEmpty ) const
+    {
+        if ( !isValid() )
+            return {};
+
+        SThreads curr( fProgram.size() );
+        SThreads next( fProgram.size() );
+
+        // QRegularExpressionMatchIterator rules, after an empty match the next match may not be empty
+        // at the same position, failing that the search moves on one character
+        std::list< std::string > retVal;
+        size_t pieceStart = 0;
+        size_t offset = 0;
+        bool prevEmpty = false;
+        while ( true )
+        {
+            size_t start, end;
+            bool found = false;
+            if ( prevEmpty )
+            {
+                found = search( curr, next, data, offset, start, end, true, true, false );
+                if ( !found && ( offset < data.length() ) )
+                    found = search( curr, next, data, offset + 1, start, end, false, false, false );
+            }
+            else
+                found = search( curr, next, data, offset, start, end, false, false, false );
+            if ( !found )
+                break;
+
+            if ( !skipEmpty || ( start != pieceStart ) )
+                retVal.emplace_back( data.substr( pieceStart, start - pieceStart ) );
+            pieceStart = end;
+            offset = end;
+            prevEmpty = ( start == end );
+        }
+        if ( !skipEmpty || ( pieceStart != data.length() ) )
+            retVal.emplace_back( data.substr( pieceStart ) );
+        return retVal;
+    }
+}
@@ -0,0 +1,129 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef __BYTEREGEX_H
+#define __BYTEREGEX_H
+
+#include "SIMDUtils.h"
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NStringUtils
+{
+    // Regular expression matcher that works directly on UTF-8/Latin-1 bytes, so std::string
+    // data does not have to be converted to a QString (and the results back) to be matched.
+    //
+    // Only the simple subset of the PCRE syntax is supported: literals, ., classes (with ranges
+    // and \d \w \s \D \W \S), groups, (?:), |, the greedy and lazy * + ? {n,m} quantifiers and the
+    // ^ $ \A \z \Z \b \B assertions.  Anything else (back references, look arounds, inline options,
+    // possessive quantifiers, unicode properties, non-ASCII pattern bytes) leaves the expression
+    // invalid so the caller can use QRegularExpression instead.
+    //
+    // Matching is a Pike VM over the compiled program, threads are kept in PCRE priority order so the
+    // leftmost match found is the one PCRE reports, and the run time is linear in the text.  Each
+    // byte is a character, which only agrees with the UTF-8 (code point) semantics of QRegularExpression
+    // for ASCII text.  Case insensitive matching folds A-Z only.
+    class CByteRegEx
+    {
+    public:
+        CByteRegEx( const std::string & pattern, bool nocase = false );
+
+        bool isValid() const { return !fProgram.empty(); }
+        const std::string & errorString() const { return fErrorString; }
+        const std::string & pattern() const { return fPattern; }
+        bool nocase() const { return fNoCase; }
+
+        // first match starting at or after from, start and end are byte offsets into data
+        // anchored only allows matches starting at from, notEmptyAtStart rejects an empty match at from
+        bool search( std::string_view data, size_t from, size_t & start, size_t & end, bool anchored = false, bool notEmptyAtStart = false ) const;
+        bool hasMatch( std::string_view data ) const;
+        // the whole of data must match
+        bool exactMatch( std::string_view data ) const;
+        // same pieces as QString::split( QRegularExpression ), including the handling of empty matches
+        std::list< std::string > split( std::string_view data, bool skipEmpty = false ) const;
+    private:
+        enum class EOp : uint8_t
+        {
+            eByte,
+            eClass,
+            eSplit, // prefers fX over fY
+            eJmp,
+            eBegin, // \A ^
+            eEnd, // \z
+            eEndOrNewline, // $ \Z
+            eWordBoundary,
+            eNotWordBoundary,
+            eMatch
+        };
+        struct SInst
+        {
+            EOp fOp;
+            uint32_t fX{ 0 };
+            uint32_t fY{ 0 };
+        };
+        struct SClass
+        {
+            bool contains( unsigned char ch ) const { return ( fBits[ ch >> 6 ] >> ( ch & 63 ) ) & 1; }
+            uint64_t fBits[ 4 ]{ 0, 0, 0, 0 };
+        };
+        class CParser;
+        friend class CParser;
+        struct SThreads;
+
+        bool matches( const SInst & inst, unsigned char ch ) const { return ( inst.fOp == EOp::eByte ) ? ( inst.fX == ch ) : fClasses[ inst.fX ].contains( ch ); }
+        void addThread( SThreads & threads, uint32_t pc, size_t start, std::string_view data, size_t pos ) const;
+        // atEnd only accepts matches that end at the end of data
+        bool search( SThreads & curr, SThreads & next, std::string_view data, size_t from, size_t & start, size_t & end, bool anchored, bool notEmptyAtStart, bool atEnd ) const;
+        // next position at or after pos that can start a match
+        size_t nextCandidate( std::string_view data, size_t pos ) const;
+        // the DFA exactMatch uses, only for programs without assertions and with few enough states
+        void buildDFA();
+
+        std::string fPattern;
+        bool fNoCase{ false };
+        std::string fErrorString;
+
+        std::vector< SInst > fProgram;
+        std::vector< SClass > fClasses;
+
+        // every match starts with one of these bytes, unless fAnyFirst
+        bool fAnyFirst{ true };
+        NSIMDUtils::CByteSet fFirstBytes;
+        // exactMatch only needs a yes or no, no priorities, so it can run a DFA over byte equivalence classes
+        static constexpr uint32_t kDeadState = UINT32_MAX;
+        uint8_t fByteClass[ 256 ]{ 0 };
+        uint32_t fNumByteClasses{ 0 };
+        std::vector< uint32_t > fDFA; // numStates * fNumByteClasses, empty when there is no DFA
+        std::vector< bool > fDFAAccept;
+
+        // the whole pattern is a literal, searched for without the VM
+        bool fIsLiteral{ false };
+        std::string fLiteral;
+    };
+}
+
+#endif
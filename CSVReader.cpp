@@ -0,0 +1,441 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "CSVReader.h"
+#include "LineReader.h"
+
+#include <QtConcurrent>
+#include <QThreadPool>
+#include <cstring>
+
+namespace NFileUtils
+{
+    size_t CCSVRecord::size() const
+    {
+        auto end = ( ( fRecord + 1 ) < fRecords->fRecords.size() ) ? fRecords->fRecords[ fRecord + 1 ].fFirstField : fRecords->fFields.size();
+        return end - fRecords->fRecords[ fRecord ].fFirstField;
+    }
+
+    std::string_view CCSVRecord::operator[]( size_t ii ) const
+    {
+        auto && field = fRecords->fFields[ fRecords->fRecords[ fRecord ].fFirstField + ii ];
+        if ( field.fInBuffer )
+            return std::string_view( fRecords->fBuffer.data() + field.fPos, field.fLength );
+        return fRecords->fSource.substr( field.fPos, field.fLength );
+    }
+
+    size_t CCSVRecord::lineNumber() const
+    {
+        return fRecords->fRecords[ fRecord ].fLineNumber;
+    }
+
+    std::vector< std::string > CCSVRecord::toStrings() const
+    {
+        std::vector< std::string > retVal;
+        auto numFields = size();
+        retVal.reserve( numFields );
+        for ( size_t ii = 0; ii < numFields; ++ii )
+            retVal.emplace_back( ( *this )[ ii ] );
+        return retVal;
+    }
+
+    void CCSVRecords::clear()
+    {
+        fSource = std::string_view();
+        fBuffer.clear();
+        fFields.clear();
+        fRecords.clear();
+    }
+
+    CCSVParser::CCSVParser( std::string_view data, char delimiter, char quote, size_t firstLineNumber ) :
+        fData( data ),
+        fDelimiter( delimiter ),
+        fQuote( quote ),
+        fLineNumber( firstLineNumber )
+    {
+        fSpecial.add( delimiter );
+        fSpecial.add( quote );
+        fSpecial.add( '\n' );
+        fSpecial.add( '\r' );
+    }
+
+    bool CCSVParser::next( CCSVRecords & records, std::string * msg )
+    {
+        if ( fHasError )
+            return false;
+
+        // records of other data can not be mixed in, their views would be wrong
+        if ( ( records.fSource.data() != fData.data() ) || ( records.fSource.length() != fData.length() ) )
+        {
+            records.clear();
+            records.fSource = fData;
+        }
+
+        auto len = fData.length();
+        while ( fPos < len )
+        {
+            if ( fData[ fPos ] == '\n' )
+            {
+                fPos++;
+                fLineNumber++;
+            }
+            else if ( ( fData[ fPos ] == '\r' ) && ( ( ( fPos + 1 ) == len ) || ( fData[ fPos + 1 ] == '\n' ) ) )
+                fPos++;
+            else
+                break;
+        }
+        if ( fPos >= len )
+            return false;
+
+        auto firstField = records.fFields.size();
+        records.fRecords.push_back( { firstField, fLineNumber } );
+        bool endOfRecord = false;
+        while ( !endOfRecord )
+        {
+            if ( !nextField( records, endOfRecord, msg ) )
+            {
+                records.fFields.resize( firstField );
+                records.fRecords.pop_back();
+                fHasError = true;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool CCSVParser::nextField( CCSVRecords & records, bool & endOfRecord, std::string * msg )
+    {
+        auto data = fData.data();
+        auto len = fData.length();
+
+        // the field stays a view into the data while its pieces are contiguous, the first
+        // doubled quote or text after a closing quote moves it into the buffer
+        auto segStart = std::string::npos;
+        size_t segLength = 0;
+        auto bufferStart = std::string::npos;
+        auto append = [ & ]( size_t from, size_t length )
+        {
+            if ( !length )
+                return;
+            if ( bufferStart != std::string::npos )
+                records.fBuffer.append( data + from, length );
+            else if ( segStart == std::string::npos )
+            {
+                segStart = from;
+                segLength = length;
+            }
+            else if ( ( segStart + segLength ) == from )
+                segLength += length;
+            else
+            {
+                bufferStart = records.fBuffer.length();
+                records.fBuffer.append( data + segStart, segLength );
+                records.fBuffer.append( data + from, length );
+            }
+        };
+
+        auto fieldStart = fPos;
+        auto pos = fPos;
+        while ( true )
+        {
+            auto next = NSIMDUtils::findFirstOf( data, len, pos, fSpecial );
+            if ( next == std::string::npos )
+                next = len;
+            append( pos, next - pos );
+            pos = next;
+            if ( pos >= len )
+            {
+                endOfRecord = true;
+                break;
+            }
+
+            auto ch = data[ pos ];
+            if ( ch == fDelimiter )
+            {
+                pos++;
+                break;
+            }
+            if ( ch == '\n' )
+            {
+                pos++;
+                fLineNumber++;
+                endOfRecord = true;
+                break;
+            }
+            if ( ch == '\r' )
+            {
+                if ( ( ( pos + 1 ) == len ) || ( data[ pos + 1 ] == '\n' ) )
+                {
+                    endOfRecord = true;
+                    pos++;
+                    if ( pos < len )
+                    {
+                        pos++;
+                        fLineNumber++;
+                    }
+                    break;
+                }
+                append( pos++, 1 );
+                continue;
+            }
+            if ( pos != fieldStart )
+            {
+                append( pos++, 1 );
+                continue;
+            }
+
+            // a quoted section, up to the next quote that is not doubled
+            auto quoteLine = fLineNumber;
+            pos++;
+            while ( true )
+            {
+                auto quote = static_cast< const char * >( std::memchr( data + pos, fQuote, len - pos ) );
+                if ( !quote )
+                {
+                    if ( !fUnterminatedToEnd )
+                    {
+                        fUnterminatedQuote = true;
+                        if ( msg )
+                            *msg = "Unterminated quoted field starting on line " + std::to_string( quoteLine );
+                        return false;
+                    }
+                    append( pos, len - pos );
+                    pos = len;
+                    break;
+                }
+
+                auto quotePos = static_cast< size_t >( quote - data );
+                fLineNumber += NSIMDUtils::countByte( data + pos, quotePos - pos, '\n' );
+                if ( ( ( quotePos + 1 ) < len ) && ( data[ quotePos + 1 ] == fQuote ) )
+                {
+                    append( pos, quotePos + 1 - pos );
+                    pos = quotePos + 2;
+                    continue;
+                }
+                append( pos, quotePos - pos );
+                pos = quotePos + 1;
+                break;
+            }
+        }
+        fPos = pos;
+
+        if ( bufferStart != std::string::npos )
+            records.fFields.push_back( { bufferStart, records.fBuffer.length() - bufferStart, true } );
+        else
+            records.fFields.push_back( { ( segStart == std::string::npos ) ? 0 : segStart, segLength, false } );
+        return true;
+    }
+
+    bool CCSVParser::parseAll( CCSVRecords & records, std::string * msg )
+    {
+        while ( next( records, msg ) )
+            ;
+        return !fHasError;
+    }
+
+    std::vector< std::string > CCSVParser::splitLine( std::string_view line, char delimiter, char quote )
+    {
+        if ( !line.empty() && ( line.back() == '\n' ) )
+            line.remove_suffix( 1 );
+        if ( !line.empty() && ( line.back() == '\r' ) )
+            line.remove_suffix( 1 );
+
+        CCSVParser parser( line, delimiter, quote );
+        parser.fUnterminatedToEnd = true;
+        CCSVRecords records;
+        if ( !parser.next( records ) )
+            return { std::string() };
+        return records.back().toStrings();
+    }
+
+    CCSVLoader::CCSVLoader( char delimiter, char quote ) :
+        fDelimiter( delimiter ),
+        fQuote( quote )
+    {
+    }
+
+    std::vector< CCSVLoader::SChunk > CCSVLoader::splitChunks( std::string_view data, size_t chunkSize )
+    {
+        std::vector< SChunk > retVal;
+        if ( !chunkSize )
+            chunkSize = 1;
+
+        auto len = data.length();
+        size_t start = 0;
+        size_t lineNumber = 1;
+        while ( start < len )
+        {
+            auto target = start + chunkSize;
+            if ( target >= len )
+            {
+                retVal.push_back( { data.substr( start ), lineNumber } );
+                break;
+            }
+
+            auto newLine = static_cast< const char * >( std::memchr( data.data() + target, '\n', len - target ) );
+            if ( !newLine )
+            {
+                retVal.push_back( { data.substr( start ), lineNumber } );
+                break;
+            }
+
+            auto end = static_cast< size_t >( newLine - data.data() ) + 1;
+            retVal.push_back( { data.substr( start, end - start ), lineNumber } );
+            lineNumber += NSIMDUtils::countByte( data.data() + start, end - start, '\n' );
+            start = end;
+        }
+        return retVal;
+    }
+
+    CCSVLoader::TBatchFunc CCSVLoader::perRecord( const TRecordFunc & func )
+    {
+        return [ func ]( const CCSVRecords & records )
+        {
+            for ( size_t ii = 0; ii < records.size(); ++ii )
+            {
+                if ( !func( records[ ii ] ) )
+                    return false;
+            }
+            return true;
+        };
+    }
+
+    bool CCSVLoader::loadFile( const std::string & fileName, const TBatchFunc & func, std::string * msg ) const
+    {
+        // the mapping stays valid until the reader closes, after the last batch
+        CLineReader reader;
+        if ( !reader.open( fileName, msg ) )
+            return false;
+        return load( reader.data(), func, msg );
+    }
+
+    bool CCSVLoader::load( std::string_view data, const TBatchFunc & func, std::string * msg ) const
+    {
+        struct SResult
+        {
+            CCSVRecords fRecords;
+            std::string fMsg;
+            bool fAOK{ false };
+            bool fUnterminatedQuote{ false };
+        };
+        auto parseChunk = [ this ]( const SChunk & chunk, SResult & result )
+        {
+            CCSVParser parser( chunk.fData, fDelimiter, fQuote, chunk.fFirstLineNumber );
+            result.fAOK = parser.parseAll( result.fRecords, &result.fMsg );
+            result.fUnterminatedQuote = parser.unterminatedQuote();
+        };
+
+        // chunk ii starts on a record boundary once chunk ii - 1 parsed cleanly, when its parse
+        // ran off the end inside a quoted field the boundary after it was not a record boundary
+        auto chunks = splitChunks( data, fChunkSize );
+        auto endsInQuote = [ &chunks ]( size_t ii, const SResult & result )
+        {
+            return !result.fAOK && result.fUnterminatedQuote && ( ( ii + 1 ) < chunks.size() );
+        };
+        auto mergeWithNext = [ &chunks ]( size_t ii )
+        {
+            chunks[ ii + 1 ] = { std::string_view( chunks[ ii ].fData.data(), chunks[ ii ].fData.length() + chunks[ ii + 1 ].fData.length() ), chunks[ ii ].fFirstLineNumber };
+        };
+
+        auto maxThreads = ( fMaxThreads > 0 ) ? fMaxThreads : QThreadPool::globalInstance()->maxThreadCount();
+        if ( ( chunks.size() <= 1 ) || ( maxThreads <= 1 ) )
+        {
+            for ( size_t ii = 0; ii < chunks.size(); ++ii )
+            {
+                SResult result;
+                parseChunk( chunks[ ii ], result );
+                while ( endsInQuote( ii, result ) )
+                {
+                    mergeWithNext( ii++ );
+                    result = SResult();
+                    parseChunk( chunks[ ii ], result );
+                }
+                if ( !result.fAOK )
+                {
+                    if ( msg )
+                        *msg = result.fMsg;
+                    return false;
+                }
+                if ( !func( result.fRecords ) )
+                    break;
+            }
+            return true;
+        }
+
+        std::vector< SResult > results( chunks.size() );
+        std::vector< QFuture< void > > futures( chunks.size() );
+        auto start = [ & ]( size_t ii )
+        {
+            futures[ ii ] = QtConcurrent::run( QThreadPool::globalInstance(), [ &parseChunk, &chunks, &results, ii ]()
+            {
+                parseChunk( chunks[ ii ], results[ ii ] );
+            } );
+        };
+
+        // a few chunks ahead of the consumer, so memory stays bounded for any file size
+        size_t numStarted = 0;
+        auto maxAhead = 2 * static_cast< size_t >( maxThreads );
+        for ( ; ( numStarted < chunks.size() ) && ( numStarted < maxAhead ); ++numStarted )
+            start( numStarted );
+
+        bool retVal = true;
+        for ( size_t ii = 0; ii < chunks.size(); ++ii )
+        {
+            futures[ ii ].waitForFinished();
+            while ( endsInQuote( ii, results[ ii ] ) )
+            {
+                // the next chunk started inside the quoted field, its result is discarded
+                if ( ( ii + 1 ) < numStarted )
+                    futures[ ii + 1 ].waitForFinished();
+                else
+                    numStarted = ii + 2;
+                mergeWithNext( ii );
+                results[ ii ] = SResult();
+                results[ ++ii ] = SResult();
+                parseChunk( chunks[ ii ], results[ ii ] );
+            }
+            bool stop = false;
+            if ( !results[ ii ].fAOK )
+            {
+                if ( msg )
+                    *msg = results[ ii ].fMsg;
+                retVal = false;
+                stop = true;
+            }
+            else
+                stop = !func( results[ ii ].fRecords );
+            results[ ii ] = SResult();
+
+            if ( stop )
+            {
+                // the running chunks reference this frame
+                for ( auto jj = ii + 1; jj < numStarted; ++jj )
+                    futures[ jj ].waitForFinished();
+                break;
+            }
+            if ( numStarted < chunks.size() )
+                start( numStarted++ );
+        }
+        return retVal;
+    }
+}
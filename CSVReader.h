@@ -0,0 +1,173 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef __CSVREADER_H
+#define __CSVREADER_H
+
+#include "SIMDUtils.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NFileUtils
+{
+    class CCSVRecords;
+
+    // one record of a CCSVRecords batch, valid as long as the batch and its source data are
+    class CCSVRecord
+    {
+    public:
+        size_t size() const;
+        bool empty() const { return size() == 0; }
+        // without the enclosing quotes, doubled quotes are undone
+        std::string_view operator[]( size_t ii ) const;
+        // of the first line of the record, quoted fields can span lines
+        size_t lineNumber() const;
+        std::vector< std::string > toStrings() const;
+    private:
+        friend class CCSVRecords;
+        CCSVRecord( const CCSVRecords * records, size_t record ) :
+            fRecords( records ),
+            fRecord( record )
+        {
+        }
+
+        const CCSVRecords * fRecords{ nullptr };
+        size_t fRecord{ 0 };
+    };
+
+    // a batch of parsed records
+    // Fields without doubled quotes are views into the parsed data, only the others are copied,
+    // so the data must outlive the batch.
+    class CCSVRecords
+    {
+    public:
+        size_t size() const { return fRecords.size(); }
+        bool empty() const { return fRecords.empty(); }
+        CCSVRecord operator[]( size_t ii ) const { return CCSVRecord( this, ii ); }
+        CCSVRecord back() const { return CCSVRecord( this, fRecords.size() - 1 ); }
+        void clear(); // keeps the capacity
+    private:
+        friend class CCSVRecord;
+        friend class CCSVParser;
+        struct SField
+        {
+            size_t fPos;
+            size_t fLength;
+            bool fInBuffer; // unescaped copy in fBuffer, otherwise in fSource
+        };
+        struct SRecord
+        {
+            size_t fFirstField;
+            size_t fLineNumber;
+        };
+
+        std::string_view fSource;
+        std::string fBuffer;
+        std::vector< SField > fFields;
+        std::vector< SRecord > fRecords;
+    };
+
+    // RFC 4180 parser over a byte span
+    // Records end with "\n" or "\r\n" outside of quotes, empty lines are skipped.  Only a quote
+    // at the start of a field opens a quoted section, anywhere else it is a literal, so
+    // 12" monitor,50 is the two fields 12" monitor and 50.  Text after the closing quote is
+    // kept as is.
+    class CCSVParser
+    {
+    public:
+        // does not copy, data must outlive the parser and the records
+        explicit CCSVParser( std::string_view data, char delimiter = ',', char quote = '"', size_t firstLineNumber = 1 );
+
+        // appends the next record to records, false at the end of the data or on an error
+        bool next( CCSVRecords & records, std::string * msg = nullptr );
+        // appends all the remaining records
+        bool parseAll( CCSVRecords & records, std::string * msg = nullptr );
+
+        bool atEnd() const { return fPos >= fData.length(); }
+        bool hasError() const { return fHasError; }
+        bool unterminatedQuote() const { return fUnterminatedQuote; } // the error was a quoted field running past the end of the data
+        size_t lineNumber() const { return fLineNumber; } // where parsing continues
+
+        // one line, with an optional trailing newline, into its fields
+        // an empty line is one empty field
+        static std::vector< std::string > splitLine( std::string_view line, char delimiter = ',', char quote = '"' );
+    private:
+        bool nextField( CCSVRecords & records, bool & endOfRecord, std::string * msg );
+
+        std::string_view fData;
+        char fDelimiter;
+        char fQuote;
+        NSIMDUtils::CByteSet fSpecial; // ends an unquoted run
+        bool fUnterminatedToEnd{ false }; // splitLine, an unterminated quote runs to the end of the line
+        size_t fPos{ 0 };
+        size_t fLineNumber{ 1 };
+        bool fHasError{ false };
+        bool fUnterminatedQuote{ false };
+    };
+
+    // Loads CSV data in parallel
+    // The data (a memory mapped file for loadFile) is split into chunks at line ends, the
+    // chunks are parsed on the global thread pool and handed to the batch function, one chunk
+    // at a time, in file order, on the calling thread.  A chunk whose parse runs off its end
+    // inside a quoted field ended in the middle of a record, it is merged with the next chunk
+    // and parsed again on the calling thread.
+    class CCSVLoader
+    {
+    public:
+        using TBatchFunc = std::function< bool( const CCSVRecords & records ) >; // false stops the load
+        using TRecordFunc = std::function< bool( const CCSVRecord & record ) >;
+
+        struct SChunk
+        {
+            std::string_view fData;
+            size_t fFirstLineNumber;
+        };
+
+        explicit CCSVLoader( char delimiter = ',', char quote = '"' );
+
+        // approximate, chunks end on the first line end after it
+        void setChunkSize( size_t chunkSize ) { fChunkSize = chunkSize ? chunkSize : 1; }
+        size_t chunkSize() const { return fChunkSize; }
+        // 0 uses the thread count of the global thread pool, 1 parses on the calling thread
+        void setMaxThreads( int maxThreads ) { fMaxThreads = maxThreads; }
+        int maxThreads() const { return fMaxThreads; }
+
+        bool loadFile( const std::string & fileName, const TBatchFunc & func, std::string * msg = nullptr ) const;
+        bool load( std::string_view data, const TBatchFunc & func, std::string * msg = nullptr ) const;
+
+        // a batch function calling func for each record
+        static TBatchFunc perRecord( const TRecordFunc & func );
+        // the speculative chunks, a boundary may be inside a quoted field, load checks each one
+        static std::vector< SChunk > splitChunks( std::string_view data, size_t chunkSize );
+    private:
+        char fDelimiter;
+        char fQuote;
+        size_t fChunkSize{ 4 * 1024 * 1024 };
+        int fMaxThreads{ 0 };
+    };
+}
+#endif
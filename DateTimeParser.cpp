@@ -0,0 +1,246 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "DateTimeParser.h"
+
+#include <QStringList>
+#include <algorithm>
+#include <cmath>
+
+namespace NQtUtils
+{
+    namespace
+    {
+        bool isDigit( const QChar * str, int len, int pos )
+        {
+            return ( pos < len ) && ( str[ pos ].unicode() >= '0' ) && ( str[ pos ].unicode() <= '9' );
+        }
+
+        bool isChar( const QChar * str, int len, int pos, char ch )
+        {
+            return ( pos < len ) && ( str[ pos ].unicode() == ch );
+        }
+
+        bool isPunct( const QChar * str, int len, int pos )
+        {
+            return ( pos < len ) && str[ pos ].isPunct();
+        }
+
+        // minDigits to maxDigits digits, not followed by another digit
+        bool readNumber( const QChar * str, int len, int & pos, int minDigits, int maxDigits, int & value )
+        {
+            auto start = pos;
+            value = 0;
+            for ( ; ( ( pos - start ) < maxDigits ) && isDigit( str, len, pos ); ++pos )
+                value = value * 10 + ( str[ pos ].unicode() - '0' );
+            return ( ( pos - start ) >= minDigits ) && !isDigit( str, len, pos );
+        }
+
+        // exactly 2 digits, the offset hours and minutes can run together
+        bool readTwoDigits( const QChar * str, int len, int & pos, int & value )
+        {
+            if ( !isDigit( str, len, pos ) || !isDigit( str, len, pos + 1 ) )
+                return false;
+            value = ( str[ pos ].unicode() - '0' ) * 10 + ( str[ pos + 1 ].unicode() - '0' );
+            pos += 2;
+            return true;
+        }
+    }
+
+    CDateTimeParser::CDateTimeParser( const QLocale & locale ) :
+        fLocale( locale ),
+        fShortFormat( locale.dateTimeFormat( QLocale::ShortFormat ) ),
+        fLongFormat( locale.dateTimeFormat( QLocale::LongFormat ) )
+    {
+    }
+
+    bool CDateTimeParser::parseNumeric( const QChar * str, int len, QDateTime & dateTime )
+    {
+        int pos = 0;
+        int year;
+        if ( !readNumber( str, len, pos, 4, 4, year ) || !isPunct( str, len, pos ) )
+            return false;
+        auto sep = str[ pos++ ];
+
+        // ISO when every field has its full width, then any punctuation separates the date
+        // fields like Qt::ISODate, otherwise it is one of yyyy-M-d and yyyy/M/d
+        int fieldStart = pos;
+        int month;
+        if ( !readNumber( str, len, pos, 1, 2, month ) || !isPunct( str, len, pos ) )
+            return false;
+        bool iso = ( pos - fieldStart ) == 2;
+        auto sep2 = str[ pos ];
+        fieldStart = ++pos;
+        int day;
+        if ( !readNumber( str, len, pos, 1, 2, day ) )
+            return false;
+        iso = iso && ( ( pos - fieldStart ) == 2 );
+        if ( !iso && ( ( sep2 != sep ) || ( ( sep != QLatin1Char( '-' ) ) && ( sep != QLatin1Char( '/' ) ) ) ) )
+            return false;
+
+        QDate date( year, month, day );
+        if ( pos == len )
+        {
+            dateTime = QDateTime( date, QTime( 0, 0 ), Qt::LocalTime );
+            return true;
+        }
+
+        // yyyy-M-dTh:m:s only takes an upper case T
+        bool dashes = ( sep == QLatin1Char( '-' ) ) && ( sep2 == QLatin1Char( '-' ) );
+        bool upperT = isChar( str, len, pos, 'T' );
+        if ( !upperT && !( iso && ( isChar( str, len, pos, 't' ) || isChar( str, len, pos, ' ' ) ) ) )
+            return false;
+
+        int times[ 3 ] = { 0, 0, 0 };
+        int numTimes = 0;
+        for ( ; numTimes < 3; ++numTimes )
+        {
+            if ( numTimes && !isChar( str, len, pos, ':' ) )
+                break;
+            fieldStart = ++pos;
+            if ( !readNumber( str, len, pos, 1, 2, times[ numTimes ] ) )
+                return false;
+            iso = iso && ( ( pos - fieldStart ) == 2 );
+        }
+        if ( ( numTimes < 2 ) || ( !iso && !( dashes && upperT ) ) )
+            return false;
+
+        int msecs = 0;
+        auto spec = Qt::LocalTime;
+        int offset = 0;
+        if ( pos < len )
+        {
+            if ( !iso )
+                return false;
+
+            if ( ( numTimes == 3 ) && ( isChar( str, len, pos, '.' ) || isChar( str, len, pos, ',' ) ) )
+            {
+                fieldStart = ++pos;
+                double fraction = 0;
+                double scale = 0.1;
+                for ( ; isDigit( str, len, pos ); ++pos, scale /= 10 )
+                    fraction += scale * ( str[ pos ].unicode() - '0' );
+                if ( pos == fieldStart )
+                    return false;
+                msecs = std::min( static_cast< int >( std::lround( fraction * 1000 ) ), 999 );
+            }
+
+            if ( isChar( str, len, pos, 'Z' ) || isChar( str, len, pos, 'z' ) )
+            {
+                spec = Qt::UTC;
+                pos++;
+            }
+            else if ( isChar( str, len, pos, '+' ) || isChar( str, len, pos, '-' ) )
+            {
+                int sign = isChar( str, len, pos, '-' ) ? -1 : 1;
+                int hours;
+                int minutes = 0;
+                if ( !readTwoDigits( str, len, ++pos, hours ) )
+                    return false;
+                bool colon = isChar( str, len, pos, ':' );
+                if ( colon )
+                    pos++;
+                if ( ( colon || ( pos < len ) ) && !readTwoDigits( str, len, pos, minutes ) )
+                    return false;
+                spec = Qt::OffsetFromUTC;
+                offset = sign * ( hours * 3600 + minutes * 60 );
+            }
+            if ( pos != len )
+                return false;
+        }
+        else if ( !iso && ( numTimes != 3 ) )
+            return false;
+
+        // ISO allows 24:00 for the end of the day
+        if ( iso && ( times[ 0 ] == 24 ) && !times[ 1 ] && !times[ 2 ] && !msecs )
+        {
+            date = date.addDays( 1 );
+            times[ 0 ] = 0;
+        }
+        QTime time( times[ 0 ], times[ 1 ], times[ 2 ], msecs );
+        if ( spec == Qt::OffsetFromUTC )
+            dateTime = QDateTime( date, time, spec, offset );
+        else
+            dateTime = QDateTime( date, time, spec );
+        return true;
+    }
+
+    QDateTime CDateTimeParser::parse( const QString & str, EFormat format ) const
+    {
+        switch ( format )
+        {
+            case EFormat::eTextDate:
+                return QDateTime::fromString( str );
+            case EFormat::eShortFormat:
+                return QDateTime::fromString( str, fShortFormat );
+            case EFormat::eLongFormat:
+                return QDateTime::fromString( str, fLongFormat );
+            case EFormat::eISODate:
+                return QDateTime::fromString( str, Qt::ISODate );
+            default:
+                return QDateTime();
+        }
+    }
+
+    QDateTime CDateTimeParser::parse( const QString & str )
+    {
+        QDateTime retVal;
+        if ( parseNumeric( str.constData(), str.length(), retVal ) || str.isEmpty() )
+            return retVal;
+
+        retVal = parse( str, fLastFormat );
+        if ( retVal.isValid() )
+            return retVal;
+
+        for ( int ii = 0; ii < static_cast< int >( EFormat::eNumFormats ); ++ii )
+        {
+            auto format = static_cast< EFormat >( ii );
+            if ( format == fLastFormat )
+                continue;
+            retVal = parse( str, format );
+            if ( retVal.isValid() )
+            {
+                fLastFormat = format;
+                return retVal;
+            }
+        }
+        return QDateTime();
+    }
+
+    QDateTime CDateTimeParser::parse( const QStringRef & str )
+    {
+        QDateTime retVal;
+        if ( parseNumeric( str.unicode(), str.length(), retVal ) )
+            return retVal;
+        return parse( str.toString() );
+    }
+
+    QList< QDateTime > CDateTimeParser::parseColumn( const QStringList & values )
+    {
+        QList< QDateTime > retVal;
+        retVal.reserve( values.count() );
+        for ( auto && ii : values )
+            retVal << parse( ii );
+        return retVal;
+    }
+}
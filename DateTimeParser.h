@@ -0,0 +1,78 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef __DATETIMEPARSER_H
+#define __DATETIMEPARSER_H
+
+#include <QDateTime>
+#include <QList>
+#include <QLocale>
+#include <QString>
+
+class QStringList;
+namespace NQtUtils
+{
+    // Parses the formats getDateTime accepts, without trying them one after another
+    // The numeric shapes are recognized from their digit and separator positions and parsed
+    // directly, an out of range value fails without trying any other format
+    //   yyyy-MM-dd[THH:mm[:ss[.zzz]]][Z|+HH[[:]mm]]     Qt::ISODate, any punctuation between
+    //                                                   the date fields, T, t or a space
+    //                                                   before the time and Z or z
+    //   yyyy-M-d[Th:m:s]
+    //   yyyy/M/d
+    // Anything else goes to QDateTime::fromString with Qt::TextDate, the locale short and
+    // long formats and Qt::ISODate, starting with the one that worked last, so a file or
+    // column of timestamps in one format costs one parse per value.
+    class CDateTimeParser
+    {
+    public:
+        explicit CDateTimeParser( const QLocale & locale = QLocale() );
+
+        QDateTime parse( const QString & str );
+        QDateTime parse( const QStringRef & str );
+        // invalid QDateTimes for the values that do not parse
+        QList< QDateTime > parseColumn( const QStringList & values );
+
+        const QLocale & locale() const { return fLocale; }
+
+        // false when str is not one of the numeric shapes, dateTime is invalid when it is one
+        // with out of range values
+        static bool parseNumeric( const QChar * str, int len, QDateTime & dateTime );
+    private:
+        enum class EFormat
+        {
+            eTextDate,
+            eShortFormat,
+            eLongFormat,
+            eISODate,
+            eNumFormats
+        };
+        QDateTime parse( const QString & str, EFormat format ) const;
+
+        EFormat fLastFormat{ EFormat::eTextDate };
+        QLocale fLocale;
+        QString fShortFormat;
+        QString fLongFormat;
+    };
+}
+#endif
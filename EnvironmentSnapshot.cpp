@@ -0,0 +1,216 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "EnvironmentSnapshot.h"
+
+#include <QProcessEnvironment>
+#include <QString>
+#include <QStringList>
+
+namespace NStringUtils
+{
+    CEnvironmentSnapshot::CEnvironmentSnapshot( bool lazy ) :
+        fLazy( lazy )
+    {
+        load();
+    }
+
+    void CEnvironmentSnapshot::load() const
+    {
+        fValues.clear();
+        if ( fLazy )
+            return;
+
+        auto env = QProcessEnvironment::systemEnvironment();
+        auto keys = env.keys();
+        fValues.reserve( keys.size() );
+        for ( auto && ii : keys )
+            fValues[ ii.toStdString() ] = env.value( ii ).toStdString();
+    }
+
+    void CEnvironmentSnapshot::invalidate()
+    {
+        load();
+    }
+
+    void CEnvironmentSnapshot::setValue( const std::string & name, const std::string & value )
+    {
+        fOverrides[ name ] = value;
+    }
+
+    const std::string * CEnvironmentSnapshot::value( std::string_view name ) const
+    {
+        fKey.assign( name.data(), name.length() );
+        if ( !fOverrides.empty() )
+        {
+            auto pos = fOverrides.find( fKey );
+            if ( pos != fOverrides.end() )
+                return ( *pos ).second.empty() ? nullptr : &( *pos ).second;
+        }
+
+        auto pos = fValues.find( fKey );
+        if ( ( pos == fValues.end() ) && fLazy )
+            pos = fValues.emplace( fKey, qgetenv( fKey.c_str() ).toStdString() ).first;
+        if ( ( pos == fValues.end() ) || ( *pos ).second.empty() )
+            return nullptr;
+        return &( *pos ).second;
+    }
+
+    CEnvVarExpander::CEnvVarExpander( const CEnvironmentSnapshot & env ) :
+        fEnv( env )
+    {
+    }
+
+    const std::string * CEnvVarExpander::lookup( std::string_view name )
+    {
+        auto retVal = fEnv.value( name );
+        if ( retVal )
+            return retVal;
+
+        fUpperName.assign( name.data(), name.length() );
+        bool changed = false;
+        for ( auto && ii : fUpperName )
+        {
+            if ( ( ii >= 'a' ) && ( ii <= 'z' ) )
+            {
+                ii = static_cast< char >( ii - 'a' + 'A' );
+                changed = true;
+            }
+        }
+        return changed ? fEnv.value( fUpperName ) : nullptr;
+    }
+
+    bool CEnvVarExpander::expand( std::string_view text, std::string & out, std::string * msg )
+    {
+        out.clear();
+        fStack.clear();
+        fStack.push_back( { text, 0, std::string_view() } );
+
+        bool aOK = true;
+        auto setError = [ &aOK, msg ]( const std::string & error )
+        {
+            if ( aOK && msg )
+                *msg = error;
+            aOK = false;
+        };
+
+        while ( !fStack.empty() )
+        {
+            auto & frame = fStack.back();
+            auto curr = frame.fText;
+            auto pos = curr.find_first_of( "%$", frame.fPos );
+            if ( pos == std::string_view::npos )
+            {
+                out.append( curr.data() + frame.fPos, curr.length() - frame.fPos );
+                fStack.pop_back();
+                continue;
+            }
+            out.append( curr.data() + frame.fPos, pos - frame.fPos );
+
+            std::string_view name;
+            size_t end = 0;
+            if ( curr[ pos ] == '%' )
+            {
+                auto close = curr.find( '%', pos + 1 );
+                if ( close == std::string_view::npos )
+                {
+                    // a lone % is not a reference
+                    out.append( curr.data() + pos, curr.length() - pos );
+                    fStack.pop_back();
+                    continue;
+                }
+                name = curr.substr( pos + 1, close - pos - 1 );
+                end = close + 1;
+            }
+            else
+            {
+                auto next = ( ( pos + 1 ) < curr.length() ) ? curr[ pos + 1 ] : 0;
+                if ( ( next == '{' ) || ( next == '(' ) )
+                {
+                    auto close = curr.find( ( next == '{' ) ? '}' : ')', pos );
+                    if ( close == std::string_view::npos )
+                    {
+                        setError( "Malformed environmental variable" );
+                        out.assign( text.data(), text.length() );
+                        return false;
+                    }
+                    name = curr.substr( pos + 2, close - pos - 2 );
+                    end = close + 1;
+                }
+                else
+                {
+                    end = curr.find_first_of( " \t/\\$", pos + 1 );
+                    if ( end == std::string_view::npos )
+                        end = curr.length();
+                    name = curr.substr( pos + 1, end - pos - 1 );
+                }
+            }
+            frame.fPos = end;
+
+            auto value = lookup( name );
+            if ( !value )
+            {
+                setError( "Environmental variable '" + ( fUpperName.empty() ? std::string( name ) : fUpperName ) + "' not found" );
+                continue;
+            }
+            if ( value->find_first_of( "%$" ) == std::string::npos )
+            {
+                out.append( *value );
+                continue;
+            }
+
+            bool recursive = false;
+            for ( auto && ii : fStack )
+                recursive = recursive || ( ii.fName == name );
+            if ( recursive )
+            {
+                setError( "Environmental variable '" + std::string( name ) + "' references itself" );
+                continue;
+            }
+            fStack.push_back( { *value, 0, name } ); // frame is invalid from here on
+        }
+        return aOK;
+    }
+
+    std::string CEnvVarExpander::expand( std::string_view text, std::string * msg, bool * aOK )
+    {
+        std::string retVal;
+        auto ok = expand( text, retVal, msg );
+        if ( aOK )
+            *aOK = ok;
+        return retVal;
+    }
+
+    bool CEnvVarExpander::expandAll( std::vector< std::string > & list, std::string * msg )
+    {
+        bool aOK = true;
+        for ( auto && ii : list )
+        {
+            if ( ii.find_first_of( "%$" ) == std::string::npos )
+                continue;
+            if ( !expand( ii, fOut, aOK ? msg : nullptr ) )
+                aOK = false;
+            ii.swap( fOut );
+        }
+        return aOK;
+    }
+}
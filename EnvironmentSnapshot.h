@@ -0,0 +1,92 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __ENVIRONMENTSNAPSHOT_H
+#define __ENVIRONMENTSNAPSHOT_H
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace NStringUtils
+{
+    // Cached view of the process environment
+    // Lazy snapshots call qgetenv the first time a name is used and remember the answer, including
+    // misses, so they should not be shared between threads.  Eager snapshots read the whole
+    // environment up front and are read only afterwards.
+    // Neither notices qputenv/setenv, call invalidate() after changing the environment.
+    class CEnvironmentSnapshot
+    {
+    public:
+        explicit CEnvironmentSnapshot( bool lazy = true );
+
+        // nullptr when the variable is not set or is empty, the same as qgetenv
+        const std::string * value( std::string_view name ) const;
+        // overrides the environment for this snapshot only, an empty value hides the variable
+        void setValue( const std::string & name, const std::string & value );
+        void invalidate();
+
+        bool isLazy() const { return fLazy; }
+    private:
+        void load() const;
+
+        bool fLazy{ true };
+        mutable std::unordered_map< std::string, std::string > fValues;
+        std::unordered_map< std::string, std::string > fOverrides;
+        mutable std::string fKey;
+    };
+
+    // Single pass expansion of %VAR%, $VAR, ${VAR} and $(VAR), with the same syntax as expandEnvVariable
+    // Values that contain references are expanded through an explicit stack, a variable that
+    // (indirectly) references itself is an error rather than an endless loop.  A name that is
+    // not found is retried in upper case, then expands to nothing and fails the expansion.
+    // Buffers are kept between calls, so one expander should be reused for a whole filelist.
+    class CEnvVarExpander
+    {
+    public:
+        explicit CEnvVarExpander( const CEnvironmentSnapshot & env );
+
+        // out is set to the expanded text, or to text when it is malformed
+        bool expand( std::string_view text, std::string & out, std::string * msg = nullptr );
+        std::string expand( std::string_view text, std::string * msg = nullptr, bool * aOK = nullptr );
+
+        // expands every entry in place, msg is set to the first error
+        bool expandAll( std::vector< std::string > & list, std::string * msg = nullptr );
+    private:
+        const std::string * lookup( std::string_view name );
+
+        struct SFrame
+        {
+            std::string_view fText;
+            size_t fPos;
+            std::string_view fName; // the variable whose value this is, empty for the original text
+        };
+
+        const CEnvironmentSnapshot & fEnv;
+        std::vector< SFrame > fStack;
+        std::string fUpperName;
+        std::string fOut;
+    };
+}
+
+#endif
@@ -22,6 +22,7 @@
 
 #include "FileUtils.h"
 #include "StringUtils.h"
+#include "NoCaseStringSet.h"
 
 #include <Qt>
 #include <QDebug>
@@ -40,6 +41,8 @@
 #include <fstream>
 #include <iostream>
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
 #ifdef _WINDOWS
 #include <io.h>     // for _access()
 #include <direct.h> // for chdir
@@ -562,6 +565,39 @@ std::string getWd()
     return canonicalFilePath( retVal );
 }
 
+//////////////////////////////////////////////////////////////////////////
+// get_line_from_file() : reads the next line, without the "\n" or "\r\n"
+// line_no is incremented for each line read, false at the end of the file.
+// For whole files CLineReader (LineReader.h) avoids the per line copies.
+//////////////////////////////////////////////////////////////////////////
+bool get_line_from_file( FILE * fp, std::string & line, int & line_no )
+{
+    line.clear();
+    if ( !fp )
+        return false;
+
+    char buffer[ 4096 ];
+    bool readAny = false;
+    while ( std::fgets( buffer, sizeof( buffer ), fp ) )
+    {
+        readAny = true;
+        auto len = std::strlen( buffer );
+        if ( len && ( buffer[ len - 1 ] == '\n' ) )
+        {
+            line.append( buffer, len - 1 );
+            break;
+        }
+        line.append( buffer, len );
+    }
+    if ( !readAny )
+        return false;
+
+    if ( !line.empty() && ( line.back() == '\r' ) )
+        line.pop_back();
+    line_no++;
+    return true;
+}
+
 /******************************************************************
 Function: tilda2Home
 Date: 8/8/07
@@ -911,7 +947,7 @@ bool moveToTrash( const std::string & fileName )
     return moveToTrash( QString::fromStdString( fileName ) );
 }
 
-static std::unordered_set< std::string, NStringUtils::noCaseStringHash, NStringUtils::noCaseStringEq > sSystemLibDirs;
+static NStringUtils::CNoCaseStringSet sSystemLibDirs;
 static std::unordered_map< std::string, std::string > sSystemFileMap;
 
 std::string getSystemFileName( const std::string & fileName, const std::string & relToDir )
@@ -946,7 +982,7 @@ void addSystemFileDirectories( const std::list< std::string > & dirs )
 {
     if ( sSystemLibDirs.empty() )
     {
-        sSystemLibDirs = std::unordered_set< std::string, NStringUtils::noCaseStringHash, NStringUtils::noCaseStringEq >( { "vhdl_packages", "verilog_packages", "ISE", "vivado", "vivado_2014_4", "vivado_2015_2", "15_0", "ProASIC3", "altera_packages" } );
+        sSystemLibDirs = NStringUtils::CNoCaseStringSet( { "vhdl_packages", "verilog_packages", "ISE", "vivado", "vivado_2014_4", "vivado_2015_2", "15_0", "ProASIC3", "altera_packages" } );
     }
     for ( auto ii : dirs )
     {
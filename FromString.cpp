@@ -22,17 +22,108 @@
 
 #include "FromString.h"
 #include "StringUtils.h"
-#include <float.h>
-#include <algorithm>
+#include "SIMDUtils.h"
+#include <charconv>
 #include <cerrno>
-#include <limits.h>
+#include <cstdlib>
 #include <cstring>
 #include <string>
 #include <cctype>
-bool restIsSpace( const std::string & str, size_t sz )
+
+#if defined( __cpp_lib_to_chars ) && ( __cpp_lib_to_chars >= 201611L )
+#define SAB_FLOAT_FROM_CHARS 1 // the library has the floating point overloads
+#endif
+
+namespace NFromString
 {
-    auto pos = std::find_if( str.begin() + sz, str.end(), []( char value ){ return !std::isspace( value ); } );
-    return pos == str.end();
+    namespace
+    {
+        template< typename T >
+        bool parseFloating( std::string_view text, T & retVal, bool allowTrailingSpace )
+        {
+            auto end = text.data() + text.length();
+            auto curr = skipSpace( text.data(), end );
+
+            // from_chars takes neither a leading + nor the 0x of a hex float
+            bool negative = false;
+            if ( ( curr != end ) && ( ( *curr == '-' ) || ( *curr == '+' ) ) )
+                negative = ( *curr++ == '-' );
+            if ( ( curr == end ) || ( *curr == '-' ) || ( *curr == '+' ) || std::isspace( static_cast< unsigned char >( *curr ) ) )
+                return false;
+
+            T value = 0;
+            const char * parsedEnd = nullptr;
+#ifdef SAB_FLOAT_FROM_CHARS
+            auto format = std::chars_format::general;
+            if ( ( ( end - curr ) > 2 ) && ( curr[ 0 ] == '0' ) && ( ( curr[ 1 ] == 'x' ) || ( curr[ 1 ] == 'X' ) )
+                 && ( std::isxdigit( static_cast< unsigned char >( curr[ 2 ] ) ) || ( curr[ 2 ] == '.' ) ) )
+            {
+                curr += 2;
+                format = std::chars_format::hex;
+            }
+            auto result = std::from_chars( curr, end, value, format );
+            if ( result.ec != std::errc() )
+                return false;
+            parsedEnd = result.ptr;
+#else
+            // strtod needs a terminated string, numbers are short enough for the stack
+            char buffer[ 128 ];
+            auto len = static_cast< size_t >( end - curr );
+            if ( len >= sizeof( buffer ) )
+                return false;
+            std::memcpy( buffer, curr, len );
+            buffer[ len ] = 0;
+
+            char * stop = nullptr;
+            errno = 0;
+            if constexpr ( std::is_same_v< T, float > )
+                value = std::strtof( buffer, &stop );
+            else
+                value = std::strtod( buffer, &stop );
+            if ( ( stop == buffer ) || ( errno == ERANGE ) )
+                return false;
+            parsedEnd = curr + ( stop - buffer );
+#endif
+            if ( ( parsedEnd != end ) && ( !allowTrailingSpace || ( skipSpace( parsedEnd, end ) != end ) ) )
+                return false;
+
+            retVal = negative ? -value : value;
+            return true;
+        }
+    }
+
+    bool parseDouble( std::string_view text, double & retVal, bool allowTrailingSpace )
+    {
+        return parseFloating( text, retVal, allowTrailingSpace );
+    }
+
+    bool parseFloat( std::string_view text, float & retVal, bool allowTrailingSpace )
+    {
+        return parseFloating( text, retVal, allowTrailingSpace );
+    }
+
+    bool parseBool( std::string_view text, bool & retVal )
+    {
+        retVal = false; // default value;
+        if ( text.empty() )
+            return false;
+
+        double doubleVal = 0.0;
+        if ( parseDouble( text, doubleVal, true ) )
+        {
+            retVal = doubleVal != 0.0;
+            return true;
+        }
+
+        static const std::string_view falseValues[] = { "false", "no", "off", "n", "f" };
+        retVal = true;
+        for ( auto && ii : falseValues )
+        {
+            if ( NSIMDUtils::equalsNoCase( text.data(), text.length(), ii.data(), ii.length() ) )
+                retVal = false;
+        }
+        return true;
+    }
 }
 
 bool fromString( long & retVal, const std::string & arg, int base )
@@ -41,21 +132,12 @@ bool fromString( long & retVal, const std::string & arg, int base )
     if ( arg.empty() )
         return false;
 
-    size_t sz;
-    try
-    {
-        retVal = std::stol( arg, &sz, base );
-    }
-    catch( ... )
+    if ( !NFromString::parseInteger( arg, retVal, base, true ) )
     {
+        retVal = 0;
         return false;
     }
-    auto aOK = restIsSpace( arg, sz );
-
-    if ( !aOK )
-        retVal = 0;
-
-    return aOK;
+    return true;
 }
 
 bool fromString( long & retVal, const std::string & arg )
@@ -65,20 +147,23 @@ bool fromString( long & retVal, const std::string & arg )
 
 bool fromString( long & retVal, const char * arg, int base )
 {
-    return fromString( retVal, std::string( arg ), base );
+    retVal = 0;
+    if ( !arg || !*arg )
+        return false;
+
+    if ( !NFromString::parseInteger( arg, retVal, base, true ) )
+    {
+        retVal = 0;
+        return false;
+    }
+    return true;
 }
 
 bool fromString( int & retVal, const std::string & arg, int base )
 {
-    long tmp;
-    bool aOK = fromString( tmp, arg, base );
-    if ( !aOK )
-        return false;
-    if ( ( tmp > INT_MAX ) || ( tmp < INT_MIN ) )
+    if ( arg.empty() )
         return false;
-
-    retVal = static_cast< int >( tmp );
-    return true;
+    return NFromString::parseInteger( arg, retVal, base, true );
 }
 
 bool fromString( int & retVal, const std::string & arg )
@@ -86,90 +171,57 @@ bool fromString( int & retVal, const std::string & arg )
     return fromString( retVal, arg, 10 );
 }
 
-
 bool fromString( int & retVal, const char * arg, int base )
 {
-    return fromString( retVal, std::string( arg ), base );
+    if ( !arg || !*arg )
+        return false;
+    return NFromString::parseInteger( arg, retVal, base, true );
 }
 
 bool fromString( int & retVal, const char * arg )
 {
-    return fromString( retVal, std::string( arg ) );
+    return fromString( retVal, arg, 10 );
 }
 
 bool fromString( double & retVal, const std::string & arg )
 {
     retVal = 0;
-    if ( arg.empty() )
-        return false;
-    std::string::size_type sz;
-    try
-    {
-        retVal = std::stod( arg, &sz );
-    }
-    catch( ... )
+    if ( !NFromString::parseDouble( arg, retVal, true ) )
     {
+        retVal = 0.0;
         return false;
     }
-    bool aOK = restIsSpace( arg, sz );
-    if ( !aOK )
-        retVal = 0.0;
-    return aOK;
+    return true;
 }
 
 bool fromString( double & retVal, const char * arg )
 {
-    return fromString( retVal, std::string( arg ) );
+    retVal = 0;
+    if ( !arg || !NFromString::parseDouble( arg, retVal, true ) )
+    {
+        retVal = 0.0;
+        return false;
+    }
+    return true;
 }
 
 bool fromString( float & retVal, const std::string & arg )
 {
-    double tmp;
-    bool aOK = fromString( tmp, arg );
-    if ( !aOK )
-        return false;
-    if ( ( tmp > FLT_MAX ) || ( tmp < FLT_MIN ) )
-        return false;
-
-    retVal = static_cast< float >( tmp );
-    return true;
+    return NFromString::parseFloat( arg, retVal, true );
 }
 
 bool fromString( float & retVal, const char * arg )
 {
-    return fromString( retVal, std::string( arg ) );
+    return arg && NFromString::parseFloat( arg, retVal, true );
 }
 
 bool fromString( bool & retVal, const std::string & arg )
 {
-    retVal = false; // default value;
-    if ( arg.length() == 0 )
-        return false;
-
-    double doubleVal = 0.0;
-    bool isDouble  = fromString( doubleVal, arg );
-    if ( isDouble )
-    {
-        retVal = doubleVal != 0.0;
-        return true;
-    }
-
-    int intVal = 0;
-    bool isInt = fromString( intVal, arg );
-    if ( isInt )
-    {
-        retVal = intVal != 0;
-    }
-
-    std::string lc = arg;
-    std::transform(lc.begin(), lc.end(), lc.begin(), ::tolower);
-
-    retVal = ( lc != "false" ) && ( lc != "no" ) && ( lc != "off" ) && ( lc != "n" ) && ( lc != "f" );
-    return true;
+    return NFromString::parseBool( arg, retVal );
 }
 
 bool fromString( bool & retVal, const char * arg )
 {
-    return fromString( retVal, std::string( arg ) );
+    retVal = false;
+    return arg && NFromString::parseBool( arg, retVal );
 }
-
@@ -23,26 +23,150 @@
 #ifndef __FROMSTRING_H
 #define __FROMSTRING_H 
 
+#include <charconv>
+#include <cctype>
+#include <limits>
 #include <string>
+#include <string_view>
 #include <sstream>
+#include <type_traits>
+#include <vector>
+
+// Allocation and locale free parsing on std::from_chars, the whole string must be the value
+namespace NFromString
+{
+    // character types are read as characters by the stream, not as numbers
+    template< typename T >
+    constexpr bool isIntegerType = std::is_integral_v< T > && !std::is_same_v< T, bool > && !std::is_same_v< T, char > && !std::is_same_v< T, signed char >
+                                   && !std::is_same_v< T, unsigned char > && !std::is_same_v< T, wchar_t > && !std::is_same_v< T, char16_t > && !std::is_same_v< T, char32_t >;
+
+    template< typename T >
+    constexpr bool isFloatType = std::is_same_v< T, float > || std::is_same_v< T, double >;
+
+    inline const char * skipSpace( const char * curr, const char * end )
+    {
+        while ( ( curr != end ) && std::isspace( static_cast< unsigned char >( *curr ) ) )
+            ++curr;
+        return curr;
+    }
+
+    // leading whitespace and a sign are skipped, base 16 allows a 0x prefix and base 0 detects 0x (hex) and 0 (octal), as strtol does
+    // negative values are never accepted for unsigned types
+    template< typename T >
+    bool parseInteger( std::string_view text, T & retVal, int base = 10, bool allowTrailingSpace = false )
+    {
+        static_assert( std::is_integral_v< T >, "parseInteger requires an integral type" );
+        auto end = text.data() + text.length();
+        auto curr = skipSpace( text.data(), end );
+
+        bool negative = false;
+        if ( ( curr != end ) && ( ( *curr == '-' ) || ( *curr == '+' ) ) )
+            negative = ( *curr++ == '-' );
+
+        bool hexPrefix = ( ( end - curr ) > 2 ) && ( curr[ 0 ] == '0' ) && ( ( curr[ 1 ] == 'x' ) || ( curr[ 1 ] == 'X' ) ) && std::isxdigit( static_cast< unsigned char >( curr[ 2 ] ) );
+        if ( ( ( base == 16 ) || ( base == 0 ) ) && hexPrefix )
+        {
+            curr += 2;
+            base = 16;
+        }
+        else if ( base == 0 )
+            base = ( ( curr != end ) && ( *curr == '0' ) ) ? 8 : 10;
+
+        if ( ( base < 2 ) || ( base > 36 ) )
+            return false;
+
+        using TUnsigned = std::make_unsigned_t< T >;
+        TUnsigned magnitude = 0;
+        auto result = std::from_chars( curr, end, magnitude, base );
+        if ( result.ec != std::errc() )
+            return false;
+        if ( ( result.ptr != end ) && ( !allowTrailingSpace || ( skipSpace( result.ptr, end ) != end ) ) )
+            return false;
+
+        if constexpr ( std::is_signed_v< T > )
+        {
+            constexpr auto kMax = static_cast< TUnsigned >( std::numeric_limits< T >::max() );
+            if ( magnitude > ( negative ? ( kMax + 1 ) : kMax ) )
+                return false;
+            if ( negative )
+                retVal = ( magnitude == ( kMax + 1 ) ) ? std::numeric_limits< T >::min() : static_cast< T >( -static_cast< T >( magnitude ) );
+            else
+                retVal = static_cast< T >( magnitude );
+        }
+        else
+        {
+            if ( negative && magnitude )
+                return false;
+            retVal = magnitude;
+        }
+        return true;
+    }
+
+    // leading whitespace and a sign are skipped, accepts fixed, scientific, 0x hex floats, inf and nan, as strtod does
+    bool parseDouble( std::string_view text, double & retVal, bool allowTrailingSpace = false );
+    bool parseFloat( std::string_view text, float & retVal, bool allowTrailingSpace = false );
+    // numbers are true when non zero, false/no/off/n/f (any case) are false, any other text is true
+    bool parseBool( std::string_view text, bool & retVal );
+
+    template< typename T >
+    bool parse( std::string_view text, T & retVal, bool allowTrailingSpace = false )
+    {
+        if constexpr ( isIntegerType< T > )
+            return parseInteger( text, retVal, 10, allowTrailingSpace );
+        else if constexpr ( std::is_same_v< T, double > )
+            return parseDouble( text, retVal, allowTrailingSpace );
+        else if constexpr ( std::is_same_v< T, float > )
+            return parseFloat( text, retVal, allowTrailingSpace );
+        else if constexpr ( std::is_same_v< T, bool > )
+            return parseBool( text, retVal );
+        else
+        {
+            // everything else still goes through the stream operators
+            if ( text.empty() )
+                return false;
+            std::stringstream ss( std::string( text.data(), text.length() ) );
+            ss >> retVal;
+            if ( ss.fail() )
+                return false;
+            if ( allowTrailingSpace )
+                ss >> std::ws;
+            char c;
+            return !ss.get( c );
+        }
+    }
+
+    struct SParseError
+    {
+        size_t fLine{ 0 }; // 1 based
+        size_t fColumn{ 0 }; // 1 based, of the field
+        std::string fText;
+    };
+
+    // splits text into lines, and each line on delim, then parses field number fieldNum (0 based) of every non blank line
+    // blanks around the field are ignored, a missing or invalid field appends T() and an error, so values stays aligned with the rows
+    // returns true when every row parsed
+    template< typename T >
+    bool parseColumn( std::string_view text, char delim, size_t fieldNum, std::vector< T > & values, std::vector< SParseError > * errors = nullptr, size_t numHeaderLines = 0 );
+
+    // parses every field of a single delimited list ("1, 2, 3"), same error handling as parseColumn
+    template< typename T >
+    bool parseList( std::string_view text, char delim, std::vector< T > & values, std::vector< SParseError > * errors = nullptr );
+}
 
 template <class T>
 bool fromString( T & retVal, const char * arg )
 {
     if ( !arg || !*arg )
         return false;
-    std::stringstream ss( arg );
-    ss >> retVal;
-    char c;
-    if ( ss.fail() || ss.get(c) )
-        return false;
-    return true;
+    return NFromString::parse( arg, retVal );
 }
 
 template <class T>
 bool fromString( T & retVal, const std::string & arg )
 {
-    return fromString( retVal, arg.c_str() );
+    if ( arg.empty() )
+        return false;
+    return NFromString::parse( arg, retVal );
 }
 
 bool fromString( long & retVal, const char * arg, int base );
@@ -61,5 +185,93 @@ bool fromString( float & retVal, const char * arg );
 bool fromString( bool & retVal, const char * arg );
 bool fromString( bool & retVal, const std::string & arg );
 
-#endif 
+namespace NFromString
+{
+    namespace NDetail
+    {
+        inline std::string_view trim( std::string_view text )
+        {
+            auto end = text.data() + text.length();
+            auto start = skipSpace( text.data(), end );
+            while ( ( end != start ) && std::isspace( static_cast< unsigned char >( end[ -1 ] ) ) )
+                --end;
+            return std::string_view( start, static_cast< size_t >( end - start ) );
+        }
 
+        template< typename T >
+        bool parseField( std::string_view field, size_t line, size_t column, std::vector< T > & values, std::vector< SParseError > * errors )
+        {
+            T value{};
+            auto trimmed = trim( field );
+            if ( !trimmed.empty() && parse( trimmed, value ) )
+            {
+                values.push_back( value );
+                return true;
+            }
+            values.push_back( T() );
+            if ( errors )
+                errors->push_back( { line, column, std::string( field ) } );
+            return false;
+        }
+    }
+
+    template< typename T >
+    bool parseColumn( std::string_view text, char delim, size_t fieldNum, std::vector< T > & values, std::vector< SParseError > * errors, size_t numHeaderLines )
+    {
+        bool aOK = true;
+        size_t lineNum = 0;
+        size_t pos = 0;
+        while ( pos < text.length() )
+        {
+            auto lineEnd = text.find( '\n', pos );
+            if ( lineEnd == std::string_view::npos )
+                lineEnd = text.length();
+            auto line = text.substr( pos, lineEnd - pos );
+            pos = lineEnd + 1;
+            if ( ++lineNum <= numHeaderLines )
+                continue;
+            if ( NDetail::trim( line ).empty() )
+                continue;
+
+            size_t fieldStart = 0;
+            for ( size_t ii = 0; ( ii < fieldNum ) && ( fieldStart != std::string_view::npos ); ++ii )
+            {
+                fieldStart = line.find( delim, fieldStart );
+                if ( fieldStart != std::string_view::npos )
+                    fieldStart++;
+            }
+            if ( fieldStart == std::string_view::npos )
+            {
+                aOK = NDetail::parseField( std::string_view(), lineNum, line.length() + 1, values, errors ) && aOK;
+                continue;
+            }
+            auto fieldEnd = line.find( delim, fieldStart );
+            if ( fieldEnd == std::string_view::npos )
+                fieldEnd = line.length();
+            aOK = NDetail::parseField( line.substr( fieldStart, fieldEnd - fieldStart ), lineNum, fieldStart + 1, values, errors ) && aOK;
+        }
+        return aOK;
+    }
+
+    template< typename T >
+    bool parseList( std::string_view text, char delim, std::vector< T > & values, std::vector< SParseError > * errors )
+    {
+        bool aOK = true;
+        if ( NDetail::trim( text ).empty() )
+            return aOK;
+        size_t fieldStart = 0;
+        while ( true )
+        {
+            auto fieldEnd = text.find( delim, fieldStart );
+            if ( fieldEnd == std::string_view::npos )
+                fieldEnd = text.length();
+            aOK = NDetail::parseField( text.substr( fieldStart, fieldEnd - fieldStart ), 1, fieldStart + 1, values, errors ) && aOK;
+            if ( fieldEnd == text.length() )
+                break;
+            fieldStart = fieldEnd + 1;
+        }
+        return aOK;
+    }
+}
+
+#endif 
@@ -0,0 +1,308 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "HierNameStore.h"
+
+#include <cstring>
+
+namespace NStringUtils
+{
+    namespace
+    {
+        const size_t kChunkSize = 64 * 1024;
+        const size_t kMinTableSize = 64;
+
+        // probes from hash until eq( value ) or an empty slot, returns the slot
+        template< typename TEq >
+        size_t probe( const std::vector< uint32_t > & table, uint32_t hash, TEq && eq )
+        {
+            auto mask = table.size() - 1;
+            for ( auto ii = hash & mask;; ii = ( ii + 1 ) & mask )
+            {
+                if ( ( table[ ii ] == CHierNameStore::kInvalid ) || eq( table[ ii ] ) )
+                    return ii;
+            }
+        }
+
+        // at most 3/4 full
+        bool needsGrowth( const std::vector< uint32_t > & table, size_t numEntries )
+        {
+            return ( ( numEntries + 1 ) * 4 ) > ( table.size() * 3 );
+        }
+    }
+
+    CHierNameStore::CHierNameStore( const std::string & hsc )
+    {
+        fDelims.add( hsc.data(), hsc.length() );
+        fDelims.add( '\\' );
+        if ( !hsc.empty() )
+            fSeparator = hsc[ 0 ];
+
+        fNodes.push_back( { kInvalid, kInvalid, 0 } );
+        fNodeTable.assign( kMinTableSize, kInvalid );
+        fSegmentTable.assign( kMinTableSize, kInvalid );
+    }
+
+    CHierNameStore::~CHierNameStore()
+    {
+    }
+
+    uint32_t CHierNameStore::nodeHash( TNameID parent, TSegmentID segment )
+    {
+        return static_cast< uint32_t >( NSIMDUtils::hashFinalize( NSIMDUtils::hashMix( parent, segment ) ) );
+    }
+
+    uint32_t CHierNameStore::segmentHash( std::string_view segment )
+    {
+        return static_cast< uint32_t >( NSIMDUtils::hashBytes( segment.data(), segment.length() ) );
+    }
+
+    bool CHierNameStore::nextSegment( std::string_view name, size_t & pos, std::string_view & segment ) const
+    {
+        while ( pos < name.length() )
+        {
+            auto start = pos;
+            auto end = name.length();
+            bool inEscape = false;
+            for ( auto curr = NSIMDUtils::findFirstOf( name.data(), name.length(), pos, fDelims ); curr != std::string::npos; curr = NSIMDUtils::findFirstOf( name.data(), name.length(), curr + 1, fDelims ) )
+            {
+                if ( name[ curr ] == '\\' )
+                    inEscape = !inEscape;
+                else if ( !inEscape )
+                {
+                    end = curr;
+                    break;
+                }
+            }
+
+            pos = end + 1;
+            if ( end > start )
+            {
+                segment = name.substr( start, end - start );
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const char * CHierNameStore::storeText( std::string_view segment )
+    {
+        if ( segment.length() > ( kChunkSize / 4 ) )
+        {
+            // large segments get their own chunk, inserted before the current one so it stays current
+            fTextBytes += segment.length();
+            auto chunk = std::make_unique< char[] >( segment.length() );
+            std::memcpy( chunk.get(), segment.data(), segment.length() );
+            auto retVal = chunk.get();
+            fChunks.insert( fChunks.empty() ? fChunks.end() : ( fChunks.end() - 1 ), std::move( chunk ) );
+            return retVal;
+        }
+
+        if ( fChunks.empty() || ( ( fChunkUsed + segment.length() ) > fChunkSize ) )
+        {
+            fTextBytes += kChunkSize;
+            fChunks.push_back( std::make_unique< char[] >( kChunkSize ) );
+            fChunkSize = kChunkSize;
+            fChunkUsed = 0;
+        }
+        auto retVal = fChunks.back().get() + fChunkUsed;
+        std::memcpy( retVal, segment.data(), segment.length() );
+        fChunkUsed += segment.length();
+        return retVal;
+    }
+
+    CHierNameStore::TSegmentID CHierNameStore::findSegment( std::string_view segment ) const
+    {
+        auto hash = segmentHash( segment );
+        auto slot = probe( fSegmentTable, hash,
+            [ this, hash, segment ]( uint32_t id )
+            {
+                return ( fSegments[ id ].fHash == hash ) && ( this->segment( id ) == segment );
+            } );
+        return fSegmentTable[ slot ];
+    }
+
+    CHierNameStore::TSegmentID CHierNameStore::addSegment( std::string_view segment )
+    {
+        auto retVal = findSegment( segment );
+        if ( retVal != kInvalid )
+            return retVal;
+
+        if ( needsGrowth( fSegmentTable, fSegments.size() ) )
+            growSegmentTable();
+
+        auto hash = segmentHash( segment );
+        retVal = static_cast< TSegmentID >( fSegments.size() );
+        fSegments.push_back( { storeText( segment ), static_cast< uint32_t >( segment.length() ), hash } );
+        fSegmentTable[ probe( fSegmentTable, hash, []( uint32_t ) { return false; } ) ] = retVal;
+        return retVal;
+    }
+
+    void CHierNameStore::growSegmentTable()
+    {
+        fSegmentTable.assign( fSegmentTable.size() * 2, kInvalid );
+        for ( uint32_t ii = 0; ii < fSegments.size(); ++ii )
+            fSegmentTable[ probe( fSegmentTable, fSegments[ ii ].fHash, []( uint32_t ) { return false; } ) ] = ii;
+    }
+
+    void CHierNameStore::growNodeTable()
+    {
+        fNodeTable.assign( fNodeTable.size() * 2, kInvalid );
+        for ( uint32_t ii = 1; ii < fNodes.size(); ++ii )
+            fNodeTable[ probe( fNodeTable, nodeHash( fNodes[ ii ].fParent, fNodes[ ii ].fSegment ), []( uint32_t ) { return false; } ) ] = ii;
+    }
+
+    CHierNameStore::TNameID CHierNameStore::findChild( TNameID parent, std::string_view segment ) const
+    {
+        auto segmentID = findSegment( segment );
+        if ( segmentID == kInvalid )
+            return kInvalid;
+
+        auto slot = probe( fNodeTable, nodeHash( parent, segmentID ),
+            [ this, parent, segmentID ]( uint32_t id )
+            {
+                return ( fNodes[ id ].fParent == parent ) && ( fNodes[ id ].fSegment == segmentID );
+            } );
+        return fNodeTable[ slot ];
+    }
+
+    CHierNameStore::TNameID CHierNameStore::addChild( TNameID parent, std::string_view segment )
+    {
+        auto segmentID = addSegment( segment );
+        auto hash = nodeHash( parent, segmentID );
+        auto slot = probe( fNodeTable, hash,
+            [ this, parent, segmentID ]( uint32_t id )
+            {
+                return ( fNodes[ id ].fParent == parent ) && ( fNodes[ id ].fSegment == segmentID );
+            } );
+        if ( fNodeTable[ slot ] != kInvalid )
+            return fNodeTable[ slot ];
+
+        auto retVal = static_cast< TNameID >( fNodes.size() );
+        fNodes.push_back( { parent, segmentID, fNodes[ parent ].fDepth + 1 } );
+        if ( needsGrowth( fNodeTable, fNodes.size() - 1 ) )
+            growNodeTable();
+        else
+            fNodeTable[ slot ] = retVal;
+        return retVal;
+    }
+
+    CHierNameStore::TNameID CHierNameStore::add( std::string_view name )
+    {
+        TNameID retVal = kRoot;
+        size_t pos = 0;
+        std::string_view segment;
+        while ( nextSegment( name, pos, segment ) )
+            retVal = addChild( retVal, segment );
+        return retVal;
+    }
+
+    CHierNameStore::TNameID CHierNameStore::find( std::string_view name ) const
+    {
+        TNameID retVal = kRoot;
+        size_t pos = 0;
+        std::string_view segment;
+        while ( ( retVal != kInvalid ) && nextSegment( name, pos, segment ) )
+            retVal = findChild( retVal, segment );
+        return retVal;
+    }
+
+    CHierNameStore::TNameID CHierNameStore::findLongestPrefix( std::string_view name ) const
+    {
+        TNameID retVal = kRoot;
+        size_t pos = 0;
+        std::string_view segment;
+        while ( nextSegment( name, pos, segment ) )
+        {
+            auto child = findChild( retVal, segment );
+            if ( child == kInvalid )
+                break;
+            retVal = child;
+        }
+        return retVal;
+    }
+
+    CHierNameStore::TNameID CHierNameStore::ancestor( TNameID id, size_t depth ) const
+    {
+        if ( fNodes[ id ].fDepth < depth )
+            return kInvalid;
+        while ( fNodes[ id ].fDepth > depth )
+            id = fNodes[ id ].fParent;
+        return id;
+    }
+
+    bool CHierNameStore::isPrefixOf( TNameID prefix, TNameID id ) const
+    {
+        return ancestor( id, fNodes[ prefix ].fDepth ) == prefix;
+    }
+
+    std::vector< CHierNameStore::TSegmentID > CHierNameStore::path( TNameID id ) const
+    {
+        std::vector< TSegmentID > retVal( fNodes[ id ].fDepth );
+        for ( auto ii = retVal.size(); ii > 0; --ii, id = fNodes[ id ].fParent )
+            retVal[ ii - 1 ] = fNodes[ id ].fSegment;
+        return retVal;
+    }
+
+    void CHierNameStore::appendTo( std::string & out, TNameID id, char separator ) const
+    {
+        if ( id == kRoot )
+            return;
+        if ( !separator )
+            separator = fSeparator;
+
+        size_t length = fNodes[ id ].fDepth - 1;
+        for ( auto ii = id; ii != kRoot; ii = fNodes[ ii ].fParent )
+            length += fSegments[ fNodes[ ii ].fSegment ].fLength;
+
+        // filled in from the leaf backwards
+        auto start = out.length();
+        out.resize( start + length );
+        auto curr = &out[ 0 ] + start + length;
+        for ( auto ii = id; ii != kRoot; ii = fNodes[ ii ].fParent )
+        {
+            auto && segment = fSegments[ fNodes[ ii ].fSegment ];
+            curr -= segment.fLength;
+            std::memcpy( curr, segment.fData, segment.fLength );
+            if ( fNodes[ ii ].fParent != kRoot )
+                *--curr = separator;
+        }
+    }
+
+    std::string CHierNameStore::toString( TNameID id, char separator ) const
+    {
+        std::string retVal;
+        appendTo( retVal, id, separator );
+        return retVal;
+    }
+
+    size_t CHierNameStore::memoryUsage() const
+    {
+        return sizeof( *this )
+            + fNodes.capacity() * sizeof( SNode )
+            + fNodeTable.capacity() * sizeof( uint32_t )
+            + fSegments.capacity() * sizeof( SSegment )
+            + fSegmentTable.capacity() * sizeof( uint32_t )
+            + fChunks.capacity() * sizeof( std::unique_ptr< char[] > )
+            + fTextBytes;
+    }
+}
@@ -0,0 +1,128 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __HIERNAMESTORE_H
+#define __HIERNAMESTORE_H
+
+#include "SIMDUtils.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NStringUtils
+{
+    // Interned store of hierarchical instance names
+    // Every path segment is stored once, a name is a node in a trie of ( parent, segment ) pairs,
+    // so a name costs a 12 byte node plus one hash slot no matter how deep it is.
+    //
+    // Names are split on the hierarchy separators outside of \escaped\ identifiers (the same rules
+    // as findSeparator), empty segments are skipped, escaped segments keep their backslashes.
+    // Lookups are O(depth) and never allocate.  Views returned by segment()/leaf() stay valid for
+    // the lifetime of the store.
+    class CHierNameStore
+    {
+    public:
+        using TNameID = uint32_t;
+        using TSegmentID = uint32_t;
+        static constexpr uint32_t kInvalid = UINT32_MAX;
+        static constexpr TNameID kRoot = 0; // the empty name, parent of every top level name
+
+        // hsc is the set of hierarchy separators, the first one is used by toString
+        explicit CHierNameStore( const std::string & hsc = "/" );
+        ~CHierNameStore();
+
+        TNameID add( std::string_view name );
+        TNameID addChild( TNameID parent, std::string_view segment );
+
+        // kInvalid when not in the store
+        TNameID find( std::string_view name ) const;
+        TNameID findChild( TNameID parent, std::string_view segment ) const;
+        // the deepest stored name that is a leading sequence of segments of name, kRoot if none
+        TNameID findLongestPrefix( std::string_view name ) const;
+
+        TNameID parent( TNameID id ) const { return fNodes[ id ].fParent; }
+        size_t depth( TNameID id ) const { return fNodes[ id ].fDepth; }
+        // the ancestor of id at the given depth, kInvalid when depth( id ) < depth
+        TNameID ancestor( TNameID id, size_t depth ) const;
+        // true when prefix is id or one of its ancestors
+        bool isPrefixOf( TNameID prefix, TNameID id ) const;
+
+        TSegmentID leafSegment( TNameID id ) const { return fNodes[ id ].fSegment; }
+        std::string_view leaf( TNameID id ) const { return ( id == kRoot ) ? std::string_view() : segment( leafSegment( id ) ); }
+        std::string_view segment( TSegmentID id ) const { return std::string_view( fSegments[ id ].fData, fSegments[ id ].fLength ); }
+        TSegmentID findSegment( std::string_view segment ) const;
+        // the segments of id, top level first
+        std::vector< TSegmentID > path( TNameID id ) const;
+
+        void setSeparator( char separator ) { fSeparator = separator; }
+        char separator() const { return fSeparator; }
+        // a separator of 0 uses separator()
+        std::string toString( TNameID id, char separator = 0 ) const;
+        void appendTo( std::string & out, TNameID id, char separator = 0 ) const;
+
+        size_t numNames() const { return fNodes.size() - 1; }
+        size_t numSegments() const { return fSegments.size(); }
+        size_t memoryUsage() const;
+
+        // splits name one segment at a time starting at pos, see the class comment for the rules
+        bool nextSegment( std::string_view name, size_t & pos, std::string_view & segment ) const;
+    private:
+        struct SNode
+        {
+            TNameID fParent;
+            TSegmentID fSegment;
+            uint32_t fDepth;
+        };
+        struct SSegment
+        {
+            const char * fData;
+            uint32_t fLength;
+            uint32_t fHash;
+        };
+
+        static uint32_t nodeHash( TNameID parent, TSegmentID segment );
+        static uint32_t segmentHash( std::string_view segment );
+        TSegmentID addSegment( std::string_view segment );
+        const char * storeText( std::string_view segment );
+        void growSegmentTable();
+        void growNodeTable();
+
+        NSIMDUtils::CByteSet fDelims; // the separators and the escape character
+        char fSeparator{ '/' };
+
+        std::vector< SNode > fNodes;
+        std::vector< uint32_t > fNodeTable; // open addressing, name ids keyed by ( parent, segment )
+
+        std::vector< SSegment > fSegments;
+        std::vector< uint32_t > fSegmentTable; // open addressing, segment ids keyed by text
+
+        std::vector< std::unique_ptr< char[] > > fChunks;
+        size_t fChunkUsed{ 0 };
+        size_t fChunkSize{ 0 };
+        size_t fTextBytes{ 0 }; // allocated chunk bytes
+    };
+}
+
+#endif
@@ -0,0 +1,52 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef __HTMLENTITIES_H
+#define __HTMLENTITIES_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace NStringUtils
+{
+    // HTML5 named character references (the ones ending in ';', which covers every XML and
+    // HTML 4 entity) and the numeric &#NNN; and &#xHH; forms
+    // Anything else, including an invalid code point or a missing ';', is left as is.
+
+    // the code points of a named entity (without the '&' and ';'), 0 for none
+    // a few names are two code points, second is 0 for the others
+    bool htmlEntity( std::string_view name, char32_t & first, char32_t & second );
+
+    // &nGt; and &nLt; are the only entities longer decoded than encoded, in UTF-8
+    inline size_t maxHtmlDecodedLength( size_t len ) { return len + len / 5; }
+
+    // single pass into a caller allocated out, returns the decoded length
+    size_t decodeHtmlEntities( const char * in, size_t len, char * out ); // UTF-8, out holds maxHtmlDecodedLength( len )
+    size_t decodeHtmlEntities( const char16_t * in, size_t len, char16_t * out ); // UTF-16, out holds len
+
+    // str itself when there is no '&', otherwise buffer holding the decoded string
+    const std::string & fromHtmlEscaped( const std::string & str, std::string & buffer );
+    std::string fromHtmlEscaped( const std::string & str );
+}
+#endif
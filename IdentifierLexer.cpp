@@ -0,0 +1,324 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "IdentifierLexer.h"
+#include "SIMDUtils.h"
+
+#include <cstring>
+
+namespace NStringUtils
+{
+    namespace
+    {
+        enum EByteClass : uint8_t
+        {
+            eStart = 0x01, // starts an identifier
+            eChar = 0x02, // continues an identifier
+            eSpace = 0x04,
+            eDigit = 0x08, // starts a number
+            eNumber = 0x10 // continues a number
+        };
+    }
+
+    CIdentifierLexer::CIdentifierLexer( EHDLSyntax syntax ) :
+        fSyntax( syntax )
+    {
+        std::memset( fClasses, 0, sizeof( fClasses ) );
+        for ( int ii = 0; ii < 26; ++ii )
+        {
+            fClasses[ 'a' + ii ] = eStart | eChar | eNumber;
+            fClasses[ 'A' + ii ] = eStart | eChar | eNumber;
+        }
+        for ( int ii = 0; ii < 10; ++ii )
+            fClasses[ '0' + ii ] = eChar | eDigit | eNumber;
+        for ( auto ch : { ' ', '\t', '\n', '\r', '\f', '\v' } )
+            fClasses[ static_cast< unsigned char >( ch ) ] = eSpace;
+        fClasses[ '_' ] = eChar | eNumber;
+        fClasses[ '.' ] = eNumber;
+        if ( fSyntax == EHDLSyntax::eVerilog )
+        {
+            fClasses[ '_' ] |= eStart;
+            fClasses[ '$' ] = eStart | eChar | eNumber;
+        }
+        else
+            fClasses[ '#' ] = eNumber; // 16#FF#
+    }
+
+    size_t CIdentifierLexer::skipIdentifierChars( const char * data, size_t len, size_t pos ) const
+    {
+#ifdef SAB_HAS_SSE2
+        auto withDollar = ( fSyntax == EHDLSyntax::eVerilog );
+        for ( ; ( pos + 16 ) <= len; pos += 16 )
+        {
+            auto block = _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + pos ) );
+            auto lower = _mm_or_si128( block, _mm_set1_epi8( 0x20 ) );
+            auto isLetter = _mm_and_si128( _mm_cmpgt_epi8( lower, _mm_set1_epi8( 'a' - 1 ) ), _mm_cmplt_epi8( lower, _mm_set1_epi8( 'z' + 1 ) ) );
+            auto isDigit = _mm_and_si128( _mm_cmpgt_epi8( block, _mm_set1_epi8( '0' - 1 ) ), _mm_cmplt_epi8( block, _mm_set1_epi8( '9' + 1 ) ) );
+            auto isChar = _mm_or_si128( _mm_or_si128( isLetter, isDigit ), _mm_cmpeq_epi8( block, _mm_set1_epi8( '_' ) ) );
+            if ( withDollar )
+                isChar = _mm_or_si128( isChar, _mm_cmpeq_epi8( block, _mm_set1_epi8( '$' ) ) );
+            auto others = ~static_cast< uint32_t >( _mm_movemask_epi8( isChar ) ) & 0xFFFF;
+            if ( others )
+                return pos + NSIMDUtils::countTrailingZeros( others );
+        }
+#endif
+        while ( ( pos < len ) && ( fClasses[ static_cast< unsigned char >( data[ pos ] ) ] & eChar ) )
+            pos++;
+        return pos;
+    }
+
+    size_t CIdentifierLexer::skipSpaces( const char * data, size_t len, size_t pos ) const
+    {
+#ifdef SAB_HAS_SSE2
+        // indentation and blank lines, \f and \v are left to the loop below
+        for ( ; ( pos + 16 ) <= len; pos += 16 )
+        {
+            auto block = _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + pos ) );
+            auto isSpace = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( block, _mm_set1_epi8( ' ' ) ), _mm_cmpeq_epi8( block, _mm_set1_epi8( '\t' ) ) ),
+                                         _mm_or_si128( _mm_cmpeq_epi8( block, _mm_set1_epi8( '\n' ) ), _mm_cmpeq_epi8( block, _mm_set1_epi8( '\r' ) ) ) );
+            auto others = ~static_cast< uint32_t >( _mm_movemask_epi8( isSpace ) ) & 0xFFFF;
+            if ( others )
+            {
+                pos += NSIMDUtils::countTrailingZeros( others );
+                break;
+            }
+        }
+#endif
+        while ( ( pos < len ) && ( fClasses[ static_cast< unsigned char >( data[ pos ] ) ] & eSpace ) )
+            pos++;
+        return pos;
+    }
+
+    // data[ pos ] is a '\', 0 when it does not start an escaped (extended) identifier
+    size_t CIdentifierLexer::escapedLength( const char * data, size_t len, size_t pos ) const
+    {
+        if ( fSyntax == EHDLSyntax::eVerilog )
+        {
+            auto end = pos + 1;
+            while ( ( end < len ) && !( fClasses[ static_cast< unsigned char >( data[ end ] ) ] & eSpace ) )
+                end++;
+            return ( end == ( pos + 1 ) ) ? 0 : ( end - pos );
+        }
+
+        for ( auto ii = pos + 1; ii < len; ++ii )
+        {
+            if ( ( data[ ii ] == '\n' ) || ( data[ ii ] == '\r' ) )
+                return 0;
+            if ( data[ ii ] != '\\' )
+                continue;
+            if ( ( ( ii + 1 ) < len ) && ( data[ ii + 1 ] == '\\' ) )
+            {
+                ii++;
+                continue;
+            }
+            return ( ii == ( pos + 1 ) ) ? 0 : ( ii + 1 - pos );
+        }
+        return 0;
+    }
+
+    // data[ pos ] is a '"', an unterminated string ends with its line
+    size_t CIdentifierLexer::skipString( const char * data, size_t len, size_t pos ) const
+    {
+        for ( auto ii = pos + 1; ii < len; ++ii )
+        {
+            auto ch = data[ ii ];
+            if ( ch == '\n' )
+                return ii;
+            if ( ( ch == '\\' ) && ( fSyntax == EHDLSyntax::eVerilog ) )
+                ii++;
+            else if ( ch == '"' )
+            {
+                if ( ( fSyntax == EHDLSyntax::eVHDL ) && ( ( ii + 1 ) < len ) && ( data[ ii + 1 ] == '"' ) )
+                    ii++;
+                else
+                    return ii + 1;
+            }
+        }
+        return len;
+    }
+
+    // data[ pos ] is a digit, the rest of the number including units and exponent letters
+    size_t CIdentifierLexer::skipNumber( const char * data, size_t len, size_t pos ) const
+    {
+        while ( ( pos < len ) && ( fClasses[ static_cast< unsigned char >( data[ pos ] ) ] & eNumber ) )
+            pos++;
+        return pos;
+    }
+
+    // data[ pos ] is a '\''
+    size_t CIdentifierLexer::skipTick( const char * data, size_t len, size_t pos ) const
+    {
+        if ( fSyntax == EHDLSyntax::eVHDL )
+        {
+            // after a name or ')' it is an attribute or qualified expression, otherwise 'c' a character literal
+            bool afterName = ( pos > 0 ) && ( ( fClasses[ static_cast< unsigned char >( data[ pos - 1 ] ) ] & eChar ) || ( data[ pos - 1 ] == ')' ) );
+            if ( !afterName && ( ( pos + 2 ) < len ) && ( data[ pos + 2 ] == '\'' ) )
+                return pos + 3;
+            return pos + 1;
+        }
+
+        // 'hFF, 'sb1, 'h FF, and the unbased unsized '0 '1 'x 'z
+        auto ii = pos + 1;
+        if ( ( ii < len ) && ( ( data[ ii ] == 's' ) || ( data[ ii ] == 'S' ) ) )
+            ii++;
+        if ( ( ii < len ) && data[ ii ] && std::strchr( "bBoOdDhH", data[ ii ] ) )
+        {
+            ii++;
+            while ( ( ii < len ) && ( ( data[ ii ] == ' ' ) || ( data[ ii ] == '\t' ) ) )
+                ii++;
+            while ( ( ii < len ) && ( ( fClasses[ static_cast< unsigned char >( data[ ii ] ) ] & eChar ) || ( data[ ii ] == '?' ) ) )
+                ii++;
+            return ii;
+        }
+        ii = pos + 1;
+        if ( ( ii < len ) && data[ ii ] && std::strchr( "01xXzZ", data[ ii ] ) && ( ( ( ii + 1 ) >= len ) || !( fClasses[ static_cast< unsigned char >( data[ ii + 1 ] ) ] & eChar ) ) )
+            return ii + 1;
+        return pos + 1;
+    }
+
+    bool CIdentifierLexer::next( std::string_view text, size_t & pos, std::string_view & identifier ) const
+    {
+        auto data = text.data();
+        auto len = text.length();
+        while ( pos < len )
+        {
+            auto ch = data[ pos ];
+            auto cls = fClasses[ static_cast< unsigned char >( ch ) ];
+            if ( cls & eStart )
+            {
+                auto end = skipIdentifierChars( data, len, pos + 1 );
+                if ( ( fSyntax == EHDLSyntax::eVHDL ) && ( end < len ) && ( data[ end ] == '"' ) )
+                {
+                    pos = skipString( data, len, end ); // X"FF", a bit string literal
+                    continue;
+                }
+                if ( ( ch == '$' ) && ( end == ( pos + 1 ) ) )
+                {
+                    pos++; // q[$]
+                    continue;
+                }
+                identifier = text.substr( pos, end - pos );
+                pos = end;
+                return true;
+            }
+            if ( cls & eSpace )
+            {
+                pos = skipSpaces( data, len, pos );
+                continue;
+            }
+            if ( cls & eDigit )
+            {
+                pos = skipNumber( data, len, pos );
+                continue;
+            }
+
+            auto nextCh = ( ( pos + 1 ) < len ) ? data[ pos + 1 ] : '\0';
+            switch ( ch )
+            {
+                case '\\':
+                {
+                    auto idLen = escapedLength( data, len, pos );
+                    if ( idLen )
+                    {
+                        identifier = text.substr( pos, idLen );
+                        pos += idLen;
+                        return true;
+                    }
+                    pos++;
+                    break;
+                }
+                case '"':
+                    pos = skipString( data, len, pos );
+                    break;
+                case '\'':
+                    pos = skipTick( data, len, pos );
+                    break;
+                case '/':
+                    if ( nextCh == '*' )
+                    {
+                        auto end = text.find( "*/", pos + 2 );
+                        pos = ( end == std::string_view::npos ) ? len : ( end + 2 );
+                    }
+                    else if ( ( nextCh == '/' ) && ( fSyntax == EHDLSyntax::eVerilog ) )
+                    {
+                        auto end = text.find( '\n', pos + 2 );
+                        pos = ( end == std::string_view::npos ) ? len : end;
+                    }
+                    else
+                        pos++;
+                    break;
+                case '-':
+                    if ( ( nextCh == '-' ) && ( fSyntax == EHDLSyntax::eVHDL ) )
+                    {
+                        auto end = text.find( '\n', pos + 2 );
+                        pos = ( end == std::string_view::npos ) ? len : end;
+                    }
+                    else
+                        pos++;
+                    break;
+                default:
+                    pos++;
+                    break;
+            }
+        }
+        return false;
+    }
+
+    size_t CIdentifierLexer::tokenize( std::string_view text, std::vector< std::string_view > & identifiers ) const
+    {
+        auto start = identifiers.size();
+        size_t pos = 0;
+        std::string_view identifier;
+        while ( next( text, pos, identifier ) )
+            identifiers.push_back( identifier );
+        return identifiers.size() - start;
+    }
+
+    size_t CIdentifierLexer::count( std::string_view text ) const
+    {
+        size_t retVal = 0;
+        size_t pos = 0;
+        std::string_view identifier;
+        while ( next( text, pos, identifier ) )
+            retVal++;
+        return retVal;
+    }
+
+    size_t CIdentifierLexer::identifierLength( std::string_view text ) const
+    {
+        if ( text.empty() )
+            return 0;
+        auto ch = text[ 0 ];
+        if ( ch == '\\' )
+            return escapedLength( text.data(), text.length(), 0 );
+        if ( !( fClasses[ static_cast< unsigned char >( ch ) ] & eStart ) )
+            return 0;
+
+        auto end = skipIdentifierChars( text.data(), text.length(), 1 );
+        if ( ( fSyntax == EHDLSyntax::eVHDL ) && ( end < text.length() ) && ( text[ end ] == '"' ) )
+            return 0;
+        if ( ( ch == '$' ) && ( end == 1 ) )
+            return 0;
+        return end;
+    }
+}
@@ -0,0 +1,72 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef __IDENTIFIERLEXER_H
+#define __IDENTIFIERLEXER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace NStringUtils
+{
+    enum class EHDLSyntax
+    {
+        eVerilog,
+        eVHDL
+    };
+
+    // Finds the identifiers of Verilog/SystemVerilog or VHDL source, as views into the scanned text
+    //   Verilog: [A-Za-z_][A-Za-z0-9_$]*, $system_names, and escaped identifiers, '\' up to the next white space
+    //   VHDL:    letter ( letter | digit | '_' )*, and extended identifiers \...\ on one line, "\\" inside is one '\'
+    // Escaped and extended identifiers keep their backslashes. Comments, string literals and numbers
+    // (8'hFF, 'b0, 16#FF#, X"FF") are skipped. Bytes are classified with an ASCII table, never the locale.
+    class CIdentifierLexer
+    {
+    public:
+        explicit CIdentifierLexer( EHDLSyntax syntax = EHDLSyntax::eVerilog );
+
+        EHDLSyntax syntax() const { return fSyntax; }
+
+        // the next identifier at or after pos, pos is moved past it, false when there are no more
+        bool next( std::string_view text, size_t & pos, std::string_view & identifier ) const;
+        // batch mode, appends every identifier of text, returns the number appended
+        size_t tokenize( std::string_view text, std::vector< std::string_view > & identifiers ) const;
+        size_t count( std::string_view text ) const;
+
+        // the length of the identifier text starts with, 0 when it does not start with one
+        size_t identifierLength( std::string_view text ) const;
+    private:
+        size_t skipIdentifierChars( const char * data, size_t len, size_t pos ) const;
+        size_t skipSpaces( const char * data, size_t len, size_t pos ) const;
+        size_t escapedLength( const char * data, size_t len, size_t pos ) const;
+        size_t skipString( const char * data, size_t len, size_t pos ) const;
+        size_t skipNumber( const char * data, size_t len, size_t pos ) const;
+        size_t skipTick( const char * data, size_t len, size_t pos ) const;
+
+        EHDLSyntax fSyntax;
+        uint8_t fClasses[ 256 ];
+    };
+}
+#endif
@@ -0,0 +1,206 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "IntFormat.h"
+#include "SIMDUtils.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NStringUtils
+{
+    namespace
+    {
+        size_t bitsPerDigit( ERadix radix )
+        {
+            switch ( radix )
+            {
+                case ERadix::eBinary:
+                    return 1;
+                case ERadix::eOctal:
+                    return 3;
+                case ERadix::eHex:
+                default:
+                    return 4;
+            }
+        }
+
+        struct STables
+        {
+            STables()
+            {
+                for ( int ii = 0; ii < 256; ++ii )
+                {
+                    for ( int jj = 0; jj < 8; ++jj )
+                        fBin[ ii ][ jj ] = ( ( ii >> ( 7 - jj ) ) & 1 ) ? '1' : '0';
+                    fHex[ 0 ][ ii ][ 0 ] = "0123456789abcdef"[ ii >> 4 ];
+                    fHex[ 0 ][ ii ][ 1 ] = "0123456789abcdef"[ ii & 0x0F ];
+                    fHex[ 1 ][ ii ][ 0 ] = "0123456789ABCDEF"[ ii >> 4 ];
+                    fHex[ 1 ][ ii ][ 1 ] = "0123456789ABCDEF"[ ii & 0x0F ];
+                }
+                for ( int ii = 0; ii < 64; ++ii )
+                {
+                    fOct[ ii ][ 0 ] = static_cast< char >( '0' + ( ii >> 3 ) );
+                    fOct[ ii ][ 1 ] = static_cast< char >( '0' + ( ii & 7 ) );
+                }
+            }
+            char fBin[ 256 ][ 8 ];
+            char fHex[ 2 ][ 256 ][ 2 ]; // lower, upper case
+            char fOct[ 64 ][ 2 ];
+        };
+
+        const STables & tables()
+        {
+            static const STables sTables;
+            return sTables;
+        }
+
+        // at least 1, so 0 is formatted as one digit
+        size_t significantBits( uint64_t value )
+        {
+            return value ? ( 64 - NSIMDUtils::countLeadingZeros( value ) ) : 1;
+        }
+
+        // the digits of all the bits of a U into out, for the ( 16 / sizeof( U ) ) values of one block
+        // out holds 128 characters, the vector path writes all of them even for a partial block
+        template< typename U >
+        void renderBlock( const U * values, size_t count, U mask, const SIntFormat & format, char * out )
+        {
+            auto && table = tables();
+            if ( format.fRadix == ERadix::eOctal )
+            {
+                auto numDigits = numRadixDigits( ERadix::eOctal, sizeof( U ) * 8 );
+                for ( size_t ii = 0; ii < count; ++ii )
+                {
+                    uint64_t value = values[ ii ] & mask;
+                    auto pos = ( ii + 1 ) * numDigits;
+                    for ( ; ( pos - ii * numDigits ) >= 2; pos -= 2, value >>= 6 )
+                        std::memcpy( out + pos - 2, table.fOct[ value & 0x3F ], 2 );
+                    if ( pos > ii * numDigits )
+                        out[ pos - 1 ] = static_cast< char >( '0' + ( value & 7 ) );
+                }
+                return;
+            }
+
+#ifdef SAB_HAS_SSE2
+            U lanes[ 16 / sizeof( U ) ] = {};
+            U masks[ 16 / sizeof( U ) ];
+            std::memcpy( lanes, values, count * sizeof( U ) );
+            std::fill( masks, masks + ( 16 / sizeof( U ) ), mask );
+            auto block = _mm_and_si128( _mm_loadu_si128( reinterpret_cast< const __m128i * >( lanes ) ), _mm_loadu_si128( reinterpret_cast< const __m128i * >( masks ) ) );
+            block = NSIMDUtils::byteSwapLanes( block, sizeof( U ) );
+            if ( format.fRadix == ERadix::eHex )
+                NSIMDUtils::writeHexDigits( block, out, format.fUpperCase );
+            else
+                NSIMDUtils::writeBinDigits( block, out );
+#else
+            auto && hex = table.fHex[ format.fUpperCase ? 1 : 0 ];
+            for ( size_t ii = 0; ii < count; ++ii )
+            {
+                uint64_t value = values[ ii ] & mask;
+                for ( size_t jj = sizeof( U ); jj > 0; --jj )
+                {
+                    auto byte = ( value >> ( ( jj - 1 ) * 8 ) ) & 0xFF;
+                    if ( format.fRadix == ERadix::eHex )
+                        out = std::copy( hex[ byte ], hex[ byte ] + 2, out );
+                    else
+                        out = std::copy( table.fBin[ byte ], table.fBin[ byte ] + 8, out );
+                }
+            }
+#endif
+        }
+
+        template< typename U >
+        size_t formatValues( const U * values, size_t count, const SIntFormat & format, char * out )
+        {
+            const size_t typeBits = sizeof( U ) * 8;
+            const size_t blockSize = 16 / sizeof( U );
+            auto numBits = ( format.fNumBits && ( format.fNumBits < typeBits ) ) ? format.fNumBits : typeBits;
+            auto mask = ( numBits < typeBits ) ? static_cast< U >( ( uint64_t( 1 ) << numBits ) - 1 ) : static_cast< U >( ~U( 0 ) );
+            auto fullDigits = numRadixDigits( format.fRadix, typeBits );
+            auto fixedDigits = numRadixDigits( format.fRadix, numBits );
+            // nothing between the digits, whole blocks go straight to out
+            auto contiguous = !format.fMinimalWidth && format.fPrefix.empty() && format.fSeparator.empty() && ( fixedDigits == fullDigits );
+
+            auto start = out;
+            char scratch[ 128 ];
+            for ( size_t ii = 0; ii < count; ii += blockSize )
+            {
+                auto numValues = std::min( blockSize, count - ii );
+                if ( contiguous && ( numValues == blockSize ) )
+                {
+                    renderBlock( values + ii, numValues, mask, format, out );
+                    out += numValues * fullDigits;
+                    continue;
+                }
+
+                renderBlock( values + ii, numValues, mask, format, scratch );
+                for ( size_t jj = 0; jj < numValues; ++jj )
+                {
+                    if ( ( ii + jj ) && !format.fSeparator.empty() )
+                        out = std::copy( format.fSeparator.begin(), format.fSeparator.end(), out );
+                    out = std::copy( format.fPrefix.begin(), format.fPrefix.end(), out );
+
+                    auto numDigits = format.fMinimalWidth ? numRadixDigits( format.fRadix, significantBits( values[ ii + jj ] & mask ) ) : fixedDigits;
+                    auto digits = scratch + ( jj + 1 ) * fullDigits - numDigits;
+                    out = std::copy( digits, digits + numDigits, out );
+                }
+            }
+            return static_cast< size_t >( out - start );
+        }
+    }
+
+    size_t numRadixDigits( ERadix radix, size_t numBits )
+    {
+        auto digitBits = bitsPerDigit( radix );
+        return ( numBits + digitBits - 1 ) / digitBits;
+    }
+
+    size_t maxFormattedLength( size_t count, size_t typeBits, const SIntFormat & format )
+    {
+        if ( !count )
+            return 0;
+        auto numBits = ( format.fNumBits && ( format.fNumBits < typeBits ) ) ? format.fNumBits : typeBits;
+        return count * ( format.fPrefix.length() + numRadixDigits( format.fRadix, numBits ) ) + ( count - 1 ) * format.fSeparator.length();
+    }
+
+    size_t formatIntegers( const uint8_t * values, size_t count, const SIntFormat & format, char * out )
+    {
+        return formatValues( values, count, format, out );
+    }
+
+    size_t formatIntegers( const uint16_t * values, size_t count, const SIntFormat & format, char * out )
+    {
+        return formatValues( values, count, format, out );
+    }
+
+    size_t formatIntegers( const uint32_t * values, size_t count, const SIntFormat & format, char * out )
+    {
+        return formatValues( values, count, format, out );
+    }
+
+    size_t formatIntegers( const uint64_t * values, size_t count, const SIntFormat & format, char * out )
+    {
+        return formatValues( values, count, format, out );
+    }
+}
@@ -0,0 +1,92 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef __INTFORMAT_H
+#define __INTFORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace NStringUtils
+{
+    // Formats arrays of integers as binary, octal or hex text into one caller allocated buffer.
+    // Binary and hex are converted a 16 byte block of values at a time (SSE2 when available),
+    // octal digits come from a table, 2 digits per lookup.
+    enum class ERadix
+    {
+        eBinary,
+        eOctal,
+        eHex
+    };
+
+    struct SIntFormat
+    {
+        ERadix fRadix{ ERadix::eHex };
+        size_t fNumBits{ 0 }; // the low bits of every value that are formatted, 0 for all the bits of the type
+        bool fMinimalWidth{ false }; // leading zeros removed (but at least one digit), otherwise every value is padded to the width of fNumBits
+        bool fUpperCase{ true };
+        std::string_view fPrefix; // before every value, e.g. "0x"
+        std::string_view fSeparator; // between the values, e.g. "\n"
+    };
+
+    // digits of a numBits wide value
+    size_t numRadixDigits( ERadix radix, size_t numBits );
+    // buffer size needed to format count values of a typeBits wide type
+    size_t maxFormattedLength( size_t count, size_t typeBits, const SIntFormat & format );
+
+    // the kernels, signed values are formatted as their two's complement bits
+    size_t formatIntegers( const uint8_t * values, size_t count, const SIntFormat & format, char * out );
+    size_t formatIntegers( const uint16_t * values, size_t count, const SIntFormat & format, char * out );
+    size_t formatIntegers( const uint32_t * values, size_t count, const SIntFormat & format, char * out );
+    size_t formatIntegers( const uint64_t * values, size_t count, const SIntFormat & format, char * out );
+
+    // out holds maxFormattedLength( count, bits of T, format ), returns the number of characters written
+    template< typename T >
+    size_t formatIntegers( const T * values, size_t count, const SIntFormat & format, char * out )
+    {
+        static_assert( std::is_integral< T >::value && !std::is_same< T, bool >::value, "formatIntegers requires an integral type" );
+        using TLane = std::conditional_t< sizeof( T ) == 1, uint8_t, std::conditional_t< sizeof( T ) == 2, uint16_t, std::conditional_t< sizeof( T ) == 4, uint32_t, uint64_t > > >;
+        static_assert( sizeof( TLane ) == sizeof( T ), "formatIntegers requires a 8, 16, 32 or 64 bit type" );
+        return formatIntegers( reinterpret_cast< const TLane * >( values ), count, format, out );
+    }
+
+    template< typename T >
+    void appendIntegers( std::string & out, const T * values, size_t count, const SIntFormat & format )
+    {
+        auto start = out.length();
+        out.resize( start + maxFormattedLength( count, sizeof( T ) * 8, format ) );
+        out.resize( start + formatIntegers( values, count, format, &out[ start ] ) );
+    }
+
+    template< typename T >
+    std::string formatIntegers( const T * values, size_t count, const SIntFormat & format )
+    {
+        std::string retVal;
+        appendIntegers( retVal, values, count, format );
+        return retVal;
+    }
+}
+#endif
@@ -0,0 +1,323 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "LineReader.h"
+#include "SIMDUtils.h"
+
+#include <QFile>
+#include <algorithm>
+#include <cstring>
+
+namespace NFileUtils
+{
+    namespace
+    {
+        // large enough that pipes are drained with few system calls
+        const int64_t kReadBlockSize = 1024 * 1024;
+
+        std::string_view stripCR( std::string_view line )
+        {
+            if ( !line.empty() && ( line.back() == '\r' ) )
+                line.remove_suffix( 1 );
+            return line;
+        }
+
+        bool isBlank( char ch )
+        {
+            return ( ch == ' ' ) || ( ch == '\t' ) || ( ch == '\r' ) || ( ch == '\n' );
+        }
+    }
+
+    CLineReader::CLineReader()
+    {
+    }
+
+    CLineReader::CLineReader( std::string_view text ) :
+        fData( text ),
+        fOpen( true )
+    {
+    }
+
+    CLineReader::~CLineReader()
+    {
+        close();
+    }
+
+    void CLineReader::close()
+    {
+        if ( fFile )
+        {
+            // unmapped by the close
+            fFile->close();
+            fFile.reset();
+        }
+        fBuffer.clear();
+        fData = std::string_view();
+        fOpen = false;
+        fMapped = false;
+        fIndexBuilt = false;
+        fLineStarts.clear();
+        rewind();
+    }
+
+    bool CLineReader::open( const std::string & fileName, std::string * msg )
+    {
+        close();
+        fFile = std::make_unique< QFile >( QString::fromStdString( fileName ) );
+        if ( !fFile->open( QIODevice::ReadOnly | QIODevice::Unbuffered ) )
+        {
+            if ( msg )
+                *msg = "Could not open '" + fileName + "': " + fFile->errorString().toStdString();
+            fFile.reset();
+            return false;
+        }
+        return openFile( 0, msg );
+    }
+
+    bool CLineReader::open( FILE * fp, std::string * msg )
+    {
+        close();
+        if ( !fp )
+        {
+            if ( msg )
+                *msg = "Invalid file handle";
+            return false;
+        }
+
+        auto offset = std::ftell( fp );
+        fFile = std::make_unique< QFile >();
+        if ( !fFile->open( fp, QIODevice::ReadOnly | QIODevice::Unbuffered, QFileDevice::DontCloseHandle ) )
+        {
+            if ( msg )
+                *msg = "Could not open file handle: " + fFile->errorString().toStdString();
+            fFile.reset();
+            return false;
+        }
+        return openFile( ( offset > 0 ) ? offset : 0, msg );
+    }
+
+    bool CLineReader::openFile( int64_t offset, std::string * msg )
+    {
+        fOpen = true;
+        if ( !fFile->isSequential() )
+        {
+            auto size = fFile->size() - offset;
+            if ( size <= 0 )
+                return true;
+
+            auto mapped = fFile->map( offset, size );
+            if ( mapped )
+            {
+                fMapped = true;
+                fData = std::string_view( reinterpret_cast< const char * >( mapped ), static_cast< size_t >( size ) );
+                return true;
+            }
+            // some file systems can not be mapped, read it instead
+            fFile->seek( offset );
+        }
+        return readAll( msg );
+    }
+
+    bool CLineReader::readAll( std::string * msg )
+    {
+        size_t size = 0;
+        while ( true )
+        {
+            fBuffer.resize( size + kReadBlockSize );
+            auto numRead = fFile->read( &fBuffer[ size ], kReadBlockSize );
+            if ( numRead < 0 )
+            {
+                if ( msg )
+                    *msg = "Error reading '" + fFile->fileName().toStdString() + "': " + fFile->errorString().toStdString();
+                fBuffer.clear();
+                fOpen = false;
+                return false;
+            }
+            size += static_cast< size_t >( numRead );
+            if ( !numRead )
+                break;
+        }
+        fBuffer.resize( size );
+        fBuffer.shrink_to_fit();
+        fData = fBuffer;
+        return true;
+    }
+
+    void CLineReader::rewind()
+    {
+        fPos = 0;
+        fCurrLine = 1;
+        fCurrLineStart = 0;
+        fLineNumber = 0;
+        fColumn = 0;
+    }
+
+    void CLineReader::newLineAt( size_t pos )
+    {
+        fPos = pos + 1;
+        fCurrLine++;
+        fCurrLineStart = fPos;
+    }
+
+    bool CLineReader::nextLine( std::string_view & line )
+    {
+        if ( atEnd() )
+            return false;
+
+        fLineNumber = fCurrLine;
+        fColumn = fPos - fCurrLineStart + 1;
+
+        auto end = static_cast< const char * >( std::memchr( fData.data() + fPos, '\n', fData.length() - fPos ) );
+        if ( !end )
+        {
+            line = stripCR( fData.substr( fPos ) );
+            fPos = fData.length();
+            return true;
+        }
+
+        auto endPos = static_cast< size_t >( end - fData.data() );
+        line = stripCR( fData.substr( fPos, endPos - fPos ) );
+        newLineAt( endPos );
+        return true;
+    }
+
+    bool CLineReader::nextToken( std::string_view & token )
+    {
+        static const NSIMDUtils::CByteSet sTokenEnd( " \t\r\n/", 5 );
+        auto len = fData.length();
+        while ( fPos < len )
+        {
+            auto ch = fData[ fPos ];
+            if ( isBlank( ch ) )
+            {
+                if ( ch == '\n' )
+                    newLineAt( fPos );
+                else
+                    fPos++;
+                continue;
+            }
+
+            if ( ( ch == '/' ) && ( ( fPos + 1 ) < len ) && ( fData[ fPos + 1 ] == '/' ) )
+            {
+                auto end = static_cast< const char * >( std::memchr( fData.data() + fPos, '\n', len - fPos ) );
+                if ( !end )
+                    fPos = len;
+                else
+                    newLineAt( static_cast< size_t >( end - fData.data() ) );
+                continue;
+            }
+
+            // a single '/' is part of the token, only "//" ends it
+            auto end = fPos;
+            do
+            {
+                end = NSIMDUtils::findFirstOf( fData.data(), len, end + 1, sTokenEnd );
+            }
+            while ( ( end != std::string::npos ) && ( fData[ end ] == '/' ) && ( ( ( end + 1 ) >= len ) || ( fData[ end + 1 ] != '/' ) ) );
+            if ( end == std::string::npos )
+                end = len;
+
+            token = fData.substr( fPos, end - fPos );
+            fLineNumber = fCurrLine;
+            fColumn = fPos - fCurrLineStart + 1;
+            fPos = end;
+            return true;
+        }
+        return false;
+    }
+
+    void CLineReader::buildLineIndex()
+    {
+        if ( fIndexBuilt )
+            return;
+
+        fIndexBuilt = true;
+        fLineStarts.clear();
+        if ( fData.empty() )
+            return;
+
+        fLineStarts.reserve( NSIMDUtils::countByte( fData.data(), fData.length(), '\n' ) + 1 );
+        fLineStarts.push_back( 0 );
+        NSIMDUtils::forEachByte( fData.data(), fData.length(), '\n', [ this ]( size_t pos ) { fLineStarts.push_back( pos + 1 ); } );
+        // a final newline ends the last line, it does not start another
+        if ( fLineStarts.back() == fData.length() )
+            fLineStarts.pop_back();
+    }
+
+    size_t CLineReader::numLines()
+    {
+        buildLineIndex();
+        return fLineStarts.size();
+    }
+
+    std::string_view CLineReader::line( size_t lineNumber )
+    {
+        buildLineIndex();
+        if ( !lineNumber || ( lineNumber > fLineStarts.size() ) )
+            return std::string_view();
+
+        auto start = fLineStarts[ lineNumber - 1 ];
+        auto end = ( lineNumber < fLineStarts.size() ) ? ( fLineStarts[ lineNumber ] - 1 ) : fData.length();
+        if ( ( end > start ) && ( fData[ end - 1 ] == '\n' ) )
+            --end; // the final newline
+        return stripCR( fData.substr( start, end - start ) );
+    }
+
+    bool CLineReader::seekToLine( size_t lineNumber )
+    {
+        buildLineIndex();
+        if ( !lineNumber || ( lineNumber > fLineStarts.size() ) )
+            return false;
+
+        fPos = fLineStarts[ lineNumber - 1 ];
+        fCurrLine = lineNumber;
+        fCurrLineStart = fPos;
+        return true;
+    }
+
+    size_t CLineReader::lineNumberAt( size_t offset )
+    {
+        buildLineIndex();
+        if ( fLineStarts.empty() )
+            return 0;
+        offset = std::min( offset, fData.length() );
+        return static_cast< size_t >( std::upper_bound( fLineStarts.begin(), fLineStarts.end(), offset ) - fLineStarts.begin() );
+    }
+
+    size_t CLineReader::columnAt( size_t offset )
+    {
+        auto lineNumber = lineNumberAt( offset );
+        if ( !lineNumber )
+            return 0;
+        return std::min( offset, fData.length() ) - fLineStarts[ lineNumber - 1 ] + 1;
+    }
+
+    std::vector< std::string_view > CLineReader::contextLines( size_t lineNumber, size_t numBefore, size_t numAfter )
+    {
+        std::vector< std::string_view > retVal;
+        auto lastLine = std::min( numLines(), lineNumber + numAfter );
+        auto firstLine = ( lineNumber > numBefore ) ? ( lineNumber - numBefore ) : 1;
+        for ( auto ii = firstLine; ii <= lastLine; ++ii )
+            retVal.push_back( line( ii ) );
+        return retVal;
+    }
+}
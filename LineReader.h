@@ -0,0 +1,104 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __LINEREADER_H
+#define __LINEREADER_H
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class QFile;
+namespace NFileUtils
+{
+    // Zero copy line and token reader
+    // Regular files are memory mapped, pipes and other sequential devices are read in large
+    // blocks into an owned buffer. Either way the views stay valid for the life of the reader.
+    //
+    // Line and column numbers are 1 based. Lines end with "\n" or "\r\n", neither is part of the line.
+    class CLineReader
+    {
+    public:
+        CLineReader();
+        // does not copy, text must outlive the reader
+        explicit CLineReader( std::string_view text );
+        ~CLineReader();
+
+        CLineReader( const CLineReader & ) = delete;
+        CLineReader & operator=( const CLineReader & ) = delete;
+
+        bool open( const std::string & fileName, std::string * msg = nullptr );
+        // the FILE is read from its current position, it is not closed by the reader
+        bool open( FILE * fp, std::string * msg = nullptr );
+        void close();
+
+        bool isOpen() const { return fOpen; }
+        bool isMapped() const { return fMapped; }
+        std::string_view data() const { return fData; }
+
+        // sequential access
+        bool nextLine( std::string_view & line );
+        // whitespace separated, "//" comments to the end of the line are skipped (get_string_token rules)
+        bool nextToken( std::string_view & token );
+        // of the last line or token returned
+        size_t lineNumber() const { return fLineNumber; }
+        size_t column() const { return fColumn; }
+        bool atEnd() const { return fPos >= fData.length(); }
+        void rewind();
+
+        // random access, the line offset index is built on first use
+        void buildLineIndex();
+        bool hasLineIndex() const { return fIndexBuilt; }
+        size_t numLines();
+        std::string_view line( size_t lineNumber ); // empty if out of range
+        // the next nextLine/nextToken starts at lineNumber
+        bool seekToLine( size_t lineNumber );
+        // the line number and column of a byte offset into data(), for error reporting
+        size_t lineNumberAt( size_t offset );
+        size_t columnAt( size_t offset );
+        // up to numBefore and numAfter lines around lineNumber, inclusive
+        std::vector< std::string_view > contextLines( size_t lineNumber, size_t numBefore, size_t numAfter );
+    private:
+        bool openFile( int64_t offset, std::string * msg );
+        bool readAll( std::string * msg );
+        void newLineAt( size_t pos );
+
+        std::unique_ptr< QFile > fFile;
+        std::string fBuffer; // when not mapped
+        std::string_view fData;
+        bool fOpen{ false };
+        bool fMapped{ false };
+
+        size_t fPos{ 0 };
+        size_t fCurrLine{ 1 }; // the line containing fPos
+        size_t fCurrLineStart{ 0 };
+        size_t fLineNumber{ 0 }; // of the last line or token returned
+        size_t fColumn{ 0 };
+
+        bool fIndexBuilt{ false };
+        std::vector< size_t > fLineStarts;
+    };
+}
+#endif
@@ -0,0 +1,152 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "MultiStringReplace.h"
+#include "MultiStringSearch.h"
+#include "SIMDUtils.h"
+
+#include <cstring>
+
+namespace NStringUtils
+{
+    CMultiStringReplace::CMultiStringReplace( const std::vector< std::pair< std::string, std::string > > & replacements, bool nocase )
+    {
+        for ( auto && ii : fByteMap )
+            ii = kNone;
+
+        bool singleBytes = true;
+        std::vector< std::string > keys;
+        for ( auto && ii : replacements )
+        {
+            if ( ii.first.empty() )
+                continue;
+            singleBytes = singleBytes && ( ii.first.length() == 1 );
+            fNeverGrows = fNeverGrows && ( ii.second.length() <= ii.first.length() );
+            keys.push_back( ii.first );
+            fTo.push_back( ii.second );
+        }
+
+        if ( !singleBytes )
+        {
+            fSearch = std::make_unique< CMultiStringSearch >( keys, nocase );
+            return;
+        }
+
+        for ( uint32_t ii = 0; ii < keys.size(); ++ii )
+        {
+            auto ch = keys[ ii ][ 0 ];
+            auto & lhs = fByteMap[ static_cast< unsigned char >( ch ) ];
+            if ( lhs != kNone )
+                continue;
+            lhs = ii;
+            if ( nocase )
+            {
+                auto lower = NSIMDUtils::foldAsciiLower( ch );
+                auto upper = ( ( lower >= 'a' ) && ( lower <= 'z' ) ) ? static_cast< char >( lower - 'a' + 'A' ) : lower;
+                for ( auto && curr : { lower, upper } )
+                {
+                    if ( fByteMap[ static_cast< unsigned char >( curr ) ] == kNone )
+                        fByteMap[ static_cast< unsigned char >( curr ) ] = ii;
+                }
+            }
+        }
+    }
+
+    CMultiStringReplace::~CMultiStringReplace()
+    {
+    }
+
+    // calls append( unchanged text ) and append( replacement ) in order, returns the number of replacements
+    template< typename TAppend >
+    size_t CMultiStringReplace::scan( std::string_view text, TAppend && append ) const
+    {
+        size_t retVal = 0;
+        if ( !fSearch )
+        {
+            size_t prev = 0;
+            for ( size_t ii = 0; ii < text.length(); ++ii )
+            {
+                auto to = fByteMap[ static_cast< unsigned char >( text[ ii ] ) ];
+                if ( to == kNone )
+                    continue;
+                append( text.substr( prev, ii - prev ) );
+                append( std::string_view( fTo[ to ] ) );
+                prev = ii + 1;
+                ++retVal;
+            }
+            append( text.substr( prev ) );
+            return retVal;
+        }
+
+        size_t prev = 0;
+        size_t pos;
+        size_t to;
+        while ( fSearch->findLeftmostLongest( text.substr( prev ), pos, to ) )
+        {
+            append( text.substr( prev, pos ) );
+            append( std::string_view( fTo[ to ] ) );
+            prev += pos + fSearch->needle( to ).length();
+            ++retVal;
+        }
+        append( text.substr( prev ) );
+        return retVal;
+    }
+
+    size_t CMultiStringReplace::replaceInto( std::string & out, std::string_view text ) const
+    {
+        out.reserve( out.length() + text.length() );
+        return scan( text, [ &out ]( std::string_view curr ) { out.append( curr.data(), curr.length() ); } );
+    }
+
+    std::string CMultiStringReplace::replace( std::string_view text, size_t * numReplaced ) const
+    {
+        std::string retVal;
+        auto num = replaceInto( retVal, text );
+        if ( numReplaced )
+            *numReplaced = num;
+        return retVal;
+    }
+
+    size_t CMultiStringReplace::replaceInPlace( std::string & str ) const
+    {
+        if ( !fNeverGrows )
+        {
+            std::string retVal;
+            auto num = replaceInto( retVal, str );
+            if ( num )
+                str.swap( retVal );
+            return num;
+        }
+
+        // the write position never passes the read position, and the scan never looks behind
+        // the end of the last match, so nothing is overwritten before it is read
+        auto out = &str[ 0 ];
+        auto num = scan( str, [ &out ]( std::string_view curr )
+            {
+                if ( out != curr.data() )
+                    std::memmove( out, curr.data(), curr.length() );
+                out += curr.length();
+            } );
+        str.resize( out - str.data() );
+        return num;
+    }
+}
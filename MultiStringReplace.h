@@ -0,0 +1,68 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __MULTISTRINGREPLACE_H
+#define __MULTISTRINGREPLACE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace NStringUtils
+{
+    class CMultiStringSearch;
+
+    // Replaces every ( from, to ) pair of a table in one left to right scan
+    // At each position the longest matching key wins, replaced text is never scanned again.
+    // When every key is a single character a 256 entry table is used, otherwise the keys
+    // are found with a CMultiStringSearch (Aho-Corasick) automaton.
+    // Empty keys are ignored, for duplicate keys the first pair wins.
+    class CMultiStringReplace
+    {
+    public:
+        CMultiStringReplace( const std::vector< std::pair< std::string, std::string > > & replacements, bool nocase = false );
+        ~CMultiStringReplace();
+
+        std::string replace( std::string_view text, size_t * numReplaced = nullptr ) const;
+        // appends the replaced text to out, returns the number of replacements
+        size_t replaceInto( std::string & out, std::string_view text ) const;
+        // rewrites str in its own buffer when no replacement is longer than its key
+        size_t replaceInPlace( std::string & str ) const;
+
+        bool neverGrows() const { return fNeverGrows; }
+    private:
+        static constexpr uint32_t kNone = UINT32_MAX;
+
+        template< typename TAppend >
+        size_t scan( std::string_view text, TAppend && append ) const;
+
+        std::vector< std::string > fTo;
+        uint32_t fByteMap[ 256 ]; // single character keys, index into fTo
+        std::unique_ptr< CMultiStringSearch > fSearch; // only when there are longer keys
+        bool fNeverGrows{ true };
+    };
+}
+
+#endif
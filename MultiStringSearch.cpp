@@ -0,0 +1,208 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "MultiStringSearch.h"
+#include "SIMDUtils.h"
+
+#include <deque>
+
+namespace NStringUtils
+{
+    CMultiStringSearch::CMultiStringSearch( const std::vector< std::string > & needles, bool nocase ) :
+        fNeedles( needles ),
+        fNoCase( nocase )
+    {
+        // byte equivalence classes, upper and lower case share a class when folding
+        for ( auto && needle : fNeedles )
+        {
+            for ( auto && ch : needle )
+            {
+                auto uch = static_cast< unsigned char >( fNoCase ? NSIMDUtils::foldAsciiLower( ch ) : ch );
+                if ( !fClass[ uch ] )
+                    fClass[ uch ] = static_cast< uint16_t >( fNumClasses++ );
+            }
+        }
+        if ( fNoCase )
+        {
+            for ( int ii = 'A'; ii <= 'Z'; ++ii )
+                fClass[ ii ] = fClass[ ii - 'A' + 'a' ];
+        }
+
+        // the trie
+        fDelta.assign( fNumClasses, kNone );
+        fDepth.push_back( 0 );
+        fOutput.push_back( kNone );
+        for ( size_t ii = 0; ii < fNeedles.size(); ++ii )
+        {
+            if ( fNeedles[ ii ].empty() )
+            {
+                if ( fEmptyNeedle == kNone )
+                    fEmptyNeedle = static_cast< uint32_t >( ii );
+                continue;
+            }
+            uint32_t state = 0;
+            for ( auto && ch : fNeedles[ ii ] )
+            {
+                auto & target = fDelta[ static_cast< size_t >( state ) * fNumClasses + fClass[ static_cast< unsigned char >( ch ) ] ];
+                if ( target == kNone )
+                {
+                    target = static_cast< uint32_t >( fDepth.size() );
+                    fDelta.resize( fDelta.size() + fNumClasses, kNone );
+                    fDepth.push_back( fDepth[ state ] + 1 );
+                    fOutput.push_back( kNone );
+                }
+                state = fDelta[ static_cast< size_t >( state ) * fNumClasses + fClass[ static_cast< unsigned char >( ch ) ] ];
+            }
+            if ( fOutput[ state ] == kNone ) // duplicates report the first
+                fOutput[ state ] = static_cast< uint32_t >( ii );
+        }
+
+        // breadth first, fill in the failure transitions and the dictionary links
+        std::vector< uint32_t > fail( fDepth.size(), 0 );
+        fDictLink.assign( fDepth.size(), kNone );
+        std::deque< uint32_t > queue;
+        for ( uint32_t cls = 0; cls < fNumClasses; ++cls )
+        {
+            auto & target = fDelta[ cls ];
+            if ( target == kNone )
+                target = 0;
+            else
+                queue.push_back( target );
+        }
+        while ( !queue.empty() )
+        {
+            auto state = queue.front();
+            queue.pop_front();
+            for ( uint32_t cls = 0; cls < fNumClasses; ++cls )
+            {
+                auto idx = static_cast< size_t >( state ) * fNumClasses + cls;
+                auto failTarget = fDelta[ static_cast< size_t >( fail[ state ] ) * fNumClasses + cls ];
+                auto target = fDelta[ idx ];
+                if ( target == kNone )
+                {
+                    fDelta[ idx ] = failTarget;
+                    continue;
+                }
+                fail[ target ] = failTarget;
+                fDictLink[ target ] = ( fOutput[ failTarget ] != kNone ) ? failTarget : fDictLink[ failTarget ];
+                queue.push_back( target );
+            }
+        }
+    }
+
+    uint32_t CMultiStringSearch::firstOutput( uint32_t state ) const
+    {
+        if ( fOutput[ state ] != kNone )
+            return fOutput[ state ];
+        auto link = fDictLink[ state ];
+        return ( link == kNone ) ? kNone : fOutput[ link ];
+    }
+
+    bool CMultiStringSearch::findFirst( std::string_view text, size_t & pos, size_t & needleIdx ) const
+    {
+        uint32_t state = 0;
+        for ( size_t ii = 0; ii < text.length(); ++ii )
+        {
+            state = next( state, text[ ii ] );
+            auto output = firstOutput( state );
+            if ( output != kNone )
+            {
+                needleIdx = output;
+                pos = ii + 1 - fNeedles[ output ].length();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool CMultiStringSearch::findLeftmostLongest( std::string_view text, size_t & pos, size_t & needleIdx ) const
+    {
+        auto found = kNone;
+        size_t foundPos = 0;
+        uint32_t state = 0;
+        for ( size_t ii = 0; ii < text.length(); ++ii )
+        {
+            state = next( state, text[ ii ] );
+            // every match still to come starts at or after ii + 1 - depth
+            if ( ( found != kNone ) && ( ( ii + 1 - fDepth[ state ] ) > foundPos ) )
+                break;
+
+            // the longest match ending here has the smallest start
+            auto output = firstOutput( state );
+            if ( output == kNone )
+                continue;
+            auto start = ii + 1 - fNeedles[ output ].length();
+            if ( ( found == kNone ) || ( start < foundPos ) || ( ( start == foundPos ) && ( fNeedles[ output ].length() > fNeedles[ found ].length() ) ) )
+            {
+                found = output;
+                foundPos = start;
+            }
+        }
+        if ( found == kNone )
+            return false;
+        pos = foundPos;
+        needleIdx = found;
+        return true;
+    }
+
+    bool CMultiStringSearch::containsAny( std::string_view text ) const
+    {
+        size_t pos, needleIdx;
+        return findFirst( text, pos, needleIdx );
+    }
+
+    std::vector< std::pair< size_t, size_t > > CMultiStringSearch::findAll( std::string_view text ) const
+    {
+        std::vector< std::pair< size_t, size_t > > retVal;
+        uint32_t state = 0;
+        for ( size_t ii = 0; ii < text.length(); ++ii )
+        {
+            state = next( state, text[ ii ] );
+            for ( auto curr = ( fOutput[ state ] != kNone ) ? state : fDictLink[ state ]; curr != kNone; curr = fDictLink[ curr ] )
+            {
+                auto output = fOutput[ curr ];
+                retVal.emplace_back( ii + 1 - fNeedles[ output ].length(), output );
+            }
+        }
+        return retVal;
+    }
+
+    bool CMultiStringSearch::matchKeyWord( std::string_view line, size_t * which ) const
+    {
+        // walk the trie only, a transition that does not go one level deeper fell off it
+        uint32_t state = 0;
+        auto found = fEmptyNeedle;
+        for ( size_t ii = 0; ii < line.length(); ++ii )
+        {
+            state = next( state, line[ ii ] );
+            if ( fDepth[ state ] != ( ii + 1 ) )
+                break;
+            if ( fOutput[ state ] != kNone )
+                found = fOutput[ state ];
+        }
+        if ( found == kNone )
+            return false;
+        if ( which )
+            *which = found;
+        return true;
+    }
+}
@@ -0,0 +1,83 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __MULTISTRINGSEARCH_H
+#define __MULTISTRINGSEARCH_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace NStringUtils
+{
+    // Aho-Corasick automaton over a fixed list of needles (keywords)
+    // The text is scanned once regardless of the number of needles.  The goto and
+    // failure functions are folded into a single DFA over byte equivalence classes,
+    // so each text byte costs one table lookup.
+    //
+    // Case insensitive matching folds A-Z only, like strCaseFind
+    // An empty needle never matches in the searches, matchKeyWord matches it at the start of
+    // any line like NStringUtils::matchKeyWord( line, "" ) does
+    class CMultiStringSearch
+    {
+    public:
+        CMultiStringSearch( const std::vector< std::string > & needles, bool nocase = true );
+
+        size_t size() const { return fNeedles.size(); }
+        const std::string & needle( size_t idx ) const { return fNeedles[ idx ]; }
+
+        // the match that ends first, the longest needle when several end at the same position
+        // returns false when there is no match, pos is the start of the match in text
+        bool findFirst( std::string_view text, size_t & pos, size_t & needleIdx ) const;
+        bool containsAny( std::string_view text ) const;
+        // the match that starts first, the longest needle when several start at the same position
+        // repeated calls on the text past the match give the non overlapping matches a replace needs
+        bool findLeftmostLongest( std::string_view text, size_t & pos, size_t & needleIdx ) const;
+        // every (possibly overlapping) match as ( start position, needle index ), ordered by end position
+        std::vector< std::pair< size_t, size_t > > findAll( std::string_view text ) const;
+
+        // true when one of the needles is a prefix of line (see NStringUtils::matchKeyWord)
+        // which is set to the longest matching needle, an empty needle matches every line
+        bool matchKeyWord( std::string_view line, size_t * which = nullptr ) const;
+    private:
+        static constexpr uint32_t kNone = UINT32_MAX;
+
+        uint32_t next( uint32_t state, char ch ) const { return fDelta[ static_cast< size_t >( state ) * fNumClasses + fClass[ static_cast< unsigned char >( ch ) ] ]; }
+        // the needle of the longest match ending at state, kNone if there is none
+        uint32_t firstOutput( uint32_t state ) const;
+
+        std::vector< std::string > fNeedles;
+        bool fNoCase{ true };
+        uint32_t fEmptyNeedle{ kNone }; // the first empty needle, for matchKeyWord
+
+        uint32_t fNumClasses{ 1 }; // class 0 is every byte not in a needle
+        uint16_t fClass[ 256 ]{ 0 };
+        std::vector< uint32_t > fDelta; // numStates * fNumClasses
+        std::vector< uint32_t > fDepth;
+        std::vector< uint32_t > fOutput; // needle ending exactly at the state
+        std::vector< uint32_t > fDictLink; // next state on the failure chain with an output
+    };
+}
+
+#endif
@@ -0,0 +1,377 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef __NOCASESTRINGSET_H
+#define __NOCASESTRINGSET_H
+
+#include "SIMDUtils.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace NStringUtils
+{
+    // Flat open addressing hash tables keyed by ASCII case insensitive strings, the replacement for
+    // std::set< std::string, noCaseStringCmp > and std::unordered_set with noCaseStringHash
+    //
+    // Every slot has a 1 byte tag, 7 bits of the case folded hash, and the tags are probed 16 at a time,
+    // so a probe only compares the strings whose tag matches. Lookups take a std::string_view, std::string
+    // and const char * need no conversion. The stored key keeps the spelling of its first insert.
+    // Iteration is in slot order, sorted() gives the noCaseStringCmp order.
+    // Inserting may rehash, which invalidates the iterators. T must be default constructible.
+    template< typename T >
+    class CNoCaseStringMap
+    {
+    public:
+        template< bool kConst >
+        class TIterator
+        {
+        public:
+            using TMap = std::conditional_t< kConst, const CNoCaseStringMap, CNoCaseStringMap >;
+            using TValue = std::conditional_t< kConst, const T, T >;
+            using reference = std::pair< const std::string &, TValue & >;
+            struct SArrow
+            {
+                reference fRef;
+                reference * operator->() { return &fRef; }
+            };
+
+            TIterator() = default;
+            TIterator( TMap * map, size_t slot ) : fMap( map ), fSlot( slot ) { skipFree(); }
+            // iterator to const_iterator
+            template< bool kOtherConst, typename = std::enable_if_t< kConst && !kOtherConst > >
+            TIterator( const TIterator< kOtherConst > & rhs ) : fMap( rhs.fMap ), fSlot( rhs.fSlot ) {}
+
+            reference operator*() const { return reference( fMap->fKeys[ fSlot ], fMap->fValues[ fSlot ] ); }
+            SArrow operator->() const { return SArrow{ **this }; }
+            const std::string & key() const { return fMap->fKeys[ fSlot ]; }
+            TValue & value() const { return fMap->fValues[ fSlot ]; }
+
+            TIterator & operator++()
+            {
+                ++fSlot;
+                skipFree();
+                return *this;
+            }
+            TIterator operator++( int )
+            {
+                auto retVal = *this;
+                ++*this;
+                return retVal;
+            }
+            bool operator==( const TIterator & rhs ) const { return fSlot == rhs.fSlot; }
+            bool operator!=( const TIterator & rhs ) const { return fSlot != rhs.fSlot; }
+        private:
+            template< bool > friend class TIterator;
+            friend class CNoCaseStringMap;
+
+            void skipFree()
+            {
+                while ( fMap && ( fSlot < fMap->fTags.size() ) && !isFull( fMap->fTags[ fSlot ] ) )
+                    ++fSlot;
+            }
+
+            TMap * fMap{ nullptr };
+            size_t fSlot{ 0 };
+        };
+        using iterator = TIterator< false >;
+        using const_iterator = TIterator< true >;
+
+        CNoCaseStringMap() = default;
+        CNoCaseStringMap( std::initializer_list< std::pair< std::string_view, T > > values )
+        {
+            reserve( values.size() );
+            for ( auto && ii : values )
+                insert( ii.first, ii.second );
+        }
+
+        size_t size() const { return fSize; }
+        bool empty() const { return fSize == 0; }
+        void clear()
+        {
+            fTags.clear();
+            fKeys.clear();
+            fValues.clear();
+            fSize = 0;
+            fNumDeleted = 0;
+        }
+        void reserve( size_t numValues )
+        {
+            if ( ( numValues * 8 ) > ( fTags.size() * 7 ) )
+                rehash( capacityFor( numValues ) );
+        }
+
+        iterator begin() { return iterator( this, 0 ); }
+        iterator end() { return iterator( this, fTags.size() ); }
+        const_iterator begin() const { return const_iterator( this, 0 ); }
+        const_iterator end() const { return const_iterator( this, fTags.size() ); }
+
+        iterator find( std::string_view key ) { return iterator( this, findSlot( key, hash( key ) ) ); }
+        const_iterator find( std::string_view key ) const { return const_iterator( this, findSlot( key, hash( key ) ) ); }
+        bool contains( std::string_view key ) const { return findSlot( key, hash( key ) ) != fTags.size(); }
+        size_t count( std::string_view key ) const { return contains( key ) ? 1 : 0; }
+
+        // the existing value is kept, second is false when key was already present
+        std::pair< iterator, bool > insert( std::string_view key, T value )
+        {
+            bool inserted;
+            auto slot = insertSlot( key, inserted );
+            if ( inserted )
+                fValues[ slot ] = std::move( value );
+            return std::make_pair( iterator( this, slot ), inserted );
+        }
+        std::pair< iterator, bool > insert_or_assign( std::string_view key, T value )
+        {
+            bool inserted;
+            auto slot = insertSlot( key, inserted );
+            fValues[ slot ] = std::move( value );
+            return std::make_pair( iterator( this, slot ), inserted );
+        }
+        T & operator[]( std::string_view key )
+        {
+            bool inserted;
+            return fValues[ insertSlot( key, inserted ) ];
+        }
+
+        bool erase( std::string_view key )
+        {
+            auto slot = findSlot( key, hash( key ) );
+            if ( slot == fTags.size() )
+                return false;
+
+            // a group with an empty slot ends every probe through it, so the slot can be empty again
+            auto group = fTags.data() + ( slot - ( slot % kGroupSize ) );
+            if ( NSIMDUtils::matchBytes16( group, kEmpty ) )
+                fTags[ slot ] = kEmpty;
+            else
+            {
+                fTags[ slot ] = kDeleted;
+                fNumDeleted++;
+            }
+            fKeys[ slot ] = std::string();
+            fValues[ slot ] = T();
+            fSize--;
+            return true;
+        }
+        iterator erase( const_iterator pos )
+        {
+            auto slot = pos.fSlot;
+            erase( std::string_view( fKeys[ slot ] ) );
+            return iterator( this, slot + 1 );
+        }
+
+        // the entries in noCaseStringCmp order of their keys
+        std::vector< const_iterator > sorted() const
+        {
+            std::vector< const_iterator > retVal;
+            retVal.reserve( fSize );
+            for ( auto ii = begin(); ii != end(); ++ii )
+                retVal.push_back( ii );
+            std::sort( retVal.begin(), retVal.end(), []( const const_iterator & lhs, const const_iterator & rhs )
+                       {
+                           return NSIMDUtils::compareNoCase( lhs.key().data(), lhs.key().length(), rhs.key().data(), rhs.key().length() ) < 0;
+                       } );
+            return retVal;
+        }
+    private:
+        static constexpr uint8_t kEmpty = 0;
+        static constexpr uint8_t kDeleted = 1;
+        static constexpr size_t kGroupSize = 16;
+
+        static bool isFull( uint8_t tag ) { return ( tag & 0x80 ) != 0; }
+        static uint64_t hash( std::string_view key ) { return NSIMDUtils::hashNoCase( key.data(), key.length() ); }
+        // the group comes from the low bits of the hash, the tag from the high ones
+        static uint8_t tagOf( uint64_t keyHash ) { return static_cast< uint8_t >( 0x80 | ( keyHash >> 57 ) ); }
+        // at most 7/16 full after a rehash, a power of 2 number of groups
+        static size_t capacityFor( size_t numValues )
+        {
+            size_t retVal = kGroupSize;
+            while ( ( numValues * 16 ) > ( retVal * 7 ) )
+                retVal *= 2;
+            return retVal;
+        }
+
+        // fTags.size() when not found
+        size_t findSlot( std::string_view key, uint64_t keyHash ) const
+        {
+            auto numGroups = fTags.size() / kGroupSize;
+            auto tag = tagOf( keyHash );
+            auto group = static_cast< size_t >( keyHash );
+            for ( size_t ii = 0; ii < numGroups; ++ii, ++group )
+            {
+                auto start = ( group & ( numGroups - 1 ) ) * kGroupSize;
+                auto tags = fTags.data() + start;
+                for ( auto matches = NSIMDUtils::matchBytes16( tags, tag ); matches; matches &= matches - 1 )
+                {
+                    auto slot = start + NSIMDUtils::countTrailingZeros( matches );
+                    if ( NSIMDUtils::equalsNoCase( fKeys[ slot ].data(), fKeys[ slot ].length(), key.data(), key.length() ) )
+                        return slot;
+                }
+                if ( NSIMDUtils::matchBytes16( tags, kEmpty ) )
+                    break;
+            }
+            return fTags.size();
+        }
+
+        // the first empty or deleted slot on the probe sequence of keyHash
+        size_t freeSlot( uint64_t keyHash ) const
+        {
+            auto numGroups = fTags.size() / kGroupSize;
+            auto group = static_cast< size_t >( keyHash );
+            for ( ;; ++group )
+            {
+                auto start = ( group & ( numGroups - 1 ) ) * kGroupSize;
+                auto tags = fTags.data() + start;
+                auto freeSlots = NSIMDUtils::matchBytes16( tags, kEmpty ) | NSIMDUtils::matchBytes16( tags, kDeleted );
+                if ( freeSlots )
+                    return start + NSIMDUtils::countTrailingZeros( freeSlots );
+            }
+        }
+
+        size_t insertSlot( std::string_view key, bool & inserted )
+        {
+            auto keyHash = hash( key );
+            auto slot = findSlot( key, keyHash );
+            inserted = ( slot == fTags.size() );
+            if ( !inserted )
+                return slot;
+
+            if ( ( ( fSize + fNumDeleted + 1 ) * 8 ) > ( fTags.size() * 7 ) )
+                rehash( capacityFor( fSize + 1 ) );
+            slot = freeSlot( keyHash );
+            if ( fTags[ slot ] == kDeleted )
+                fNumDeleted--;
+            fTags[ slot ] = tagOf( keyHash );
+            fKeys[ slot ].assign( key.data(), key.length() );
+            fSize++;
+            return slot;
+        }
+
+        void rehash( size_t capacity )
+        {
+            auto tags = std::move( fTags );
+            auto keys = std::move( fKeys );
+            auto values = std::move( fValues );
+            fTags.assign( capacity, kEmpty );
+            fKeys = std::vector< std::string >( capacity );
+            fValues = std::vector< T >( capacity );
+            fNumDeleted = 0;
+            for ( size_t ii = 0; ii < tags.size(); ++ii )
+            {
+                if ( !isFull( tags[ ii ] ) )
+                    continue;
+                auto keyHash = hash( keys[ ii ] );
+                auto slot = freeSlot( keyHash );
+                fTags[ slot ] = tagOf( keyHash );
+                fKeys[ slot ] = std::move( keys[ ii ] );
+                fValues[ slot ] = std::move( values[ ii ] );
+            }
+        }
+
+        std::vector< uint8_t > fTags; // kEmpty, kDeleted or 0x80 | 7 bits of the hash
+        std::vector< std::string > fKeys;
+        std::vector< T > fValues;
+        size_t fSize{ 0 };
+        size_t fNumDeleted{ 0 };
+    };
+
+    class CNoCaseStringSet
+    {
+        struct SNoValue {};
+        using TMap = CNoCaseStringMap< SNoValue >;
+    public:
+        class const_iterator
+        {
+        public:
+            const_iterator() = default;
+            explicit const_iterator( TMap::const_iterator pos ) : fPos( pos ) {}
+
+            const std::string & operator*() const { return fPos.key(); }
+            const std::string * operator->() const { return &fPos.key(); }
+            const_iterator & operator++()
+            {
+                ++fPos;
+                return *this;
+            }
+            const_iterator operator++( int )
+            {
+                auto retVal = *this;
+                ++fPos;
+                return retVal;
+            }
+            bool operator==( const const_iterator & rhs ) const { return fPos == rhs.fPos; }
+            bool operator!=( const const_iterator & rhs ) const { return fPos != rhs.fPos; }
+        private:
+            TMap::const_iterator fPos;
+        };
+        using iterator = const_iterator;
+
+        CNoCaseStringSet() = default;
+        CNoCaseStringSet( std::initializer_list< std::string_view > values )
+        {
+            fMap.reserve( values.size() );
+            for ( auto && ii : values )
+                insert( ii );
+        }
+        template< typename TIter >
+        CNoCaseStringSet( TIter first, TIter last )
+        {
+            for ( ; first != last; ++first )
+                insert( *first );
+        }
+
+        size_t size() const { return fMap.size(); }
+        bool empty() const { return fMap.empty(); }
+        void clear() { fMap.clear(); }
+        void reserve( size_t numValues ) { fMap.reserve( numValues ); }
+
+        const_iterator begin() const { return const_iterator( fMap.begin() ); }
+        const_iterator end() const { return const_iterator( fMap.end() ); }
+
+        // false when key was already present
+        bool insert( std::string_view key ) { return fMap.insert( key, SNoValue() ).second; }
+        bool erase( std::string_view key ) { return fMap.erase( key ); }
+        bool contains( std::string_view key ) const { return fMap.contains( key ); }
+        size_t count( std::string_view key ) const { return fMap.count( key ); }
+        const_iterator find( std::string_view key ) const { return const_iterator( fMap.find( key ) ); }
+
+        // the keys in noCaseStringCmp order, the same order as std::set< std::string, noCaseStringCmp >
+        std::vector< std::string_view > sorted() const
+        {
+            std::vector< std::string_view > retVal;
+            retVal.reserve( size() );
+            for ( auto && ii : fMap.sorted() )
+                retVal.push_back( ii.key() );
+            return retVal;
+        }
+    private:
+        TMap fMap;
+    };
+}
+#endif
@@ -22,6 +22,9 @@
 
 #include "QtUtils.h"
 #include "FileUtils.h"
+#include "CSVReader.h"
+#include "HtmlEntities.h"
+#include "DateTimeParser.h"
 
 #include <QXmlStreamReader>
 #include <QXmlStreamWriter>
@@ -361,32 +364,25 @@ QString getFile( const QDir & relToDir, const QString & file )
     return retVal;
 }
 
-QDateTime getDateTime( const QString & dateString )
+// one per thread, so the format that worked last carries over between calls
+// rebuilt when QLocale::setDefault changes the locale it took its formats from
+static CDateTimeParser & dateTimeParser()
 {
+    static thread_local CDateTimeParser sParser;
     QLocale locale;
-    QDateTime retVal = QDateTime::fromString( dateString );
-    if( !retVal.isValid() )
-        retVal = QDateTime::fromString( dateString, locale.dateTimeFormat( QLocale::ShortFormat ) );
-    if( !retVal.isValid() )
-        retVal = QDateTime::fromString( dateString, locale.dateTimeFormat( QLocale::LongFormat ) );
-    if( !retVal.isValid() )
-        retVal = QDateTime::fromString( dateString, Qt::ISODate );
-    if( !retVal.isValid() )
-        retVal = QDateTime::fromString( dateString, "yyyy-M-dTh:m:s" );
-    if( !retVal.isValid() )
-        retVal = QDateTime::fromString( dateString, "yyyy-MM-ddTHH:mm:ss" );
-    if( !retVal.isValid() )
-        retVal = QDateTime::fromString( dateString, "yyyy-MM-dd" );
-    if( !retVal.isValid() )
-        retVal = QDateTime::fromString( dateString, "yyyy-M-d" );
-    if( !retVal.isValid() )
-        retVal = QDateTime::fromString( dateString, "yyyy/MM/dd" );
-    return retVal;
+    if ( sParser.locale() != locale )
+        sParser = CDateTimeParser( locale );
+    return sParser;
+}
+
+QDateTime getDateTime( const QString & dateString )
+{
+    return dateTimeParser().parse( dateString );
 }
 
 QDateTime getDateTime( const QStringRef & value, QXmlStreamReader & reader, bool optional )
 {
-    QDateTime retVal = getDateTime( value.toString() );
+    QDateTime retVal = dateTimeParser().parse( value );
     if ( !retVal.isValid() )
     {
         if ( !optional )
@@ -403,60 +399,12 @@ QDateTime getDateTime( const QString & value, QXmlStreamReader & reader, bool op
 
 QStringList splitLineCSV( const QString & line )
 {
-    QString temp = line;
-    QString field;
-    QStringList field_list;
-
-    // regex explaination
-    //
-    //    /(?:^|,)(\"(?:[^\"]+|\"\")*\"|[^,]*)/g
-    //        (?:^|,) Non-capturing group
-    //            1st Alternative: ^
-    //                ^ assert position at start of the string
-    //            2nd Alternative: ,
-    //                , matches the character , literally
-    //        1st Capturing group (\"(?:[^\"]+|\"\")*\"|[^,]*)
-    //            1st Alternative: \"(?:[^\"]+|\"\")*\"
-    //                \" matches the character " literally
-    //                (?:[^\"]+|\"\")* Non-capturing group
-    //                    Quantifier: * Between zero and unlimited times, as many times as possible, giving back as needed [greedy]
-    //                    1st Alternative: [^\"]+
-    //                        [^\"]+ match a single character not present in the list below
-    //                            Quantifier: + Between one and unlimited times, as many times as possible, giving back as needed [greedy]
-    //                            \" matches the character " literally
-    //                    2nd Alternative: \"\"
-    //                        \" matches the character " literally
-    //                        \" matches the character " literally
-    //                \" matches the character " literally
-    //            2nd Alternative: [^,]*
-    //                [^,]* match a single character not present in the list below
-    //                    Quantifier: * Between zero and unlimited times, as many times as possible, giving back as needed [greedy]
-    //                    , the literal character ,
-    //        g modifier: global. All matches (don't return on first match)
-    //
-
-    QString regex = "(?:^|,)(\"(?:[^\"]+|\"\")*\"|[^,]*)";
-
-    QRegularExpression re( regex );
-
-    if( temp.right( 1 ) == "\n" )
-        temp.chop( 1 );
-
-    QRegularExpressionMatchIterator it = re.globalMatch( temp );
-
-    while( it.hasNext() )
-    {
-        QRegularExpressionMatch match = it.next();
-        if( match.hasMatch() )
-        {
-            field = match.captured( 1 );
-            if( field.left( 1 ) == "\"" && field.right( 1 ) == "\"" )
-                field = field.mid( 1, field.length() - 2 );
-            field_list.push_back( field );
-        }
-    }
-
-    return field_list;
+    // RFC 4180, doubled quotes in a quoted field are undone
+    auto utf8 = line.toUtf8();
+    QStringList retVal;
+    for ( auto && ii : NFileUtils::CCSVParser::splitLine( std::string_view( utf8.data(), static_cast< size_t >( utf8.size() ) ) ) )
+        retVal << QString::fromUtf8( ii.data(), static_cast< int >( ii.length() ) );
+    return retVal;
 }
 
 size_t SizeOf( const QDateTime & /*dt*/ )
@@ -473,31 +421,13 @@ size_t SizeOf( const QString & str )
 
 QString fromHtmlEscaped( const QString & str )
 {
-    QString retVal = str;
-    QRegularExpression regExp( "(?<lt>\\&lt\\;)|(?<gt>\\&gt\\;)|(?<amp>\\&amp\\;)|(?<quot>\\&quot\\;)", QRegularExpression::PatternOption::CaseInsensitiveOption );
-    auto match = regExp.match( str, 0 );
-
-    while( match.hasMatch() )
-    {
-        if ( !match.captured( "lt" ).isEmpty() )
-        {
-            retVal.replace( match.capturedStart( "lt" ), match.capturedLength( "lt" ), "<" );
-        }
-        else if ( !match.captured( "gt" ).isEmpty() )
-        {
-            retVal.replace( match.capturedStart( "gt" ), match.capturedLength( "gt" ), ">" );
-        }
-        else if ( !match.captured( "amp" ).isEmpty() )
-        {
-            retVal.replace( match.capturedStart( "amp" ), match.capturedLength( "amp" ), "&" );
-        }
-        else if ( !match.captured( "quot" ).isEmpty() )
-        {
-            retVal.replace( match.capturedStart( "quot" ), match.capturedLength( "quot" ), "\"" );
-        }
-        match = regExp.match( retVal, match.capturedStart() + 1 );
-    }
+    // implicitly shared, so nothing is copied when there is nothing to decode
+    if ( !str.contains( '&' ) )
+        return str;
 
+    QString retVal( str.length(), Qt::Uninitialized );
+    auto len = NStringUtils::decodeHtmlEntities( reinterpret_cast< const char16_t * >( str.utf16() ), static_cast< size_t >( str.length() ), reinterpret_cast< char16_t * >( retVal.data() ) );
+    retVal.truncate( static_cast< int >( len ) );
     return retVal;
 }
 
@@ -108,6 +108,7 @@ namespace NQtUtils
     QString getFile( const QDir & relToDir, QXmlStreamReader & reader, QString * origFile=nullptr );
     QString getFile( const QDir & relToDir, const QString & file );
 
+    // see CDateTimeParser for the formats, use one directly for a column of values
     QDateTime getDateTime( const QStringRef & str, QXmlStreamReader & reader, bool optional );
     QDateTime getDateTime( const QString & str, QXmlStreamReader & reader, bool optional );
     QDateTime getDateTime( const QString & str );
@@ -139,9 +140,11 @@ namespace NQtUtils
         }
     };
 
+    // one CSV record, see NFileUtils::CCSVParser for files and quoted fields spanning lines
     QStringList splitLineCSV( const QString & line );
     size_t SizeOf( const QString & str );
     size_t SizeOf( const QDateTime & str );
+    // all the named and numeric references, see NStringUtils::decodeHtmlEntities
     QString fromHtmlEscaped( const QString & str );
 
     void move( QSettings & settings, const QString & subGroup, const QString & key, bool overwrite );
@@ -0,0 +1,266 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "RegExCache.h"
+#include "ByteRegEx.h"
+
+namespace NStringUtils
+{
+    using TKey = std::pair< std::string, int >;
+    static const int kWildcardKey = 0x40000000; // or'ed into the option bits of the key
+    static const int kByteRegExKey = 0x20000000;
+
+    struct SKeyHash
+    {
+        size_t operator()( const TKey & key ) const
+        {
+            return std::hash< std::string >()( key.first ) ^ ( static_cast< size_t >( key.second ) * 0x9E3779B97F4A7C15ULL );
+        }
+    };
+
+    struct CRegExCache::SEntry
+    {
+        QRegularExpression fRegExp;
+        std::shared_ptr< const CByteRegEx > fByteRegEx; // only for kByteRegExKey keys, nullptr when unsupported
+    };
+
+    struct CRegExCache::SShard
+    {
+        using TLRUList = std::list< std::pair< TKey, SEntry > >;
+
+        std::mutex fMutex;
+        size_t fMaxSize{ 0 };
+        TLRUList fLRU; // most recently used at the front
+        std::unordered_map< TKey, TLRUList::iterator, SKeyHash > fMap;
+
+        void trim()
+        {
+            while ( fMap.size() > fMaxSize )
+            {
+                fMap.erase( fLRU.back().first );
+                fLRU.pop_back();
+            }
+        }
+    };
+
+    // QRegExp::Wildcard semantics, unlike QRegularExpression::wildcardToRegularExpression
+    // * and ? match any character, / and \ included, and a backslash is a literal
+    static QString wildcardToRegEx( const QString & wildcard )
+    {
+        QString retVal = "(?s)\\A(?:";
+        QString literal;
+        auto flush = [ & ]()
+        {
+            retVal += QRegularExpression::escape( literal );
+            literal.clear();
+        };
+
+        auto len = wildcard.length();
+        for ( int ii = 0; ii < len; ++ii )
+        {
+            auto ch = wildcard[ ii ];
+            if ( ch == '*' )
+            {
+                flush();
+                retVal += ".*";
+            }
+            else if ( ch == '?' )
+            {
+                flush();
+                retVal += ".";
+            }
+            else if ( ch == '[' )
+            {
+                // a ] right after the [ (or the negation) is in the set, an unclosed [ is a literal
+                auto setStart = ii + 1;
+                bool negated = ( setStart < len ) && ( ( wildcard[ setStart ] == '!' ) || ( wildcard[ setStart ] == '^' ) );
+                if ( negated )
+                    setStart++;
+                auto setEnd = wildcard.indexOf( ']', ( ( setStart < len ) && ( wildcard[ setStart ] == ']' ) ) ? setStart + 1 : setStart );
+                if ( setEnd < 0 )
+                {
+                    literal += ch;
+                    continue;
+                }
+
+                flush();
+                retVal += negated ? "[^" : "[";
+                for ( auto jj = setStart; jj < setEnd; ++jj )
+                {
+                    auto setCh = wildcard[ jj ];
+                    if ( ( setCh == '\\' ) || ( setCh == '[' ) || ( setCh == ']' ) )
+                        retVal += '\\';
+                    retVal += setCh;
+                }
+                retVal += "]";
+                ii = setEnd;
+            }
+            else
+                literal += ch;
+        }
+        flush();
+        retVal += ")\\z";
+        return retVal;
+    }
+
+    CRegExCache * CRegExCache::instance()
+    {
+        static CRegExCache sCache;
+        return &sCache;
+    }
+
+    CRegExCache::CRegExCache( size_t maxSize, size_t numShards )
+    {
+        if ( numShards == 0 )
+            numShards = 1;
+        for ( size_t ii = 0; ii < numShards; ++ii )
+            fShards.push_back( std::make_unique< SShard >() );
+        setMaxSize( maxSize );
+    }
+
+    CRegExCache::~CRegExCache()
+    {
+    }
+
+    CRegExCache::SShard & CRegExCache::shardFor( size_t hash ) const
+    {
+        return *fShards[ ( hash >> 7 ) % fShards.size() ];
+    }
+
+    QRegularExpression CRegExCache::get( const std::string & pattern, bool nocase )
+    {
+        return get( pattern, nocase ? QRegularExpression::CaseInsensitiveOption : QRegularExpression::NoPatternOption );
+    }
+
+    QRegularExpression CRegExCache::getWildcard( const std::string & wildcard, bool nocase )
+    {
+        return get( wildcard, nocase ? QRegularExpression::CaseInsensitiveOption : QRegularExpression::NoPatternOption, true );
+    }
+
+    QRegularExpression CRegExCache::get( const std::string & pattern, QRegularExpression::PatternOptions options )
+    {
+        return get( pattern, options, false );
+    }
+
+    QRegularExpression CRegExCache::get( const std::string & pattern, QRegularExpression::PatternOptions options, bool isWildcard )
+    {
+        TKey key( pattern, static_cast< int >( options ) | ( isWildcard ? kWildcardKey : 0 ) );
+        auto compile = [ & ]()
+        {
+            auto qPattern = QString::fromStdString( pattern );
+            if ( isWildcard )
+                qPattern = wildcardToRegEx( qPattern );
+            SEntry retVal;
+            retVal.fRegExp = QRegularExpression( qPattern, options );
+            if ( retVal.fRegExp.isValid() )
+                retVal.fRegExp.optimize();
+            return retVal;
+        };
+        return lookup( key, compile ).fRegExp;
+    }
+
+    std::shared_ptr< const CByteRegEx > CRegExCache::getByteRegEx( const std::string & pattern, bool nocase )
+    {
+        TKey key( pattern, ( nocase ? 1 : 0 ) | kByteRegExKey );
+        auto compile = [ & ]()
+        {
+            SEntry retVal;
+            auto regExp = std::make_shared< CByteRegEx >( pattern, nocase );
+            if ( regExp->isValid() )
+                retVal.fByteRegEx = regExp;
+            return retVal;
+        };
+        return lookup( key, compile ).fByteRegEx;
+    }
+
+    CRegExCache::SEntry CRegExCache::lookup( const TKey & key, const std::function< SEntry() > & compile )
+    {
+        auto hash = SKeyHash()( key );
+        auto & shard = shardFor( hash );
+        {
+            std::lock_guard< std::mutex > lock( shard.fMutex );
+            auto pos = shard.fMap.find( key );
+            if ( pos != shard.fMap.end() )
+            {
+                fHits++;
+                shard.fLRU.splice( shard.fLRU.begin(), shard.fLRU, ( *pos ).second );
+                return ( *pos ).second->second;
+            }
+        }
+
+        // compile outside of the lock, two threads may compile the same pattern, the first one in wins
+        fMisses++;
+        auto entry = compile();
+
+        std::lock_guard< std::mutex > lock( shard.fMutex );
+        auto pos = shard.fMap.find( key );
+        if ( pos != shard.fMap.end() )
+            return ( *pos ).second->second;
+
+        if ( shard.fMaxSize == 0 )
+            return entry;
+
+        shard.fLRU.emplace_front( key, entry );
+        shard.fMap[ key ] = shard.fLRU.begin();
+        shard.trim();
+        return entry;
+    }
+
+    void CRegExCache::clear()
+    {
+        for ( auto && ii : fShards )
+        {
+            std::lock_guard< std::mutex > lock( ii->fMutex );
+            ii->fMap.clear();
+            ii->fLRU.clear();
+        }
+    }
+
+    void CRegExCache::setMaxSize( size_t maxSize )
+    {
+        fMaxSize = maxSize;
+        auto perShard = ( maxSize + fShards.size() - 1 ) / fShards.size();
+        for ( auto && ii : fShards )
+        {
+            std::lock_guard< std::mutex > lock( ii->fMutex );
+            ii->fMaxSize = perShard;
+            ii->trim();
+        }
+    }
+
+    size_t CRegExCache::size() const
+    {
+        size_t retVal = 0;
+        for ( auto && ii : fShards )
+        {
+            std::lock_guard< std::mutex > lock( ii->fMutex );
+            retVal += ii->fMap.size();
+        }
+        return retVal;
+    }
+
+    void CRegExCache::resetCounters()
+    {
+        fHits = 0;
+        fMisses = 0;
+    }
+}
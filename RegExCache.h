@@ -0,0 +1,92 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __REGEXCACHE_H
+#define __REGEXCACHE_H
+
+#include <QRegularExpression>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace NStringUtils
+{
+    class CByteRegEx;
+
+    // Thread safe, bounded cache of compiled (and JIT optimized) regular expressions
+    // keyed on the UTF-8 pattern and the pattern options.  The cache is split into
+    // shards, each with its own lock and LRU list so concurrent lookups of different
+    // patterns rarely contend.
+    //
+    // QRegularExpression is implicitly shared, the returned copy is cheap and safe to
+    // use for matching from any thread.  The byte oriented matchers share the LRU with
+    // the QRegularExpressions, under their own keys.
+    class CRegExCache
+    {
+    public:
+        static CRegExCache * instance();
+
+        CRegExCache( size_t maxSize = 4096, size_t numShards = 16 );
+        ~CRegExCache();
+
+        QRegularExpression get( const std::string & pattern, QRegularExpression::PatternOptions options = QRegularExpression::NoPatternOption );
+        QRegularExpression get( const std::string & pattern, bool nocase );
+        // QRegExp::Wildcard style, * and ? match any character including / and \, [...] is a
+        // set, anchored at both ends like QRegExp::exactMatch
+        QRegularExpression getWildcard( const std::string & wildcard, bool nocase = false );
+        // nullptr when the pattern is outside of the CByteRegEx subset (or invalid), the
+        // QRegularExpression from get() has to be used for it
+        std::shared_ptr< const CByteRegEx > getByteRegEx( const std::string & pattern, bool nocase = false );
+
+        void clear();
+        void setMaxSize( size_t maxSize );
+        size_t maxSize() const { return fMaxSize; }
+        size_t size() const;
+
+        uint64_t hits() const { return fHits; }
+        uint64_t misses() const { return fMisses; }
+        void resetCounters();
+    private:
+        QRegularExpression get( const std::string & pattern, QRegularExpression::PatternOptions options, bool isWildcard );
+
+        struct SEntry;
+        struct SShard;
+        // the cached entry for key, compile() creates it on a miss
+        SEntry lookup( const std::pair< std::string, int > & key, const std::function< SEntry() > & compile );
+        SShard & shardFor( size_t hash ) const;
+
+        size_t fMaxSize{ 0 };
+        std::vector< std::unique_ptr< SShard > > fShards;
+        std::atomic< uint64_t > fHits{ 0 };
+        std::atomic< uint64_t > fMisses{ 0 };
+    };
+}
+
+#endif
@@ -0,0 +1,351 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "RegExSet.h"
+#include "StringUtils.h"
+#include "SIMDUtils.h"
+
+#include <cctype>
+#include <map>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace NStringUtils
+{
+    namespace
+    {
+        // index of the ']' closing the class opened at pos, the length of regEx when it is not closed
+        size_t classEnd( const std::string & regEx, size_t pos )
+        {
+            auto ii = pos + 1;
+            if ( ( ii < regEx.length() ) && ( regEx[ ii ] == '^' ) )
+                ii++;
+            if ( ( ii < regEx.length() ) && ( regEx[ ii ] == ']' ) ) // a leading ']' is a member
+                ii++;
+            for ( ; ii < regEx.length(); ++ii )
+            {
+                if ( regEx[ ii ] == '\\' )
+                    ii++;
+                else if ( regEx[ ii ] == ']' )
+                    return ii;
+            }
+            return regEx.length();
+        }
+
+        // calls func( pos, depth ) for every '(', ')' and '|' outside of escapes and classes, depth is before the character
+        template< typename T >
+        void forEachStructural( const std::string & regEx, T func )
+        {
+            int depth = 0;
+            for ( size_t ii = 0; ii < regEx.length(); ++ii )
+            {
+                auto ch = regEx[ ii ];
+                if ( ch == '\\' )
+                    ii++;
+                else if ( ch == '[' )
+                    ii = classEnd( regEx, ii );
+                else if ( ( ch == '(' ) || ( ch == ')' ) || ( ch == '|' ) )
+                {
+                    if ( !func( ii, depth ) )
+                        return;
+                    if ( ch == '(' )
+                        depth++;
+                    else if ( ( ch == ')' ) && ( depth > 0 ) )
+                        depth--;
+                }
+            }
+        }
+
+        std::vector< size_t > topLevelBars( const std::string & regEx )
+        {
+            std::vector< size_t > retVal;
+            forEachStructural( regEx,
+                               [ & ]( size_t pos, int depth )
+                               {
+                                   if ( ( depth == 0 ) && ( regEx[ pos ] == '|' ) )
+                                       retVal.push_back( pos );
+                                   return true;
+                               } );
+            return retVal;
+        }
+
+        // removes groups around all of regEx, "((a))" and "(?:a)" become "a", "(a)(b)" and "(?=a)" are unchanged
+        std::string stripOuterGroup( std::string regEx )
+        {
+            while ( ( regEx.length() >= 2 ) && ( regEx.front() == '(' ) )
+            {
+                size_t close = std::string::npos;
+                forEachStructural( regEx,
+                                   [ & ]( size_t pos, int depth )
+                                   {
+                                       if ( ( depth == 1 ) && ( regEx[ pos ] == ')' ) )
+                                       {
+                                           close = pos;
+                                           return false;
+                                       }
+                                       return true;
+                                   } );
+                if ( close != ( regEx.length() - 1 ) )
+                    break;
+
+                size_t open = 1;
+                if ( regEx.compare( 0, 3, "(?:" ) == 0 )
+                    open = 3;
+                else if ( regEx[ 1 ] == '?' ) // look arounds, named groups and inline options
+                    break;
+                regEx = regEx.substr( open, regEx.length() - open - 1 );
+            }
+            return regEx;
+        }
+
+        void splitAlternation( const std::string & regEx, std::set< std::string > & alternatives )
+        {
+            size_t start = 0;
+            auto bars = topLevelBars( regEx );
+            bars.push_back( regEx.length() );
+            for ( auto && bar : bars )
+            {
+                auto alternative = stripOuterGroup( regEx.substr( start, bar - start ) );
+                start = bar + 1;
+                if ( alternative.empty() )
+                    continue;
+                // a group that was removed may hold another alternation
+                if ( !topLevelBars( alternative ).empty() )
+                    splitAlternation( alternative, alternatives );
+                else
+                    alternatives.insert( alternative );
+            }
+        }
+
+        struct STrieNode
+        {
+            std::map< char, std::unique_ptr< STrieNode > > fChildren;
+            bool fTerminal{ false };
+        };
+
+        std::string escapeChar( char ch )
+        {
+            return encodeRegEx( std::string( 1, ch ) );
+        }
+
+        // sorted members, runs of 3 or more digits or letters become ranges
+        std::string charClass( const std::string & chars )
+        {
+            auto sameRun = []( char lhs, char rhs )
+            {
+                if ( ( rhs - lhs ) != 1 )
+                    return false;
+                auto uLhs = static_cast< unsigned char >( lhs );
+                auto uRhs = static_cast< unsigned char >( rhs );
+                return ( std::isdigit( uLhs ) && std::isdigit( uRhs ) ) || ( std::islower( uLhs ) && std::islower( uRhs ) ) || ( std::isupper( uLhs ) && std::isupper( uRhs ) );
+            };
+            auto member = []( char ch )
+            {
+                if ( ( ch == '\\' ) || ( ch == ']' ) || ( ch == '[' ) || ( ch == '^' ) || ( ch == '-' ) )
+                    return std::string( "\\" ) + ch;
+                return std::string( 1, ch );
+            };
+
+            std::string retVal = "[";
+            for ( size_t ii = 0; ii < chars.length(); )
+            {
+                auto jj = ii;
+                while ( ( ( jj + 1 ) < chars.length() ) && sameRun( chars[ jj ], chars[ jj + 1 ] ) )
+                    jj++;
+                if ( ( jj - ii ) >= 2 )
+                    retVal += member( chars[ ii ] ) + "-" + member( chars[ jj ] );
+                else
+                {
+                    for ( auto kk = ii; kk <= jj; ++kk )
+                        retVal += member( chars[ kk ] );
+                }
+                ii = jj + 1;
+            }
+            return retVal + "]";
+        }
+
+        // the alternatives for what follows node, atom is set when there is exactly one and it is a single character or class
+        std::vector< std::string > trieAlternatives( const STrieNode & node, bool & atom )
+        {
+            std::vector< std::string > retVal;
+            std::string lastChars; // children that end the string, they are merged into a class
+            for ( auto && ii : node.fChildren )
+            {
+                auto & child = *ii.second;
+                if ( child.fChildren.empty() )
+                {
+                    lastChars.push_back( ii.first );
+                    continue;
+                }
+
+                bool childAtom = false;
+                auto childAlternatives = trieAlternatives( child, childAtom );
+                std::string rest;
+                if ( childAlternatives.size() == 1 )
+                    rest = childAlternatives.front();
+                else
+                {
+                    rest = "(?:" + joinString( childAlternatives, "|" ) + ")";
+                    childAtom = true;
+                }
+                if ( child.fTerminal )
+                    rest = childAtom ? ( rest + "?" ) : ( "(?:" + rest + ")?" );
+                retVal.push_back( escapeChar( ii.first ) + rest );
+            }
+            if ( lastChars.length() == 1 )
+                retVal.push_back( escapeChar( lastChars.front() ) );
+            else if ( lastChars.length() > 1 )
+                retVal.push_back( charClass( lastChars ) );
+
+            atom = ( retVal.size() == 1 ) && !lastChars.empty();
+            return retVal;
+        }
+    }
+
+    size_t CRegExSet::SLiteralHash::operator()( const std::string & str ) const
+    {
+        return static_cast< size_t >( fNoCase ? NSIMDUtils::hashNoCase( str.data(), str.length() ) : NSIMDUtils::hashBytes( str.data(), str.length() ) );
+    }
+
+    bool CRegExSet::SLiteralEq::operator()( const std::string & lhs, const std::string & rhs ) const
+    {
+        return fNoCase ? NSIMDUtils::equalsNoCase( lhs.data(), lhs.length(), rhs.data(), rhs.length() ) : ( lhs == rhs );
+    }
+
+    CRegExSet::CRegExSet( bool nocase ) :
+        fNoCase( nocase ),
+        fLiterals( 16, SLiteralHash{ nocase }, SLiteralEq{ nocase } )
+    {
+    }
+
+    CRegExSet::CRegExSet( const std::string & regEx, bool nocase ) :
+        CRegExSet( nocase )
+    {
+        addPattern( regEx );
+    }
+
+    std::set< std::string > CRegExSet::splitAlternation( const std::string & regEx )
+    {
+        std::set< std::string > retVal;
+        NStringUtils::splitAlternation( regEx, retVal );
+        return retVal;
+    }
+
+    bool CRegExSet::isLiteral( const std::string & regEx, std::string * literal )
+    {
+        static const std::string_view sSpecial( "^$.*+?|()[]{}" );
+        std::string tmp;
+        for ( size_t ii = 0; ii < regEx.length(); ++ii )
+        {
+            auto ch = regEx[ ii ];
+            if ( ch == '\\' )
+            {
+                // \d, \n, \x41 and friends are not worth decoding
+                if ( ( ( ii + 1 ) >= regEx.length() ) || std::isalnum( static_cast< unsigned char >( regEx[ ii + 1 ] ) ) )
+                    return false;
+                ch = regEx[ ++ii ];
+            }
+            else if ( sSpecial.find( ch ) != std::string_view::npos )
+                return false;
+            tmp.push_back( ch );
+        }
+        if ( literal )
+            *literal = std::move( tmp );
+        return true;
+    }
+
+    void CRegExSet::addPattern( const std::string & regEx )
+    {
+        for ( auto && ii : splitAlternation( regEx ) )
+            addAlternative( ii );
+    }
+
+    void CRegExSet::addLiteral( const std::string & literal )
+    {
+        addAlternative( encodeRegEx( literal ) );
+    }
+
+    void CRegExSet::addAlternative( const std::string & regEx )
+    {
+        if ( regEx.empty() || !fPatterns.insert( regEx ).second )
+            return;
+
+        std::string literal;
+        if ( isLiteral( regEx, &literal ) )
+        {
+            fLiterals.insert( literal );
+            return;
+        }
+        fNonLiterals.insert( regEx );
+        if ( !fNonLiteralPattern.empty() )
+            fNonLiteralPattern += "|";
+        fNonLiteralPattern += regEx;
+    }
+
+    bool CRegExSet::exactMatch( const std::string & data ) const
+    {
+        if ( fLiterals.find( data ) != fLiterals.end() )
+            return true;
+        if ( fNonLiterals.empty() )
+            return false;
+        return isExactMatchRegEx( data, fNonLiteralPattern, fNoCase );
+    }
+
+    std::string CRegExSet::pattern() const
+    {
+        STrieNode root;
+        for ( auto && ii : fLiterals )
+        {
+            auto node = &root;
+            for ( auto && ch : ii )
+            {
+                auto & child = node->fChildren[ fNoCase ? NSIMDUtils::foldAsciiLower( ch ) : ch ];
+                if ( !child )
+                    child = std::make_unique< STrieNode >();
+                node = child.get();
+            }
+            node->fTerminal = true;
+        }
+
+        bool atom = false;
+        auto alternatives = trieAlternatives( root, atom );
+        alternatives.insert( alternatives.end(), fNonLiterals.begin(), fNonLiterals.end() );
+        return joinString( alternatives, "|" );
+    }
+
+    std::string CRegExSet::alternation() const
+    {
+        if ( fPatterns.size() == 1 )
+            return *fPatterns.begin();
+
+        std::string retVal;
+        for ( auto && ii : fPatterns )
+        {
+            if ( !retVal.empty() )
+                retVal += "|";
+            retVal += "(" + ii + ")";
+        }
+        return retVal;
+    }
+}
@@ -0,0 +1,103 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef __REGEXSET_H
+#define __REGEXSET_H
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <unordered_set>
+
+namespace NStringUtils
+{
+    // Set of regular expression alternatives, typically the encodeRegEx'ed object names that
+    // used to be joined into one large "(a)|(b)|..." pattern with addToRegEx.
+    //
+    // Alternations are split on their top level '|' only (escapes, classes and groups are
+    // respected), redundant outer groups are removed and nested alternations are flattened, so
+    // "(a)|(b|c)" and "c|b|a" are the same set.
+    //
+    // Literal alternatives are kept in a hash set, exactMatch only runs a regular expression for
+    // the alternatives that are not literals.  pattern() gives one expression for the whole set,
+    // with the literals factored into a trie (shared prefixes, character classes for the last
+    // character) so a matcher does not backtrack through every alternative.
+    class CRegExSet
+    {
+    public:
+        explicit CRegExSet( bool nocase = false );
+        CRegExSet( const std::string & regEx, bool nocase = false );
+        CRegExSet( const char * regEx, bool nocase = false ) : CRegExSet( std::string( regEx ), nocase ) {}
+
+        // every top level alternative of regEx is added, empty alternatives are ignored
+        void addPattern( const std::string & regEx );
+        // a plain string, matched as is
+        void addLiteral( const std::string & literal );
+
+        size_t size() const { return fPatterns.size(); }
+        bool empty() const { return fPatterns.empty(); }
+        bool nocase() const { return fNoCase; }
+        bool allLiterals() const { return fNonLiterals.empty(); }
+        // the alternatives, without their outer groups, literals are in encodeRegEx form
+        const std::set< std::string > & patterns() const { return fPatterns; }
+
+        // the whole of data matches one of the alternatives
+        bool exactMatch( const std::string & data ) const;
+
+        // one expression matching the same strings as the set, to be used with the same nocase
+        // empty for an empty set
+        std::string pattern() const;
+        // addToRegEx form, every alternative in parentheses, sorted and joined with '|'
+        std::string alternation() const;
+
+        // same alternatives, regardless of their order or grouping
+        bool operator==( const CRegExSet & rhs ) const { return fPatterns == rhs.fPatterns; }
+        bool operator!=( const CRegExSet & rhs ) const { return !operator==( rhs ); }
+
+        // the top level alternatives of regEx, as written
+        static std::set< std::string > splitAlternation( const std::string & regEx );
+        // true when regEx only matches one string, which is returned in literal
+        static bool isLiteral( const std::string & regEx, std::string * literal = nullptr );
+    private:
+        struct SLiteralHash
+        {
+            size_t operator()( const std::string & str ) const;
+            bool fNoCase{ false };
+        };
+        struct SLiteralEq
+        {
+            bool operator()( const std::string & lhs, const std::string & rhs ) const;
+            bool fNoCase{ false };
+        };
+
+        void addAlternative( const std::string & regEx );
+
+        bool fNoCase{ false };
+        std::set< std::string > fPatterns;
+        std::unordered_set< std::string, SLiteralHash, SLiteralEq > fLiterals;
+        std::set< std::string > fNonLiterals;
+        std::string fNonLiteralPattern; // the non literal alternatives joined with '|'
+    };
+}
+
+#endif
@@ -0,0 +1,381 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ReportWriter.h"
+
+#include <QDataStream>
+#include <QDir>
+#include <QIODevice>
+#include <QTemporaryFile>
+
+#include <algorithm>
+#include <ostream>
+#include <queue>
+
+namespace NStringUtils
+{
+    namespace
+    {
+        const size_t kBufferSize = 64 * 1024;
+
+        void appendSpaces( QString & line, int count )
+        {
+            static const QString sSpaces( 256, ' ' );
+            while ( count > 0 )
+            {
+                auto curr = std::min( count, sSpaces.length() );
+                line.append( sSpaces.constData(), curr );
+                count -= curr;
+            }
+        }
+
+        void appendUtf8( std::string & out, const QString & str )
+        {
+            auto data = str.constData();
+            auto len = str.length();
+            for ( int ii = 0; ii < len; ++ii )
+            {
+                uint ch = data[ ii ].unicode();
+                if ( ch < 0x80 )
+                    out.push_back( static_cast< char >( ch ) );
+                else if ( ch < 0x800 )
+                {
+                    out.push_back( static_cast< char >( 0xC0 | ( ch >> 6 ) ) );
+                    out.push_back( static_cast< char >( 0x80 | ( ch & 0x3F ) ) );
+                }
+                else
+                {
+                    if ( QChar::isHighSurrogate( ch ) && ( ( ii + 1 ) < len ) && data[ ii + 1 ].isLowSurrogate() )
+                    {
+                        ch = QChar::surrogateToUcs4( static_cast< ushort >( ch ), data[ ++ii ].unicode() );
+                        out.push_back( static_cast< char >( 0xF0 | ( ch >> 18 ) ) );
+                        out.push_back( static_cast< char >( 0x80 | ( ( ch >> 12 ) & 0x3F ) ) );
+                    }
+                    else
+                        out.push_back( static_cast< char >( 0xE0 | ( ch >> 12 ) ) );
+                    out.push_back( static_cast< char >( 0x80 | ( ( ch >> 6 ) & 0x3F ) ) );
+                    out.push_back( static_cast< char >( 0x80 | ( ch & 0x3F ) ) );
+                }
+            }
+        }
+    }
+
+    CReportWriter::CReportWriter( QIODevice * device, const QStringList & columnNames, const QStringList & subHeader, bool sortData ) :
+        fDevice( device ),
+        fSortData( sortData )
+    {
+        init( columnNames, subHeader );
+    }
+
+    CReportWriter::CReportWriter( std::ostream & stream, const QStringList & columnNames, const QStringList & subHeader, bool sortData ) :
+        fStream( &stream ),
+        fSortData( sortData )
+    {
+        init( columnNames, subHeader );
+    }
+
+    CReportWriter::~CReportWriter()
+    {
+        if ( !fFinished )
+            finish();
+    }
+
+    void CReportWriter::init( const QStringList & columnNames, const QStringList & subHeader )
+    {
+        fColumnNames = columnNames;
+        fSubHeader = subHeader;
+        fTempDir = QDir::tempPath();
+
+        Q_ASSERT( subHeader.isEmpty() || ( subHeader.size() == columnNames.size() ) );
+        fWidths.resize( columnNames.size() );
+        for ( int ii = 0; ii < columnNames.size(); ++ii )
+            fWidths[ ii ] = columnNames[ ii ].length() + 1;
+        for ( int ii = 0; ( ii < subHeader.size() ) && ( ii < columnNames.size() ); ++ii )
+            fWidths[ ii ] = std::max( fWidths[ ii ], subHeader[ ii ].length() + 1 );
+        fBuffer.reserve( kBufferSize + 1024 );
+    }
+
+    void CReportWriter::appendPadded( QString & line, const QString & cell, int width, EPadType padType )
+    {
+        auto diff = std::max( 0, width - cell.length() );
+        switch ( padType )
+        {
+            case EPadType::eLeftJustify:
+                line.append( cell );
+                appendSpaces( line, diff );
+                break;
+            case EPadType::eRightJustify:
+                appendSpaces( line, diff );
+                line.append( cell );
+                break;
+            default:
+            case EPadType::eCenter:
+                appendSpaces( line, diff / 2 );
+                line.append( cell );
+                appendSpaces( line, diff - ( diff / 2 ) );
+                break;
+        }
+    }
+
+    void CReportWriter::appendRow( QString & line, const QStringList & row, const std::vector< int > & widths, EPadType padType )
+    {
+        for ( int ii = 0; ( ii < static_cast< int >( widths.size() ) ) && ( ii < row.size() ); ++ii )
+        {
+            appendPadded( line, row[ ii ], widths[ ii ], padType );
+            appendSpaces( line, 2 );
+        }
+    }
+
+    void CReportWriter::setError( const QString & msg )
+    {
+        if ( fError.isEmpty() )
+            fError = msg;
+    }
+
+    std::unique_ptr< QTemporaryFile > CReportWriter::createTempFile()
+    {
+        auto retVal = std::make_unique< QTemporaryFile >( QDir( fTempDir ).absoluteFilePath( "report_XXXXXX.tmp" ) );
+        if ( !retVal->open() )
+        {
+            setError( QString( "Could not create temporary file in '%1': %2" ).arg( fTempDir ).arg( retVal->errorString() ) );
+            return {};
+        }
+        return retVal;
+    }
+
+    void CReportWriter::updateWidths( const QStringList & row )
+    {
+        Q_ASSERT( row.size() == static_cast< int >( fWidths.size() ) );
+        for ( int ii = 0; ( ii < static_cast< int >( fWidths.size() ) ) && ( ii < row.size() ); ++ii )
+            fWidths[ ii ] = std::max( fWidths[ ii ], row[ ii ].length() + 1 );
+    }
+
+    bool CReportWriter::addRow( const QStringList & row )
+    {
+        if ( fFinished || !fError.isEmpty() )
+            return false;
+
+        if ( fWidthsFixed )
+        {
+            emitRow( row );
+            return fError.isEmpty();
+        }
+
+        updateWidths( row );
+        if ( fSampleSize )
+        {
+            fPending << row;
+            if ( static_cast< size_t >( fPending.size() ) >= fSampleSize )
+            {
+                fixWidths();
+                for ( auto && ii : fPending )
+                    emitRow( ii );
+                fPending.clear();
+            }
+            return fError.isEmpty();
+        }
+
+        if ( !fSpool )
+        {
+            fSpool = createTempFile();
+            if ( !fSpool )
+                return false;
+            fSpoolStream = std::make_unique< QDataStream >( fSpool.get() );
+        }
+        *fSpoolStream << row;
+        if ( fSpoolStream->status() != QDataStream::Ok )
+            setError( QString( "Could not write to temporary file '%1'" ).arg( fSpool->fileName() ) );
+        return fError.isEmpty();
+    }
+
+    void CReportWriter::fixWidths()
+    {
+        fWidthsFixed = true;
+
+        int lineLength = 0;
+        for ( auto && ii : fWidths )
+            lineLength += ii + 2;
+        fLine.reserve( lineLength );
+
+        fLine.resize( 0 );
+        appendRow( fLine, fColumnNames, fWidths, EPadType::eCenter );
+        writeLine( fLine );
+
+        QString dashes;
+        for ( auto && ii : fWidths )
+            dashes += QString( ii, '-' ) + "  ";
+        writeLine( dashes );
+
+        if ( !fSubHeader.isEmpty() )
+        {
+            fLine.resize( 0 );
+            appendRow( fLine, fSubHeader, fWidths, EPadType::eLeftJustify );
+            writeLine( fLine );
+            writeLine( dashes );
+        }
+    }
+
+    void CReportWriter::emitRow( const QStringList & row )
+    {
+        fLine.resize( 0 );
+        appendRow( fLine, row, fWidths, EPadType::eLeftJustify );
+        if ( !fSortData )
+        {
+            writeLine( fLine );
+            return;
+        }
+
+        fLines.push_back( fLine );
+        if ( fLines.size() >= fMaxRowsInMemory )
+            flushRun();
+    }
+
+    void CReportWriter::writeLine( const QString & line )
+    {
+        appendUtf8( fBuffer, line );
+        fBuffer.push_back( '\n' );
+        if ( fBuffer.size() >= kBufferSize )
+            flushBuffer();
+    }
+
+    void CReportWriter::flushBuffer()
+    {
+        if ( fBuffer.empty() )
+            return;
+        if ( fDevice )
+        {
+            if ( fDevice->write( fBuffer.data(), static_cast< qint64 >( fBuffer.size() ) ) != static_cast< qint64 >( fBuffer.size() ) )
+                setError( QString( "Could not write report: %1" ).arg( fDevice->errorString() ) );
+        }
+        else if ( fStream )
+        {
+            fStream->write( fBuffer.data(), static_cast< std::streamsize >( fBuffer.size() ) );
+            if ( !*fStream )
+                setError( "Could not write report" );
+        }
+        fBuffer.clear();
+    }
+
+    bool CReportWriter::flushRun()
+    {
+        std::sort( fLines.begin(), fLines.end() );
+        auto run = createTempFile();
+        if ( !run )
+            return false;
+
+        QDataStream ds( run.get() );
+        for ( auto && ii : fLines )
+            ds << ii;
+        if ( ds.status() != QDataStream::Ok )
+        {
+            setError( QString( "Could not write to temporary file '%1'" ).arg( run->fileName() ) );
+            return false;
+        }
+        run->flush();
+        fRuns.push_back( std::move( run ) );
+        fLines.clear();
+        return true;
+    }
+
+    void CReportWriter::mergeRuns()
+    {
+        std::vector< std::unique_ptr< QDataStream > > streams;
+        using TEntry = std::pair< QString, size_t >;
+        auto greater = []( const TEntry & lhs, const TEntry & rhs ) { return rhs.first < lhs.first; };
+        std::priority_queue< TEntry, std::vector< TEntry >, decltype( greater ) > heap( greater );
+
+        auto readNext = [ &streams, &heap ]( size_t idx )
+        {
+            auto && ds = *streams[ idx ];
+            if ( ds.atEnd() )
+                return;
+            QString line;
+            ds >> line;
+            heap.emplace( std::move( line ), idx );
+        };
+
+        for ( size_t ii = 0; ii < fRuns.size(); ++ii )
+        {
+            fRuns[ ii ]->seek( 0 );
+            streams.push_back( std::make_unique< QDataStream >( fRuns[ ii ].get() ) );
+            readNext( ii );
+        }
+
+        while ( !heap.empty() && fError.isEmpty() )
+        {
+            auto idx = heap.top().second;
+            writeLine( heap.top().first );
+            heap.pop();
+            readNext( idx );
+        }
+        fRuns.clear();
+    }
+
+    bool CReportWriter::finish( QString * msg )
+    {
+        if ( !fFinished )
+        {
+            fFinished = true;
+            if ( !fWidthsFixed )
+            {
+                fixWidths();
+                for ( auto && ii : fPending )
+                    emitRow( ii );
+                fPending.clear();
+
+                if ( fSpool && fError.isEmpty() )
+                {
+                    fSpool->seek( 0 );
+                    QDataStream ds( fSpool.get() );
+                    QStringList row;
+                    while ( !ds.atEnd() && fError.isEmpty() )
+                    {
+                        ds >> row;
+                        emitRow( row );
+                    }
+                }
+                fSpoolStream.reset();
+                fSpool.reset();
+            }
+
+            if ( fSortData && fError.isEmpty() )
+            {
+                if ( fRuns.empty() )
+                {
+                    std::sort( fLines.begin(), fLines.end() );
+                    for ( auto && ii : fLines )
+                        writeLine( ii );
+                }
+                else if ( fLines.empty() || flushRun() )
+                    mergeRuns();
+                fLines.clear();
+            }
+            flushBuffer();
+            if ( fStream )
+                fStream->flush();
+        }
+
+        if ( msg )
+            *msg = fError;
+        return fError.isEmpty();
+    }
+}
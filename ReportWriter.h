@@ -0,0 +1,111 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __REPORTWRITER_H
+#define __REPORTWRITER_H
+
+#include "StringUtils.h"
+
+#include <QString>
+#include <QStringList>
+#include <QList>
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+class QIODevice;
+class QTemporaryFile;
+class QDataStream;
+
+namespace NStringUtils
+{
+    // Streaming version of asReport, produces the identical layout (one line per row, each
+    // cell padded to the column width plus 2 spaces) but writes straight to a QIODevice or
+    // std::ostream as UTF-8.
+    //
+    // By default the column widths come from every row, the rows are spooled to a temporary
+    // file until finish() so memory stays bounded by a single row.  setSampleSize( N ) sizes
+    // the columns from the first N rows only, after which rows are written as they are added.
+    // Cells wider than a sampled column push the rest of that line over.
+    //
+    // Sorted output is sorted on the formatted line, as asReport does.  Up to maxRowsInMemory
+    // lines are sorted in memory, larger reports are sorted in runs and merged from temporary
+    // files.
+    class CReportWriter
+    {
+    public:
+        CReportWriter( QIODevice * device, const QStringList & columnNames, const QStringList & subHeader = QStringList(), bool sortData = false );
+        CReportWriter( std::ostream & stream, const QStringList & columnNames, const QStringList & subHeader = QStringList(), bool sortData = false );
+        ~CReportWriter();
+
+        // must be set before the first row is added
+        void setSampleSize( size_t numRows ) { fSampleSize = numRows; }
+        void setMaxRowsInMemory( size_t numRows ) { fMaxRowsInMemory = numRows ? numRows : 1; }
+        void setTempDir( const QString & tempDir ) { fTempDir = tempDir; }
+
+        bool addRow( const QStringList & row );
+        // writes anything still pending, returns false if a write failed
+        bool finish( QString * msg = nullptr );
+
+        // appends the cells of row, padded to widths, followed by 2 spaces each, without temporaries
+        static void appendRow( QString & line, const QStringList & row, const std::vector< int > & widths, EPadType padType );
+        static void appendPadded( QString & line, const QString & cell, int width, EPadType padType );
+    private:
+        void init( const QStringList & columnNames, const QStringList & subHeader );
+        void updateWidths( const QStringList & row );
+        void fixWidths();
+        void emitRow( const QStringList & row );
+        void writeLine( const QString & line );
+        void flushBuffer();
+        bool flushRun();
+        void mergeRuns();
+        std::unique_ptr< QTemporaryFile > createTempFile();
+        void setError( const QString & msg );
+
+        QIODevice * fDevice{ nullptr };
+        std::ostream * fStream{ nullptr };
+        QStringList fColumnNames;
+        QStringList fSubHeader;
+        bool fSortData{ false };
+        size_t fSampleSize{ 0 };
+        size_t fMaxRowsInMemory{ 500000 };
+        QString fTempDir;
+
+        std::vector< int > fWidths;
+        bool fWidthsFixed{ false };
+        bool fFinished{ false };
+        QString fError;
+
+        QList< QStringList > fPending; // sample rows
+        std::unique_ptr< QTemporaryFile > fSpool; // rows added before the widths are known
+        std::unique_ptr< QDataStream > fSpoolStream;
+        std::vector< QString > fLines; // current sort run
+        std::vector< std::unique_ptr< QTemporaryFile > > fRuns;
+
+        QString fLine;
+        std::string fBuffer;
+    };
+}
+
+#endif
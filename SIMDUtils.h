@@ -0,0 +1,587 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __SIMDUTILS_H
+#define __SIMDUTILS_H
+
+// Small set of byte scanning and formatting primitives shared by the string utilities.
+// SSE2 is used when the compiler guarantees it (all x86_64 targets), every
+// routine has a scalar fallback that produces identical results.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define SAB_HAS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace NSIMDUtils
+{
+    inline unsigned int countTrailingZeros( uint32_t mask )
+    {
+#ifdef _MSC_VER
+        unsigned long retVal;
+        _BitScanForward( &retVal, mask );
+        return static_cast< unsigned int >( retVal );
+#else
+        return static_cast< unsigned int >( __builtin_ctz( mask ) );
+#endif
+    }
+
+    // value must not be 0
+    inline unsigned int countLeadingZeros( uint64_t value )
+    {
+#ifdef _MSC_VER
+        unsigned long retVal;
+        _BitScanReverse64( &retVal, value );
+        return 63 - static_cast< unsigned int >( retVal );
+#else
+        return static_cast< unsigned int >( __builtin_clzll( value ) );
+#endif
+    }
+
+    // 256 entry membership table, used for the scalar paths and for
+    // delimiter sets too large for the vector path
+    class CByteSet
+    {
+    public:
+        CByteSet(){ std::memset( fTable, 0, sizeof( fTable ) ); }
+        CByteSet( const char * chars, size_t len ) : CByteSet() { add( chars, len ); }
+
+        void add( char ch )
+        {
+            auto uch = static_cast< unsigned char >( ch );
+            if ( fTable[ uch ] )
+                return;
+            fTable[ uch ] = true;
+            if ( fNumChars < sizeof( fChars ) )
+                fChars[ fNumChars ] = ch;
+            fNumChars++;
+        }
+        void add( const char * chars, size_t len )
+        {
+            for ( size_t ii = 0; ii < len; ++ii )
+                add( chars[ ii ] );
+        }
+
+        bool contains( char ch ) const { return fTable[ static_cast< unsigned char >( ch ) ]; }
+        size_t size() const { return fNumChars; }
+        // only valid when size() <= 16
+        const char * chars() const { return fChars; }
+    private:
+        bool fTable[ 256 ];
+        char fChars[ 16 ]{ 0 };
+        size_t fNumChars{ 0 };
+    };
+
+    // returns the index of the first byte in [data+from, data+len) contained in set, std::string::npos if none
+    inline size_t findFirstOf( const char * data, size_t len, size_t from, const CByteSet & set )
+    {
+        if ( from >= len )
+            return std::string::npos;
+
+        if ( set.size() == 1 )
+        {
+            auto pos = static_cast< const char * >( std::memchr( data + from, set.chars()[ 0 ], len - from ) );
+            return pos ? static_cast< size_t >( pos - data ) : std::string::npos;
+        }
+
+        size_t ii = from;
+#ifdef SAB_HAS_SSE2
+        if ( set.size() <= 16 )
+        {
+            __m128i needles[ 16 ];
+            auto numNeedles = set.size();
+            for ( size_t jj = 0; jj < numNeedles; ++jj )
+                needles[ jj ] = _mm_set1_epi8( set.chars()[ jj ] );
+
+            for ( ; ( ii + 16 ) <= len; ii += 16 )
+            {
+                auto block = _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + ii ) );
+                auto matches = _mm_cmpeq_epi8( block, needles[ 0 ] );
+                for ( size_t jj = 1; jj < numNeedles; ++jj )
+                    matches = _mm_or_si128( matches, _mm_cmpeq_epi8( block, needles[ jj ] ) );
+                auto mask = static_cast< uint32_t >( _mm_movemask_epi8( matches ) );
+                if ( mask )
+                    return ii + countTrailingZeros( mask );
+            }
+        }
+#endif
+        for ( ; ii < len; ++ii )
+        {
+            if ( set.contains( data[ ii ] ) )
+                return ii;
+        }
+        return std::string::npos;
+    }
+
+    // calls func( index ) for every occurrence of ch in [data, data+len), in order
+    // dense matches (newlines in short lines) are taken 16 at a time from one compare mask
+    template< typename T >
+    inline void forEachByte( const char * data, size_t len, char ch, T func )
+    {
+        size_t ii = 0;
+#ifdef SAB_HAS_SSE2
+        auto needle = _mm_set1_epi8( ch );
+        for ( ; ( ii + 16 ) <= len; ii += 16 )
+        {
+            auto block = _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + ii ) );
+            auto mask = static_cast< uint32_t >( _mm_movemask_epi8( _mm_cmpeq_epi8( block, needle ) ) );
+            while ( mask )
+            {
+                func( ii + countTrailingZeros( mask ) );
+                mask &= mask - 1;
+            }
+        }
+#endif
+        for ( ; ii < len; ++ii )
+        {
+            if ( data[ ii ] == ch )
+                func( ii );
+        }
+    }
+
+    // number of occurrences of ch in [data, data+len)
+    inline size_t countByte( const char * data, size_t len, char ch )
+    {
+        size_t retVal = 0;
+        size_t ii = 0;
+#ifdef SAB_HAS_SSE2
+        auto needle = _mm_set1_epi8( ch );
+        while ( ( ii + 16 ) <= len )
+        {
+            // per byte counters, summed before any of them can overflow
+            auto counts = _mm_setzero_si128();
+            for ( int jj = 0; ( jj < 255 ) && ( ( ii + 16 ) <= len ); ++jj, ii += 16 )
+            {
+                auto block = _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + ii ) );
+                counts = _mm_sub_epi8( counts, _mm_cmpeq_epi8( block, needle ) );
+            }
+            auto sums = _mm_sad_epu8( counts, _mm_setzero_si128() );
+            retVal += static_cast< size_t >( _mm_cvtsi128_si32( sums ) + _mm_extract_epi16( sums, 4 ) );
+        }
+#endif
+        for ( ; ii < len; ++ii )
+        {
+            if ( data[ ii ] == ch )
+                retVal++;
+        }
+        return retVal;
+    }
+
+    // bit ii set when data[ ii ] == value, for the 16 bytes at data
+    inline uint32_t matchBytes16( const uint8_t * data, uint8_t value )
+    {
+#ifdef SAB_HAS_SSE2
+        auto block = _mm_loadu_si128( reinterpret_cast< const __m128i * >( data ) );
+        return static_cast< uint32_t >( _mm_movemask_epi8( _mm_cmpeq_epi8( block, _mm_set1_epi8( static_cast< char >( value ) ) ) ) );
+#else
+        uint32_t retVal = 0;
+        for ( uint32_t ii = 0; ii < 16; ++ii )
+        {
+            if ( data[ ii ] == value )
+                retVal |= 1U << ii;
+        }
+        return retVal;
+#endif
+    }
+
+    // true when no byte in [data, data+len) has the high bit set
+    inline bool isAscii( const char * data, size_t len )
+    {
+        size_t ii = 0;
+#ifdef SAB_HAS_SSE2
+        for ( ; ( ii + 16 ) <= len; ii += 16 )
+        {
+            if ( _mm_movemask_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + ii ) ) ) )
+                return false;
+        }
+#endif
+        for ( ; ii < len; ++ii )
+        {
+            if ( static_cast< unsigned char >( data[ ii ] ) >= 0x80 )
+                return false;
+        }
+        return true;
+    }
+
+    inline uint64_t byteSwap( uint64_t value )
+    {
+#ifdef _MSC_VER
+        return _byteswap_uint64( value );
+#else
+        return __builtin_bswap64( value );
+#endif
+    }
+
+    // value of a hex digit, 0xFF for any other byte
+    inline const uint8_t * hexDigitValues()
+    {
+        static const struct STable
+        {
+            STable()
+            {
+                std::memset( fValues, 0xFF, sizeof( fValues ) );
+                for ( int ii = 0; ii < 10; ++ii )
+                    fValues[ '0' + ii ] = static_cast< uint8_t >( ii );
+                for ( int ii = 0; ii < 6; ++ii )
+                {
+                    fValues[ 'a' + ii ] = static_cast< uint8_t >( 10 + ii );
+                    fValues[ 'A' + ii ] = static_cast< uint8_t >( 10 + ii );
+                }
+            }
+            uint8_t fValues[ 256 ];
+        } sTable;
+        return sTable.fValues;
+    }
+
+    // true when every byte in [data, data+len) is a hex digit
+    inline bool isHexDigits( const char * data, size_t len )
+    {
+        size_t ii = 0;
+#ifdef SAB_HAS_SSE2
+        for ( ; ( ii + 16 ) <= len; ii += 16 )
+        {
+            auto block = _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + ii ) );
+            auto lower = _mm_or_si128( block, _mm_set1_epi8( 0x20 ) );
+            auto isDigit = _mm_and_si128( _mm_cmpgt_epi8( block, _mm_set1_epi8( '0' - 1 ) ), _mm_cmplt_epi8( block, _mm_set1_epi8( '9' + 1 ) ) );
+            auto isLetter = _mm_and_si128( _mm_cmpgt_epi8( lower, _mm_set1_epi8( 'a' - 1 ) ), _mm_cmplt_epi8( lower, _mm_set1_epi8( 'f' + 1 ) ) );
+            if ( _mm_movemask_epi8( _mm_or_si128( isDigit, isLetter ) ) != 0xFFFF )
+                return false;
+        }
+#endif
+        auto values = hexDigitValues();
+        for ( ; ii < len; ++ii )
+        {
+            if ( values[ static_cast< unsigned char >( data[ ii ] ) ] == 0xFF )
+                return false;
+        }
+        return true;
+    }
+
+    // converts exactly 16 hex digits, most significant first, false if any byte is not a hex digit
+    inline bool parseHex16( const char * data, uint64_t & value )
+    {
+#ifdef SAB_HAS_SSE2
+        auto block = _mm_loadu_si128( reinterpret_cast< const __m128i * >( data ) );
+        auto lower = _mm_or_si128( block, _mm_set1_epi8( 0x20 ) );
+        auto isDigit = _mm_and_si128( _mm_cmpgt_epi8( block, _mm_set1_epi8( '0' - 1 ) ), _mm_cmplt_epi8( block, _mm_set1_epi8( '9' + 1 ) ) );
+        auto isLetter = _mm_and_si128( _mm_cmpgt_epi8( lower, _mm_set1_epi8( 'a' - 1 ) ), _mm_cmplt_epi8( lower, _mm_set1_epi8( 'f' + 1 ) ) );
+        if ( _mm_movemask_epi8( _mm_or_si128( isDigit, isLetter ) ) != 0xFFFF )
+            return false;
+
+        auto nibbles = _mm_or_si128( _mm_and_si128( isDigit, _mm_sub_epi8( block, _mm_set1_epi8( '0' ) ) ), _mm_and_si128( isLetter, _mm_sub_epi8( lower, _mm_set1_epi8( 'a' - 10 ) ) ) );
+        // pairs of nibbles into bytes, then the 8 bytes into the low half, first digit in the lowest byte
+        auto pairs = _mm_or_si128( _mm_slli_epi16( _mm_and_si128( nibbles, _mm_set1_epi16( 0x00FF ) ), 4 ), _mm_srli_epi16( nibbles, 8 ) );
+        uint64_t bytes;
+        _mm_storel_epi64( reinterpret_cast< __m128i * >( &bytes ), _mm_packus_epi16( pairs, pairs ) );
+        value = byteSwap( bytes );
+        return true;
+#else
+        auto values = hexDigitValues();
+        value = 0;
+        for ( size_t ii = 0; ii < 16; ++ii )
+        {
+            auto curr = values[ static_cast< unsigned char >( data[ ii ] ) ];
+            if ( curr == 0xFF )
+                return false;
+            value = ( value << 4 ) | curr;
+        }
+        return true;
+#endif
+    }
+
+    // converts exactly 16 '0'/'1' characters, most significant first, false if any is neither
+    inline bool parseBin16( const char * data, uint32_t & value )
+    {
+#ifdef SAB_HAS_SSE2
+        auto block = _mm_loadu_si128( reinterpret_cast< const __m128i * >( data ) );
+        auto ones = _mm_cmpeq_epi8( block, _mm_set1_epi8( '1' ) );
+        auto zeros = _mm_cmpeq_epi8( block, _mm_set1_epi8( '0' ) );
+        if ( _mm_movemask_epi8( _mm_or_si128( ones, zeros ) ) != 0xFFFF )
+            return false;
+
+        // the mask has the first character in bit 0, reverse it
+        auto bits = static_cast< uint32_t >( _mm_movemask_epi8( ones ) );
+        bits = ( ( bits >> 1 ) & 0x5555 ) | ( ( bits & 0x5555 ) << 1 );
+        bits = ( ( bits >> 2 ) & 0x3333 ) | ( ( bits & 0x3333 ) << 2 );
+        bits = ( ( bits >> 4 ) & 0x0F0F ) | ( ( bits & 0x0F0F ) << 4 );
+        value = ( ( bits >> 8 ) & 0x00FF ) | ( ( bits & 0x00FF ) << 8 );
+        return true;
+#else
+        value = 0;
+        for ( size_t ii = 0; ii < 16; ++ii )
+        {
+            if ( ( data[ ii ] != '0' ) && ( data[ ii ] != '1' ) )
+                return false;
+            value = ( value << 1 ) | static_cast< uint32_t >( data[ ii ] == '1' );
+        }
+        return true;
+#endif
+    }
+
+    // ASCII only case folding, bytes outside of A-Z (including all non-ASCII bytes) are untouched
+    // so the results never depend on the current locale
+    inline uint64_t foldAsciiLower( uint64_t word )
+    {
+        const uint64_t kHigh = 0x8080808080808080ULL;
+        auto heptets = word & ~kHigh;
+        auto atLeastA = heptets + 0x3F3F3F3F3F3F3F3FULL; // high bit set when >= 'A'
+        auto pastZ = heptets + 0x2525252525252525ULL; // high bit set when > 'Z'
+        auto isUpper = atLeastA & ~pastZ & ~word & kHigh;
+        return word | ( isUpper >> 2 );
+    }
+
+    inline char foldAsciiLower( char ch )
+    {
+        return ( ( ch >= 'A' ) && ( ch <= 'Z' ) ) ? static_cast< char >( ch + ( 'a' - 'A' ) ) : ch;
+    }
+
+#ifdef SAB_HAS_SSE2
+    inline __m128i foldAsciiLower( __m128i block )
+    {
+        // signed compares, so bytes >= 0x80 are never upper case
+        auto isUpper = _mm_and_si128( _mm_cmpgt_epi8( block, _mm_set1_epi8( 'A' - 1 ) ), _mm_cmplt_epi8( block, _mm_set1_epi8( 'Z' + 1 ) ) );
+        return _mm_or_si128( block, _mm_and_si128( isUpper, _mm_set1_epi8( 0x20 ) ) );
+    }
+#endif
+
+    inline uint64_t loadWord( const char * data, size_t len = 8 )
+    {
+        uint64_t retVal = 0;
+        std::memcpy( &retVal, data, len );
+        return retVal;
+    }
+
+    inline uint64_t hashMix( uint64_t hash, uint64_t word )
+    {
+        hash ^= word * 0x9E3779B97F4A7C15ULL;
+        hash = ( hash << 27 ) | ( hash >> 37 );
+        return hash * 0xFF51AFD7ED558CCDULL;
+    }
+
+    inline uint64_t hashFinalize( uint64_t hash )
+    {
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53ULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    // case sensitive version of hashNoCase
+    inline uint64_t hashBytes( const char * data, size_t len )
+    {
+        uint64_t hash = 0xCBF29CE484222325ULL ^ len;
+        size_t ii = 0;
+        for ( ; ( ii + 8 ) <= len; ii += 8 )
+            hash = hashMix( hash, loadWord( data + ii ) );
+        if ( ii < len )
+            hash = hashMix( hash, loadWord( data + ii, len - ii ) );
+        return hashFinalize( hash );
+    }
+
+    // case insensitive hash, the vector and scalar paths fold and mix the same 8 byte words
+    inline uint64_t hashNoCase( const char * data, size_t len )
+    {
+        uint64_t hash = 0xCBF29CE484222325ULL ^ len;
+        size_t ii = 0;
+#ifdef SAB_HAS_SSE2
+        for ( ; ( ii + 16 ) <= len; ii += 16 )
+        {
+            uint64_t words[ 2 ];
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( words ), foldAsciiLower( _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + ii ) ) ) );
+            hash = hashMix( hashMix( hash, words[ 0 ] ), words[ 1 ] );
+        }
+#endif
+        for ( ; ( ii + 8 ) <= len; ii += 8 )
+            hash = hashMix( hash, foldAsciiLower( loadWord( data + ii ) ) );
+        if ( ii < len )
+            hash = hashMix( hash, foldAsciiLower( loadWord( data + ii, len - ii ) ) );
+        return hashFinalize( hash );
+    }
+
+    // returns the index of the first position where the case folded bytes differ, len if none
+    inline size_t mismatchNoCase( const char * lhs, const char * rhs, size_t len )
+    {
+        size_t ii = 0;
+#ifdef SAB_HAS_SSE2
+        for ( ; ( ii + 16 ) <= len; ii += 16 )
+        {
+            auto lhsBlock = foldAsciiLower( _mm_loadu_si128( reinterpret_cast< const __m128i * >( lhs + ii ) ) );
+            auto rhsBlock = foldAsciiLower( _mm_loadu_si128( reinterpret_cast< const __m128i * >( rhs + ii ) ) );
+            auto mask = static_cast< uint32_t >( _mm_movemask_epi8( _mm_cmpeq_epi8( lhsBlock, rhsBlock ) ) );
+            if ( mask != 0xFFFF )
+                return ii + countTrailingZeros( ~mask );
+        }
+#endif
+        for ( ; ( ii + 8 ) <= len; ii += 8 )
+        {
+            if ( foldAsciiLower( loadWord( lhs + ii ) ) != foldAsciiLower( loadWord( rhs + ii ) ) )
+                break;
+        }
+        for ( ; ii < len; ++ii )
+        {
+            if ( foldAsciiLower( lhs[ ii ] ) != foldAsciiLower( rhs[ ii ] ) )
+                return ii;
+        }
+        return len;
+    }
+
+    inline bool equalsNoCase( const char * lhs, size_t lhsLen, const char * rhs, size_t rhsLen )
+    {
+        return ( lhsLen == rhsLen ) && ( mismatchNoCase( lhs, rhs, lhsLen ) == lhsLen );
+    }
+
+    // strcasecmp ordering, without the locale
+    inline int compareNoCase( const char * lhs, size_t lhsLen, const char * rhs, size_t rhsLen )
+    {
+        auto len = ( lhsLen < rhsLen ) ? lhsLen : rhsLen;
+        auto pos = mismatchNoCase( lhs, rhs, len );
+        if ( pos != len )
+            return static_cast< unsigned char >( foldAsciiLower( lhs[ pos ] ) ) - static_cast< unsigned char >( foldAsciiLower( rhs[ pos ] ) );
+        return ( lhsLen < rhsLen ) ? -1 : ( ( lhsLen > rhsLen ) ? 1 : 0 );
+    }
+
+    // ASCII case insensitive substring search, returns std::string::npos when not found
+    // SSE2 filters 16 candidate positions at a time on the first and last needle bytes,
+    // without SSE2 long haystacks use Boyer-Moore-Horspool on the folded bytes
+    inline size_t findNoCase( const char * hay, size_t hayLen, const char * needle, size_t needleLen )
+    {
+        if ( needleLen == 0 )
+            return 0;
+        if ( needleLen > hayLen )
+            return std::string::npos;
+
+        auto first = foldAsciiLower( needle[ 0 ] );
+        auto last = foldAsciiLower( needle[ needleLen - 1 ] );
+        auto middleLen = ( needleLen > 2 ) ? ( needleLen - 2 ) : 0;
+        auto lastStart = hayLen - needleLen;
+        size_t ii = 0;
+#ifdef SAB_HAS_SSE2
+        auto firstBlock = _mm_set1_epi8( first );
+        auto lastBlock = _mm_set1_epi8( last );
+        for ( ; ( ii + 16 ) <= ( lastStart + 1 ); ii += 16 )
+        {
+            auto atFirst = foldAsciiLower( _mm_loadu_si128( reinterpret_cast< const __m128i * >( hay + ii ) ) );
+            auto atLast = foldAsciiLower( _mm_loadu_si128( reinterpret_cast< const __m128i * >( hay + ii + needleLen - 1 ) ) );
+            auto mask = static_cast< uint32_t >( _mm_movemask_epi8( _mm_and_si128( _mm_cmpeq_epi8( atFirst, firstBlock ), _mm_cmpeq_epi8( atLast, lastBlock ) ) ) );
+            while ( mask )
+            {
+                auto pos = ii + countTrailingZeros( mask );
+                if ( mismatchNoCase( hay + pos + 1, needle + 1, middleLen ) == middleLen )
+                    return pos;
+                mask &= mask - 1;
+            }
+        }
+#else
+        if ( ( needleLen >= 4 ) && ( hayLen >= 64 ) )
+        {
+            size_t shift[ 256 ];
+            for ( auto && jj : shift )
+                jj = needleLen;
+            for ( size_t jj = 0; ( jj + 1 ) < needleLen; ++jj )
+                shift[ static_cast< unsigned char >( foldAsciiLower( needle[ jj ] ) ) ] = needleLen - 1 - jj;
+
+            while ( ii <= lastStart )
+            {
+                auto ch = foldAsciiLower( hay[ ii + needleLen - 1 ] );
+                if ( ( ch == last ) && ( mismatchNoCase( hay + ii, needle, needleLen - 1 ) == ( needleLen - 1 ) ) )
+                    return ii;
+                ii += shift[ static_cast< unsigned char >( ch ) ];
+            }
+            return std::string::npos;
+        }
+#endif
+        for ( ; ii <= lastStart; ++ii )
+        {
+            if ( ( foldAsciiLower( hay[ ii ] ) == first ) && ( foldAsciiLower( hay[ ii + needleLen - 1 ] ) == last )
+                 && ( mismatchNoCase( hay + ii + 1, needle + 1, middleLen ) == middleLen ) )
+                return ii;
+        }
+        return std::string::npos;
+    }
+
+#ifdef SAB_HAS_SSE2
+    // reverses the bytes inside every laneBytes (1, 2, 4 or 8) wide lane, little endian values into digit order
+    inline __m128i byteSwapLanes( __m128i block, size_t laneBytes )
+    {
+        if ( laneBytes == 1 )
+            return block;
+        block = _mm_or_si128( _mm_slli_epi16( block, 8 ), _mm_srli_epi16( block, 8 ) );
+        if ( laneBytes == 2 )
+            return block;
+        if ( laneBytes == 4 )
+            return _mm_shufflehi_epi16( _mm_shufflelo_epi16( block, _MM_SHUFFLE( 2, 3, 0, 1 ) ), _MM_SHUFFLE( 2, 3, 0, 1 ) );
+        return _mm_shufflehi_epi16( _mm_shufflelo_epi16( block, _MM_SHUFFLE( 0, 1, 2, 3 ) ), _MM_SHUFFLE( 0, 1, 2, 3 ) );
+    }
+
+    // 0-15 in every byte to '0'-'9' 'A'-'F' (or 'a'-'f')
+    inline __m128i nibblesToHex( __m128i nibbles, bool upperCase )
+    {
+        auto isLetter = _mm_cmpgt_epi8( nibbles, _mm_set1_epi8( 9 ) );
+        auto chars = _mm_add_epi8( nibbles, _mm_set1_epi8( '0' ) );
+        return _mm_add_epi8( chars, _mm_and_si128( isLetter, _mm_set1_epi8( upperCase ? ( 'A' - '0' - 10 ) : ( 'a' - '0' - 10 ) ) ) );
+    }
+
+    // the 32 hex digits of the 16 bytes, first byte first, high nibble first
+    inline void writeHexDigits( __m128i block, char * out, bool upperCase )
+    {
+        auto mask = _mm_set1_epi8( 0x0F );
+        auto high = _mm_and_si128( _mm_srli_epi16( block, 4 ), mask );
+        auto low = _mm_and_si128( block, mask );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( out ), nibblesToHex( _mm_unpacklo_epi8( high, low ), upperCase ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( out + 16 ), nibblesToHex( _mm_unpackhi_epi8( high, low ), upperCase ) );
+    }
+
+    // the 128 '0'/'1' characters of the 16 bytes, first byte first, high bit first
+    inline void writeBinDigits( __m128i block, char * out )
+    {
+        // every byte spread over 8 lanes, each lane tests one of its bits
+        auto bits = _mm_setr_epi8( -128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4, 2, 1 );
+        auto zeros = _mm_set1_epi8( '0' );
+        __m128i bytes2[ 2 ] = { _mm_unpacklo_epi8( block, block ), _mm_unpackhi_epi8( block, block ) };
+        for ( int ii = 0; ii < 2; ++ii )
+        {
+            __m128i bytes4[ 2 ] = { _mm_unpacklo_epi16( bytes2[ ii ], bytes2[ ii ] ), _mm_unpackhi_epi16( bytes2[ ii ], bytes2[ ii ] ) };
+            for ( int jj = 0; jj < 2; ++jj )
+            {
+                __m128i bytes8[ 2 ] = { _mm_unpacklo_epi32( bytes4[ jj ], bytes4[ jj ] ), _mm_unpackhi_epi32( bytes4[ jj ], bytes4[ jj ] ) };
+                for ( int kk = 0; kk < 2; ++kk )
+                {
+                    auto isSet = _mm_cmpeq_epi8( _mm_and_si128( bytes8[ kk ], bits ), bits );
+                    _mm_storeu_si128( reinterpret_cast< __m128i * >( out ), _mm_sub_epi8( zeros, isSet ) );
+                    out += 16;
+                }
+            }
+        }
+    }
+#endif
+}
+
+#endif
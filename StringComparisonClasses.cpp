@@ -22,29 +22,64 @@
 
 #include "StringComparisonClasses.h"
 #include "StringUtils.h"
-#include <QHash>
+#include "SIMDUtils.h"
 
 namespace NStringUtils
 {
+    // folds case while hashing, no copy of the string is made
     size_t noCaseStringHash::operator()( const std::string& s ) const
     {
-        std::hash<std::string> hash_fn;
-        return hash_fn( tolower( s ) );
+        return static_cast< size_t >( NSIMDUtils::hashNoCase( s.data(), s.length() ) );
     }
 
     bool noCaseStringCmp::operator() ( const std::string& s1, const std::string& s2 ) const
     {
-        return strCaseCmp( s1, s2 ) < 0;
+        return NSIMDUtils::compareNoCase( s1.data(), s1.length(), s2.data(), s2.length() ) < 0;
     }
 
     bool noCaseStringEq::operator() ( const std::string& s1, const std::string& s2 ) const
     {
-        return strCaseCmp( s1, s2 ) == 0;
+        return NSIMDUtils::equalsNoCase( s1.data(), s1.length(), s2.data(), s2.length() );
     }
 
+    // must agree with noCaseQStringEq, so characters are folded with the same
+    // QChar::toCaseFolded that QString::compare( Qt::CaseInsensitive ) uses
     size_t noCaseQStringHash::operator()( const QString & s ) const
     {
-        return static_cast<size_t>( qHash( s ) );
+        uint64_t hash = 0xCBF29CE484222325ULL ^ static_cast< uint64_t >( s.length() );
+        uint64_t word = 0;
+        int numInWord = 0;
+        auto addChar = [ &hash, &word, &numInWord ]( ushort ch )
+        {
+            word = ( word << 16 ) | ch;
+            if ( ++numInWord == 4 )
+            {
+                hash = NSIMDUtils::hashMix( hash, word );
+                word = 0;
+                numInWord = 0;
+            }
+        };
+
+        auto data = s.constData();
+        auto len = s.length();
+        for ( int ii = 0; ii < len; ++ii )
+        {
+            auto ch = data[ ii ].unicode();
+            if ( ch < 0x80 )
+                addChar( static_cast< ushort >( NSIMDUtils::foldAsciiLower( static_cast< char >( ch ) ) ) );
+            else if ( QChar::isHighSurrogate( static_cast< uint >( ch ) ) && ( ( ii + 1 ) < len ) && data[ ii + 1 ].isLowSurrogate() )
+            {
+                auto folded = QChar::toCaseFolded( QChar::surrogateToUcs4( ch, data[ ii + 1 ].unicode() ) );
+                addChar( QChar::highSurrogate( folded ) );
+                addChar( QChar::lowSurrogate( folded ) );
+                ++ii;
+            }
+            else
+                addChar( static_cast< ushort >( QChar::toCaseFolded( static_cast< uint >( ch ) ) ) );
+        }
+        if ( numInWord )
+            hash = NSIMDUtils::hashMix( hash, word );
+        return static_cast< size_t >( NSIMDUtils::hashFinalize( hash ) );
     }
 
     bool noCaseQStringCmp::operator() ( const QString & s1, const QString & s2 ) const
@@ -0,0 +1,252 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "StringFormat.h"
+
+#include <QString>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+
+namespace NStringUtils
+{
+    namespace NFormat
+    {
+        namespace
+        {
+            struct SSpec
+            {
+                char fAlign{ 0 };
+                bool fZeroPad{ false };
+                size_t fWidth{ 0 };
+                int fPrecision{ -1 };
+                char fType{ 0 };
+            };
+
+            // spec has already been validated by countArgs, width and precision are in range
+            SSpec parseSpec( std::string_view spec )
+            {
+                SSpec retVal;
+                if ( spec.empty() )
+                    return retVal;
+
+                size_t pos = 1;
+                if ( ( pos < spec.length() ) && ( ( spec[ pos ] == '<' ) || ( spec[ pos ] == '>' ) || ( spec[ pos ] == '^' ) ) )
+                    retVal.fAlign = spec[ pos++ ];
+                if ( ( pos < spec.length() ) && ( spec[ pos ] == '0' ) )
+                {
+                    retVal.fZeroPad = true;
+                    ++pos;
+                }
+                for ( ; ( pos < spec.length() ) && ( spec[ pos ] >= '0' ) && ( spec[ pos ] <= '9' ); ++pos )
+                    retVal.fWidth = ( retVal.fWidth * 10 ) + ( spec[ pos ] - '0' );
+                if ( ( pos < spec.length() ) && ( spec[ pos ] == '.' ) )
+                {
+                    retVal.fPrecision = 0;
+                    for ( ++pos; ( pos < spec.length() ) && ( spec[ pos ] >= '0' ) && ( spec[ pos ] <= '9' ); ++pos )
+                        retVal.fPrecision = ( retVal.fPrecision * 10 ) + ( spec[ pos ] - '0' );
+                }
+                if ( pos < spec.length() )
+                    retVal.fType = spec[ pos ];
+                return retVal;
+            }
+
+            int baseForType( char type )
+            {
+                switch ( type )
+                {
+                    case 'x':
+                    case 'X':
+                    case 'p':
+                        return 16;
+                    case 'b':
+                        return 2;
+                    case 'o':
+                        return 8;
+                    default:
+                        return 10;
+                }
+            }
+
+            // digits of value into buff, returns the length
+            size_t formatUInt( char * buff, size_t buffLen, uint64_t value, char type )
+            {
+                auto result = std::to_chars( buff, buff + buffLen, value, baseForType( type ) );
+                if ( type == 'X' )
+                {
+                    for ( auto ii = buff; ii != result.ptr; ++ii )
+                    {
+                        if ( ( *ii >= 'a' ) && ( *ii <= 'f' ) )
+                            *ii = static_cast< char >( *ii - 'a' + 'A' );
+                    }
+                }
+                return static_cast< size_t >( result.ptr - buff );
+            }
+
+            // the text of value, in buff when it fits otherwise in heapBuff
+            std::string_view formatDouble( char * buff, size_t buffLen, std::string & heapBuff, double value, const SSpec & spec )
+            {
+                char fmt[ 8 ] = "%.*g";
+                if ( ( spec.fType == 'f' ) || ( spec.fType == 'e' ) )
+                    fmt[ 3 ] = spec.fType;
+                auto precision = ( spec.fPrecision < 0 ) ? 6 : spec.fPrecision;
+                auto len = std::snprintf( buff, buffLen, fmt, precision, value );
+                if ( len < 0 )
+                    return std::string_view();
+                if ( static_cast< size_t >( len ) < buffLen )
+                    return std::string_view( buff, len );
+
+                // a large value with f or a high precision, sized from the first attempt
+                heapBuff.resize( len + 1 );
+                std::snprintf( &heapBuff[ 0 ], heapBuff.size(), fmt, precision, value );
+                return std::string_view( heapBuff.data(), len );
+            }
+
+            // appends text padded to the spec width, numbers align right by default
+            void appendPadded( std::string & out, const SSpec & spec, std::string_view text, bool isNumber )
+            {
+                if ( text.length() >= spec.fWidth )
+                {
+                    out.append( text.data(), text.length() );
+                    return;
+                }
+
+                auto padding = spec.fWidth - text.length();
+                if ( spec.fZeroPad && isNumber && !spec.fAlign )
+                {
+                    // zeros go after the sign
+                    if ( !text.empty() && ( ( text[ 0 ] == '-' ) || ( text[ 0 ] == '+' ) ) )
+                    {
+                        out.push_back( text[ 0 ] );
+                        text.remove_prefix( 1 );
+                    }
+                    out.append( padding, '0' );
+                    out.append( text.data(), text.length() );
+                    return;
+                }
+
+                auto align = spec.fAlign ? spec.fAlign : ( isNumber ? '>' : '<' );
+                size_t before = ( align == '>' ) ? padding : ( ( align == '^' ) ? ( padding / 2 ) : 0 );
+                out.append( before, ' ' );
+                out.append( text.data(), text.length() );
+                out.append( padding - before, ' ' );
+            }
+
+            void appendArg( std::string & out, const SArg & arg, std::string_view specText )
+            {
+                auto spec = parseSpec( specText );
+                char buff[ 512 ];
+                switch ( arg.fType )
+                {
+                    case SArg::EType::eBool:
+                        appendPadded( out, spec, arg.fUInt ? "true" : "false", false );
+                        break;
+                    case SArg::EType::eChar:
+                        if ( ( spec.fType == 0 ) || ( spec.fType == 'c' ) || ( spec.fType == 's' ) )
+                        {
+                            buff[ 0 ] = static_cast< char >( arg.fInt );
+                            appendPadded( out, spec, std::string_view( buff, 1 ), false );
+                            break;
+                        }
+                        [[fallthrough]];
+                    case SArg::EType::eInt:
+                    {
+                        auto value = arg.fInt;
+                        bool negative = ( value < 0 );
+                        auto magnitude = negative ? ( 0 - static_cast< uint64_t >( value ) ) : static_cast< uint64_t >( value );
+                        buff[ 0 ] = '-';
+                        auto len = formatUInt( buff + 1, sizeof( buff ) - 1, magnitude, spec.fType );
+                        appendPadded( out, spec, std::string_view( negative ? buff : ( buff + 1 ), len + ( negative ? 1 : 0 ) ), true );
+                        break;
+                    }
+                    case SArg::EType::eUInt:
+                        appendPadded( out, spec, std::string_view( buff, formatUInt( buff, sizeof( buff ), arg.fUInt, spec.fType ) ), true );
+                        break;
+                    case SArg::EType::eDouble:
+                    {
+                        std::string heapBuff;
+                        appendPadded( out, spec, formatDouble( buff, sizeof( buff ), heapBuff, arg.fDouble, spec ), true );
+                        break;
+                    }
+                    case SArg::EType::eString:
+                    {
+                        auto text = arg.fString;
+                        if ( ( spec.fPrecision >= 0 ) && ( static_cast< size_t >( spec.fPrecision ) < text.length() ) )
+                            text = text.substr( 0, spec.fPrecision );
+                        appendPadded( out, spec, text, false );
+                        break;
+                    }
+                    case SArg::EType::eQString:
+                    {
+                        auto utf8 = static_cast< const QString * >( arg.fPointer )->toUtf8();
+                        auto text = std::string_view( utf8.constData(), utf8.length() );
+                        if ( ( spec.fPrecision >= 0 ) && ( static_cast< size_t >( spec.fPrecision ) < text.length() ) )
+                            text = text.substr( 0, spec.fPrecision );
+                        appendPadded( out, spec, text, false );
+                        break;
+                    }
+                    case SArg::EType::ePointer:
+                    {
+                        buff[ 0 ] = '0';
+                        buff[ 1 ] = 'x';
+                        auto len = formatUInt( buff + 2, sizeof( buff ) - 2, reinterpret_cast< uintptr_t >( arg.fPointer ), 'x' );
+                        appendPadded( out, spec, std::string_view( buff, len + 2 ), true );
+                        break;
+                    }
+                }
+            }
+        }
+
+        bool vformatTo( std::string & out, std::string_view fmt, std::initializer_list< SArg > args )
+        {
+            if ( countArgs( fmt ) != static_cast< int >( args.size() ) )
+                return false;
+
+            out.reserve( out.length() + fmt.length() + ( args.size() * 8 ) );
+
+            auto currArg = args.begin();
+            size_t prev = 0;
+            for ( size_t ii = 0; ii < fmt.length(); ++ii )
+            {
+                auto ch = fmt[ ii ];
+                if ( ( ch != '{' ) && ( ch != '}' ) )
+                    continue;
+
+                out.append( fmt.data() + prev, ii - prev );
+                if ( ( ( ii + 1 ) < fmt.length() ) && ( fmt[ ii + 1 ] == ch ) )
+                {
+                    out.push_back( ch );
+                    prev = ++ii + 1;
+                    continue;
+                }
+
+                auto end = fmt.find( '}', ii );
+                appendArg( out, *currArg++, fmt.substr( ii + 1, end - ii - 1 ) );
+                prev = end + 1;
+                ii = end;
+            }
+            out.append( fmt.data() + prev, fmt.length() - prev );
+            return true;
+        }
+    }
+}
@@ -0,0 +1,189 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __STRINGFORMAT_H
+#define __STRINGFORMAT_H
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+class QString;
+
+// Type safe replacement for getFMTString
+// Placeholders are {} or {:spec}, {{ and }} are literal braces.  spec is [<>^][0][width][.precision][type]
+// where type is one of d x X b o (integers), f e g (floating point), s c or p, a type that does not
+// apply to the argument is ignored.  width and precision are at most NFormat::kMaxSpecValue.  Arguments are formatted by their C++ type, so there is no
+// printf style mismatch to get wrong.
+//
+// Wrap the format in SAB_FORMAT( "..." ) to have the placeholders checked against the arguments at
+// compile time, a plain string is checked at run time.
+//     NStringUtils::formatTo( buffer, SAB_FORMAT( "{}: {} errors ({:.1f}%)" ), fileName, numErrors, percent );
+#define SAB_FORMAT( fmt ) \
+    []() { struct SFormat : NStringUtils::NFormat::SCompileTimeFormat { static constexpr std::string_view value() { return fmt; } }; return SFormat(); }()
+
+namespace NStringUtils
+{
+    namespace NFormat
+    {
+        struct SCompileTimeFormat
+        {
+        };
+
+        // a larger width or precision makes the format malformed
+        constexpr int kMaxSpecValue = 65535;
+
+        // number of placeholders in fmt, -1 when fmt is malformed
+        constexpr int countArgs( std::string_view fmt )
+        {
+            int retVal = 0;
+            for ( size_t ii = 0; ii < fmt.length(); ++ii )
+            {
+                if ( fmt[ ii ] == '}' )
+                {
+                    if ( ( ( ii + 1 ) < fmt.length() ) && ( fmt[ ii + 1 ] == '}' ) )
+                    {
+                        ++ii;
+                        continue;
+                    }
+                    return -1;
+                }
+                if ( fmt[ ii ] != '{' )
+                    continue;
+                if ( ( ( ii + 1 ) < fmt.length() ) && ( fmt[ ii + 1 ] == '{' ) )
+                {
+                    ++ii;
+                    continue;
+                }
+
+                auto end = fmt.find( '}', ii );
+                if ( end == std::string_view::npos )
+                    return -1;
+                auto spec = fmt.substr( ii + 1, end - ii - 1 );
+                if ( !spec.empty() )
+                {
+                    if ( spec[ 0 ] != ':' )
+                        return -1;
+                    size_t pos = 1;
+                    if ( ( pos < spec.length() ) && ( ( spec[ pos ] == '<' ) || ( spec[ pos ] == '>' ) || ( spec[ pos ] == '^' ) ) )
+                        ++pos;
+                    for ( int width = 0; ( pos < spec.length() ) && ( spec[ pos ] >= '0' ) && ( spec[ pos ] <= '9' ); ++pos )
+                    {
+                        width = ( width * 10 ) + ( spec[ pos ] - '0' );
+                        if ( width > kMaxSpecValue )
+                            return -1;
+                    }
+                    if ( ( pos < spec.length() ) && ( spec[ pos ] == '.' ) )
+                    {
+                        ++pos;
+                        for ( int precision = 0; ( pos < spec.length() ) && ( spec[ pos ] >= '0' ) && ( spec[ pos ] <= '9' ); ++pos )
+                        {
+                            precision = ( precision * 10 ) + ( spec[ pos ] - '0' );
+                            if ( precision > kMaxSpecValue )
+                                return -1;
+                        }
+                    }
+                    if ( ( pos < spec.length() ) && std::string_view( "dxXbofegscp" ).find( spec[ pos ] ) != std::string_view::npos )
+                        ++pos;
+                    if ( pos != spec.length() )
+                        return -1;
+                }
+                ++retVal;
+                ii = end;
+            }
+            return retVal;
+        }
+
+        // type erased argument, keeps the formatting code out of the templates
+        struct SArg
+        {
+            enum class EType
+            {
+                eBool,
+                eChar,
+                eInt,
+                eUInt,
+                eDouble,
+                eString,
+                eQString,
+                ePointer
+            };
+
+            SArg( bool value ) : fType( EType::eBool ), fUInt( value ? 1 : 0 ) {}
+            SArg( char value ) : fType( EType::eChar ), fInt( value ) {}
+            template< typename T, typename std::enable_if< std::is_integral< T >::value && std::is_signed< T >::value, int >::type = 0 >
+            SArg( T value ) : fType( EType::eInt ), fInt( value ) {}
+            template< typename T, typename std::enable_if< std::is_integral< T >::value && !std::is_signed< T >::value, int >::type = 0 >
+            SArg( T value ) : fType( EType::eUInt ), fUInt( value ) {}
+            template< typename T, typename std::enable_if< std::is_enum< T >::value, int >::type = 0 >
+            SArg( T value ) : SArg( static_cast< typename std::underlying_type< T >::type >( value ) ) {}
+            SArg( double value ) : fType( EType::eDouble ), fDouble( value ) {}
+            SArg( const char * value ) : fType( EType::eString ), fString( value ? value : "(null)" ) {}
+            SArg( char * value ) : SArg( static_cast< const char * >( value ) ) {}
+            SArg( std::string_view value ) : fType( EType::eString ), fString( value ) {}
+            SArg( const std::string & value ) : fType( EType::eString ), fString( value ) {}
+            SArg( const QString & value ) : fType( EType::eQString ), fPointer( &value ) {}
+            SArg( const void * value ) : fType( EType::ePointer ), fPointer( value ) {}
+
+            EType fType;
+            union
+            {
+                int64_t fInt;
+                uint64_t fUInt;
+                double fDouble;
+                std::string_view fString;
+                const void * fPointer;
+            };
+        };
+
+        // appends to out, returns false and leaves out untouched when the placeholders do not match args
+        bool vformatTo( std::string & out, std::string_view fmt, std::initializer_list< SArg > args );
+    }
+
+    // run time checked, returns false when fmt does not match the arguments
+    template< typename... TArgs >
+    bool formatTo( std::string & out, std::string_view fmt, const TArgs &... args )
+    {
+        return NFormat::vformatTo( out, fmt, { NFormat::SArg( args )... } );
+    }
+
+    // compile time checked, see SAB_FORMAT
+    template< typename TFormat, typename... TArgs >
+    typename std::enable_if< std::is_base_of< NFormat::SCompileTimeFormat, TFormat >::value >::type formatTo( std::string & out, TFormat, const TArgs &... args )
+    {
+        static_assert( NFormat::countArgs( TFormat::value() ) >= 0, "Malformed format string" );
+        static_assert( NFormat::countArgs( TFormat::value() ) == sizeof...( TArgs ), "The format string does not match the number of arguments" );
+        NFormat::vformatTo( out, TFormat::value(), { NFormat::SArg( args )... } );
+    }
+
+    template< typename TFormat, typename... TArgs >
+    std::string formatString( TFormat fmt, const TArgs &... args )
+    {
+        std::string retVal;
+        formatTo( retVal, fmt, args... );
+        return retVal;
+    }
+}
+
+#endif
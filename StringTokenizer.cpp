@@ -0,0 +1,162 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "StringTokenizer.h"
+
+namespace NStringUtils
+{
+    std::string_view stripQuotesView( std::string_view retVal, const char * quotes )
+    {
+        static const std::string_view whitespaces( " \t\f\v\n\r" );
+        auto startIdx = retVal.find_first_not_of( whitespaces );
+        if ( startIdx == std::string_view::npos )
+            return std::string_view();
+        auto endIdx = retVal.find_last_not_of( whitespaces );
+        retVal = retVal.substr( startIdx, endIdx - startIdx + 1 );
+
+        for ( auto currQuote = quotes; *currQuote; ++currQuote )
+        {
+            if ( ( retVal.length() >= 2 ) && ( retVal.front() == *currQuote ) && ( retVal.back() == *currQuote ) )
+                retVal = retVal.substr( 1, retVal.length() - 2 );
+        }
+        return retVal;
+    }
+
+    CStringTokenizer::CStringTokenizer( std::string_view string, char delim, bool skipEmpty, bool keepQuoted, bool stripQuotes ) :
+        fString( string ),
+        fSkipEmpty( skipEmpty ),
+        fKeepQuoted( keepQuoted ),
+        fStripQuotes( stripQuotes )
+    {
+        init( std::string_view( &delim, 1 ) );
+    }
+
+    CStringTokenizer::CStringTokenizer( std::string_view string, std::string_view oneOfDelim, bool skipEmpty, bool keepQuoted, bool stripQuotes ) :
+        fString( string ),
+        fSkipEmpty( skipEmpty ),
+        fKeepQuoted( keepQuoted ),
+        fStripQuotes( stripQuotes )
+    {
+        init( oneOfDelim );
+    }
+
+    void CStringTokenizer::init( std::string_view oneOfDelim )
+    {
+        fOrigDelims.add( oneOfDelim.data(), oneOfDelim.length() );
+        fDelims.add( oneOfDelim.data(), oneOfDelim.length() );
+        fQuotes.add( "\"\'", 2 );
+        if ( fKeepQuoted )
+            fDelims.add( "\"\'", 2 );
+
+        fDone = fString.empty();
+        fPrevPos = 0;
+        fPos = findDelim( 0 );
+    }
+
+    size_t CStringTokenizer::findDelim( size_t from ) const
+    {
+        return NSIMDUtils::findFirstOf( fString.data(), fString.length(), from, fDelims );
+    }
+
+    bool CStringTokenizer::next( std::string_view & token )
+    {
+        size_t quotedStart;
+        if ( !nextRaw( token, &quotedStart ) )
+            return false;
+        if ( fStripQuotes && ( ( quotedStart == 0 ) || ( quotedStart == std::string::npos ) ) )
+            token = stripQuotesView( token );
+        return true;
+    }
+
+    // mirrors the original std::list based splitString loop, one token per call
+    bool CStringTokenizer::nextRaw( std::string_view & token, size_t * quotedStart )
+    {
+        if ( quotedStart )
+            *quotedStart = std::string::npos;
+        while ( !fDone )
+        {
+            if ( fPos == std::string::npos )
+            {
+                fDone = true;
+                if ( ( fPrevPos < fString.length() ) || ( ( fPrevPos == fString.length() ) && fOrigDelims.contains( fString.back() ) ) )
+                {
+                    token = fString.substr( fPrevPos );
+                    if ( !fSkipEmpty || !token.empty() )
+                        return true;
+                }
+                return false;
+            }
+
+            if ( fKeepQuoted && fQuotes.contains( fString[ fPos ] ) )
+            {
+                auto prefixStart = fPrevPos;
+                bool hasPrefix = ( fPos != fPrevPos );
+
+                fPrevPos = fPos;
+                fPos = NSIMDUtils::findFirstOf( fString.data(), fString.length(), fPrevPos + 1, fQuotes );
+                if ( fPos == std::string::npos )
+                {
+                    if ( !hasPrefix ) // it started with a quote
+                        token = fString.substr( fStripQuotes ? ( fPrevPos + 1 ) : fPrevPos );
+                    else
+                    {
+                        // quote was embedded....
+                        fPos = findDelim( fPrevPos + 1 );
+                        if ( fPos != std::string::npos )
+                        {
+                            token = fString.substr( prefixStart, fPos - prefixStart );
+                            fPrevPos = fPos + 1;
+                            fPos = findDelim( fPrevPos );
+                            return true;
+                        }
+                        token = fString.substr( prefixStart );
+                    }
+                    fDone = true;
+                    return true;
+                }
+
+                token = fString.substr( prefixStart, fPos - prefixStart + 1 );
+                if ( quotedStart )
+                    *quotedStart = fPrevPos - prefixStart;
+                fPrevPos = fPos + 2;
+                fPos = findDelim( fPrevPos );
+                return true;
+            }
+
+            token = fString.substr( fPrevPos, fPos - fPrevPos );
+            fPrevPos = fPos + 1;
+            fPos = findDelim( fPrevPos );
+            if ( !fSkipEmpty || !token.empty() )
+                return true;
+        }
+        return false;
+    }
+
+    std::vector< std::string_view > CStringTokenizer::all()
+    {
+        std::vector< std::string_view > retVal;
+        std::string_view curr;
+        while ( next( curr ) )
+            retVal.push_back( curr );
+        return retVal;
+    }
+}
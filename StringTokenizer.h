@@ -0,0 +1,103 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __STRINGTOKENIZER_H
+#define __STRINGTOKENIZER_H
+
+#include "SIMDUtils.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <iterator>
+
+namespace NStringUtils
+{
+    // Strips leading/trailing blanks, then a matching pair of quotes, without copying
+    // The "foo"\ form handled by stripQuotes( std::string ) is not contiguous, and is returned blank stripped only
+    std::string_view stripQuotesView( std::string_view text, const char * quotes = "\"\'" );
+
+    // Lazy tokenizer returning views into the source buffer
+    // Same skipEmpty/keepQuoted/stripQuotes semantics as splitString, the source must outlive the tokenizer
+    class CStringTokenizer
+    {
+    public:
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::string_view *;
+            using reference = const std::string_view &;
+
+            const_iterator() = default;
+            explicit const_iterator( CStringTokenizer * tokenizer ) : fTokenizer( tokenizer ) { advance(); }
+
+            reference operator*() const { return fCurr; }
+            pointer operator->() const { return &fCurr; }
+            const_iterator & operator++() { advance(); return *this; }
+            bool operator==( const const_iterator & rhs ) const { return fTokenizer == rhs.fTokenizer; }
+            bool operator!=( const const_iterator & rhs ) const { return fTokenizer != rhs.fTokenizer; }
+        private:
+            void advance()
+            {
+                if ( fTokenizer && !fTokenizer->next( fCurr ) )
+                    fTokenizer = nullptr;
+            }
+            CStringTokenizer * fTokenizer{ nullptr };
+            std::string_view fCurr;
+        };
+
+        CStringTokenizer( std::string_view string, char delim, bool skipEmpty = false, bool keepQuoted = false, bool stripQuotes = false );
+        CStringTokenizer( std::string_view string, std::string_view oneOfDelim, bool skipEmpty = false, bool keepQuoted = false, bool stripQuotes = false );
+
+        // quotes stripped when requested, a quoted section with an unquoted prefix (foo"bar") is returned as is
+        bool next( std::string_view & token );
+
+        // never strips quotes, used by the std::string wrappers to keep their exact stripQuotes behavior
+        // quotedStart is set to the offset of a closed quoted section within token, npos otherwise
+        bool nextRaw( std::string_view & token, size_t * quotedStart = nullptr );
+
+        std::vector< std::string_view > all();
+
+        const_iterator begin() { return const_iterator( this ); }
+        const_iterator end() { return const_iterator(); }
+    private:
+        void init( std::string_view oneOfDelim );
+        size_t findDelim( size_t from ) const;
+
+        std::string_view fString;
+        NSIMDUtils::CByteSet fDelims; // includes the quotes when keepQuoted
+        NSIMDUtils::CByteSet fOrigDelims;
+        NSIMDUtils::CByteSet fQuotes;
+        bool fSkipEmpty{ false };
+        bool fKeepQuoted{ false };
+        bool fStripQuotes{ false };
+
+        bool fDone{ false };
+        size_t fPrevPos{ 0 };
+        size_t fPos{ std::string::npos };
+    };
+}
+
+#endif
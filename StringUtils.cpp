@@ -21,12 +21,23 @@
 // SOFTWARE.
 
 #include "StringUtils.h"
+#include "StringTokenizer.h"
+#include "RegExCache.h"
+#include "ByteRegEx.h"
+#include "RegExSet.h"
+#include "BitVector.h"
+#include "MultiStringSearch.h"
+#include "MultiStringReplace.h"
+#include "EnvironmentSnapshot.h"
+#include "ReportWriter.h"
+#include "TransferCodecs.h"
+#include "SIMDUtils.h"
 #include "FromString.h"
+#include "NoCaseStringSet.h"
 
 #include <QString>
-#include <QRegExp>
 #include <QRegularExpression>
-#include <QTextStream>
+#include <QXmlStreamWriter>
 #include <algorithm>
 #include <vector>
 #include <cstring>
@@ -108,21 +119,9 @@ namespace NStringUtils
 
     std::string addToRegEx( std::string oldRegEx, const std::string & regEx )
     {
-        auto subExps = splitString( oldRegEx, "|" );
-        auto newSubExps = splitString( regEx, "|" );
-        subExps.insert( subExps.end(), newSubExps.cbegin(), newSubExps.cend() );
-        if ( subExps.size() > 1 )
-        {
-            for ( auto & ii : subExps )
-            {
-                if ( *ii.begin() != '(' && *ii.rbegin() != ')' )
-                    ii = "(" + ii + ")";
-            }
-        }
-
-        auto uniqueSub = std::set< std::string >( subExps.begin(), subExps.end() );
-        oldRegEx = joinString( uniqueSub, "|" );
-        return oldRegEx;
+        CRegExSet regExSet( oldRegEx );
+        regExSet.addPattern( regEx );
+        return regExSet.alternation();
     }
 
     void replaceAll( char * str, char from, char to )
@@ -204,6 +203,22 @@ namespace NStringUtils
         return str;
     }
 
+    std::string replaceAll( std::string& str, const CMultiStringReplace & replacements )
+    {
+        replacements.replaceInPlace( str );
+        return str;
+    }
+
+    std::string replaceAll( const std::string& str, const CMultiStringReplace & replacements )
+    {
+        return replacements.replace( str );
+    }
+
+    std::string replaceAll( const std::string& str, const std::vector< std::pair< std::string, std::string > > & replacements )
+    {
+        return CMultiStringReplace( replacements ).replace( str );
+    }
+
     std::string stripBlanksHead( const std::string & inStr )
     {
         static std::string whitespaces( " \t\f\v\n\r" );
@@ -447,14 +462,13 @@ namespace NStringUtils
         if ( idx == string::npos )
             return true;
 
-        std::string realSubs = subs.substr( idx );
+        std::string_view realSubs( subs );
+        realSubs.remove_prefix( idx );
 
-        size_t endi = realSubs.length() - 1;
+        if ( realSubs.back() == '*' )
+            realSubs.remove_suffix( 1 );
 
-        if ( realSubs[ endi ] == '*' )
-            realSubs = realSubs.substr( 0, endi );
-
-        idx = str.find( realSubs );
+        idx = std::string_view( str ).find( realSubs );
         if ( idx == string::npos )
             return false;
 
@@ -475,11 +489,14 @@ namespace NStringUtils
         if ( str.empty() || prefix.empty() )
             return false;
 
-        QString pre = QString::fromStdString( prefix );
-        if ( *pre.end() != '*' )
+        if ( prefix.find_first_of( "*?[\\" ) == std::string::npos ) // no wildcards, skip the regex
+            return str.compare( 0, prefix.length(), prefix ) == 0;
+
+        std::string pre = prefix;
+        if ( *pre.rbegin() != '*' )
             pre += "*";
-        QRegExp regEx( pre, Qt::CaseSensitive, QRegExp::Wildcard );
-        return regEx.exactMatch( QString::fromStdString( str ) );
+        auto regEx = CRegExCache::instance()->getWildcard( pre );
+        return regEx.match( QString::fromStdString( str ) ).hasMatch();
     }
 
 
@@ -495,11 +512,14 @@ namespace NStringUtils
         if ( str.empty() || suffix.empty() )
             return false;
 
-        QString suf = QString::fromStdString( suffix );
+        if ( suffix.find_first_of( "*?[\\" ) == std::string::npos ) // no wildcards, skip the regex
+            return ( str.length() >= suffix.length() ) && ( str.compare( str.length() - suffix.length(), suffix.length(), suffix ) == 0 );
+
+        std::string suf = suffix;
         if ( *suf.begin() != '*' )
             suf.insert( 0, "*" );
-        QRegExp regEx( suf, Qt::CaseSensitive, QRegExp::Wildcard );
-        return regEx.exactMatch( QString::fromStdString( str ) );
+        auto regEx = CRegExCache::instance()->getWildcard( suf );
+        return regEx.match( QString::fromStdString( str ) ).hasMatch();
     }
 
     std::string replaceAllNot( const std::string & inString, const std::string & notOf, char to )
@@ -729,6 +749,7 @@ namespace NStringUtils
     std::string hexToBinXY( const std::string & in, bool * aOK )
     {
         std::string retVal;
+        retVal.reserve( in.size() * 4 );
         bool lclOK = true;
         for ( size_t ii = 0; ii < in.size(); ++ii )
         {
@@ -744,6 +765,7 @@ namespace NStringUtils
     std::string octToBinXY( const std::string & in, bool * aOK )
     {
         std::string retVal;
+        retVal.reserve( in.size() * 3 );
         bool lclOK = true;
         for ( size_t ii = 0; ii < in.size(); ++ii )
         {
@@ -808,18 +830,64 @@ namespace NStringUtils
 
     std::string decToBin( const std::string & in, size_t len, bool * aOK )
     {
+        if ( len > 64 )
+        {
+            // the bit vector is all zeros when the value does not parse, the <= 64 bit path returns ""
+            bool ok = false;
+            auto retVal = decToBitVector( in, len, &ok ).toBinString();
+            if ( aOK )
+                *aOK = ok;
+            return ok ? retVal : std::string();
+        }
+
         return toBin( std::dec, in, len, aOK );
     }
 
+    CBitVector hexToBitVector( const std::string & in, size_t len, bool * aOK )
+    {
+        return CBitVector::fromHexString( in, len, aOK );
+    }
+
+    CBitVector decToBitVector( const std::string & in, size_t len, bool * aOK )
+    {
+        return CBitVector::fromDecString( in, len, aOK );
+    }
+
+    CBitVector octToBitVector( const std::string & in, size_t len, bool * aOK )
+    {
+        return CBitVector::fromOctString( in, len, aOK );
+    }
+
+    CBitVector binToBitVector( const std::string & in, size_t len, bool * aOK )
+    {
+        return CBitVector::fromBinString( in, len, aOK );
+    }
+
+    std::string toBinString( const CBitVector & value )
+    {
+        return value.toBinString();
+    }
+
+    std::string binToHex( const CBitVector & value )
+    {
+        return value.toHexString();
+    }
+
+    std::string binToOct( const CBitVector & value )
+    {
+        return value.toOctString();
+    }
+
+    std::string binToDec( const CBitVector & value, bool isSigned )
+    {
+        return value.toDecString( isSigned );
+    }
+
     std::string AsciiToBin( const std::string &in )
     {
-        std::string result = "";
-        result.reserve( in.length() * 8 );
-        for ( size_t i = 0; i < in.length(); ++i )
-        {
-            result += toBinString( in[ i ], 8 );
-        }
-        return result;
+        SIntFormat format;
+        format.fRadix = ERadix::eBinary;
+        return formatIntegers( in.data(), in.length(), format );
     }
 
     void stripBlanks( std::string& str )
@@ -832,6 +900,138 @@ namespace NStringUtils
     }
 
 
+    namespace
+    {
+        bool setOverflow( bool * overflow )
+        {
+            if ( overflow )
+                *overflow = true;
+            return false;
+        }
+
+        // value of the hex digits in [data, data+len), the bytes in skip are ignored
+        // the significant digits are right aligned in a '0' filled block and converted by one parseHex16
+        bool parseHexDigits( const char * data, size_t len, const NSIMDUtils::CByteSet & skip, uint64_t & value, size_t maxBits, bool * overflow )
+        {
+            value = 0;
+            char block[ 16 ];
+            std::memset( block, '0', sizeof( block ) );
+
+            if ( NSIMDUtils::findFirstOf( data, len, 0, skip ) == std::string::npos )
+            {
+                while ( len && ( *data == '0' ) )
+                {
+                    ++data;
+                    --len;
+                }
+                if ( len > sizeof( block ) )
+                    return NSIMDUtils::isHexDigits( data, len ) && setOverflow( overflow );
+                std::memcpy( block + sizeof( block ) - len, data, len );
+            }
+            else
+            {
+                auto values = NSIMDUtils::hexDigitValues();
+                char digits[ 16 ];
+                size_t numDigits = 0;
+                bool tooMany = false;
+                for ( size_t ii = 0; ii < len; ++ii )
+                {
+                    auto ch = data[ ii ];
+                    if ( skip.contains( ch ) )
+                        continue;
+                    if ( values[ static_cast< unsigned char >( ch ) ] == 0xFF )
+                        return false;
+                    if ( !numDigits && ( ch == '0' ) )
+                        continue;
+                    if ( numDigits == sizeof( digits ) )
+                        tooMany = true;
+                    else
+                        digits[ numDigits++ ] = ch;
+                }
+                if ( tooMany )
+                    return setOverflow( overflow );
+                std::memcpy( block + sizeof( block ) - numDigits, digits, numDigits );
+            }
+
+            if ( !NSIMDUtils::parseHex16( block, value ) )
+                return false;
+            if ( ( maxBits < 64 ) && ( value >> maxBits ) )
+            {
+                value = 0;
+                return setOverflow( overflow );
+            }
+            return true;
+        }
+    }
+
+    bool parseHexLiteral( std::string_view value, uint64_t & retVal, size_t maxBits, bool * overflow )
+    {
+        static const NSIMDUtils::CByteSet sSkip( " \t;", 3 );
+        retVal = 0;
+        if ( overflow )
+            *overflow = false;
+
+        size_t begin = 0;
+        while ( ( begin < value.length() ) && ( ( value[ begin ] == ' ' ) || ( value[ begin ] == '\t' ) ) )
+            begin++;
+        if ( ( ( begin + 2 ) > value.length() ) || ( value[ begin ] != '0' ) || ( ( value[ begin + 1 ] != 'x' ) && ( value[ begin + 1 ] != 'X' ) ) )
+            return false;
+        begin += 2;
+
+        return parseHexDigits( value.data() + begin, value.length() - begin, sSkip, retVal, maxBits, overflow );
+    }
+
+    bool parseHexWord( std::string_view word, uint64_t & retVal, size_t maxBits, bool * overflow )
+    {
+        static const NSIMDUtils::CByteSet sSkip( "_", 1 );
+        retVal = 0;
+        if ( overflow )
+            *overflow = false;
+
+        if ( ( word.length() > 2 ) && ( word[ 0 ] == '0' ) && ( ( word[ 1 ] == 'x' ) || ( word[ 1 ] == 'X' ) ) )
+            word.remove_prefix( 2 );
+        if ( word.empty() || ( word.find_first_not_of( '_' ) == std::string_view::npos ) )
+            return false;
+        return parseHexDigits( word.data(), word.length(), sSkip, retVal, maxBits, overflow );
+    }
+
+    bool parseHexWords( std::string_view text, std::vector< uint64_t > & values, size_t maxBits, std::vector< size_t > * badIndexes )
+    {
+        static const NSIMDUtils::CByteSet sWordEnd( " \t\r\n/", 5 );
+        bool aOK = true;
+        size_t pos = 0;
+        while ( pos < text.length() )
+        {
+            auto ch = text[ pos ];
+            if ( ( ch == ' ' ) || ( ch == '\t' ) || ( ch == '\r' ) || ( ch == '\n' ) )
+            {
+                ++pos;
+                continue;
+            }
+            if ( ( ch == '/' ) && ( ( pos + 1 ) < text.length() ) && ( text[ pos + 1 ] == '/' ) )
+            {
+                pos = text.find( '\n', pos );
+                if ( pos == std::string_view::npos )
+                    break;
+                continue;
+            }
+
+            auto end = NSIMDUtils::findFirstOf( text.data(), text.length(), pos + 1, sWordEnd );
+            if ( end == std::string::npos )
+                end = text.length();
+            uint64_t value = 0;
+            if ( !parseHexWord( text.substr( pos, end - pos ), value, maxBits ) )
+            {
+                aOK = false;
+                if ( badIndexes )
+                    badIndexes->push_back( values.size() );
+            }
+            values.push_back( value );
+            pos = end;
+        }
+        return aOK;
+    }
+
     int hexToInt( const char *id, bool * aOK )
     {
         if ( aOK )
@@ -876,40 +1076,25 @@ namespace NStringUtils
         if ( !fmt )
             return std::string();
 
-        size_t len = 0;
+        // most messages fit on the stack, only measure the ones that do not
+        char buff[ 1024 ];
         va_list tmp;
         va_copy( tmp, marker );
-        len = vscprintf( fmt, tmp ) + 1;
+        int written = vsnprintf( buff, sizeof( buff ), fmt, tmp );
         va_end( tmp );
-        char * buff = new char[ len ];
-
-        int written = 0;
+        if ( ( written >= 0 ) && ( static_cast< size_t >( written ) < sizeof( buff ) ) )
+            return std::string( buff, written );
 
         va_copy( tmp, marker );
-        written = vsnprintf( buff, len, fmt, tmp );
+        int len = vscprintf( fmt, tmp );
         va_end( tmp );
+        if ( len <= 0 )
+            return std::string();
 
-        std::string retVal;
-        if ( written )
-            retVal = buff;
-        delete[] buff;
-        return retVal;
-    }
-
-    std::list< std::string > stripParen( const std::list< std::string > & list )
-    {
-        auto retVal = list;
-        for ( auto & ii : retVal )
-        {
-            if ( ii.empty() )
-                continue;
-
-            if ( *ii.begin() == '(' && *ii.rbegin() == ')' )
-            {
-                ii.erase( 0, 1 );
-                ii.erase( ii.length() - 1, 1 );
-            }
-        }
+        std::string retVal( len, '\0' );
+        va_copy( tmp, marker );
+        vsnprintf( &retVal[ 0 ], len + 1, fmt, tmp );
+        va_end( tmp );
         return retVal;
     }
 
@@ -918,24 +1103,30 @@ namespace NStringUtils
         if ( lhs == rhs )
             return true;
 
-        auto lhsSplit = stripParen( splitString( lhs, "|" ) );
-        auto lhsExps = std::set< std::string >( lhsSplit.begin(), lhsSplit.end() );
+        return CRegExSet::splitAlternation( lhs ) == CRegExSet::splitAlternation( rhs );
+    }
 
-        auto rhsSplit = stripParen( splitString( rhs, "|" ) );
-        auto rhsExps = std::set< std::string >( rhsSplit.begin(), rhsSplit.end() );
 
-        return lhsExps == rhsExps;
+    namespace
+    {
+        // the byte matcher gives the same results as QRegularExpression (which sees the data as UTF-8)
+        // only on ASCII data, nullptr for other data or when the pattern needs QRegularExpression
+        std::shared_ptr< const CByteRegEx > byteRegExFor( const std::string & data, const std::string & pattern, bool nocase )
+        {
+            if ( !NSIMDUtils::isAscii( data.data(), data.length() ) )
+                return {};
+            return CRegExCache::instance()->getByteRegEx( pattern, nocase );
+        }
     }
 
-
     bool isExactMatchRegEx( const std::string & data, const std::string & pattern, bool nocase )
     {
-        std::string regEx = "\\A(" + pattern + ")\\z";
-        QRegularExpression regExp( QString::fromStdString( regEx ) );
+        if ( auto byteRegExp = byteRegExFor( data, pattern, nocase ) )
+            return byteRegExp->exactMatch( data );
+
+        auto regExp = CRegExCache::instance()->get( "\\A(" + pattern + ")\\z", nocase );
         if ( !regExp.isValid() )
             return false;
-        if ( nocase )
-            regExp.setPatternOptions( QRegularExpression::CaseInsensitiveOption );
         auto match = regExp.match( QString::fromStdString( data ), 0, QRegularExpression::PartialPreferCompleteMatch );
         return match.hasMatch();
     }
@@ -1010,25 +1201,17 @@ namespace NStringUtils
         if ( !delim )
             return lhs + rhs;
 
-        std::string retVal = lhs;
-
         size_t delimLen = strlen( delim );
-        bool lhsNeedsDelim = ( retVal.length() < delimLen );
-        if ( !lhsNeedsDelim )
-        {
-            std::string::reverse_iterator ii = retVal.rbegin() + ( strlen( delim ) - 1 );
-            const char * lshD = &*( ii );
-            lhsNeedsDelim = strcmp( lshD, delim ) != 0;
-        }
-        bool rhsNeedsDelim = strncmp( rhs.c_str(), delim, strlen( delim ) ) != 0;
+        bool lhsNeedsDelim = ( lhs.length() < delimLen ) || ( lhs.compare( lhs.length() - delimLen, delimLen, delim ) != 0 );
+        bool rhsNeedsDelim = strncmp( rhs.c_str(), delim, delimLen ) != 0;
+
+        std::string retVal;
+        retVal.reserve( lhs.length() + delimLen + rhs.length() );
+        retVal += lhs;
         if ( lhsNeedsDelim && rhsNeedsDelim )
-            retVal += delim + rhs;
+            retVal.append( delim, delimLen ).append( rhs );
         else if ( !lhsNeedsDelim && !rhsNeedsDelim )
-        {
-            std::string newRHS = rhs;
-            newRHS.erase( newRHS.begin(), newRHS.begin() + delimLen );
-            retVal += newRHS;
-        }
+            retVal.append( rhs, delimLen, std::string::npos );
         else
             retVal += rhs;
         return retVal;
@@ -1051,19 +1234,19 @@ namespace NStringUtils
     std::string joinString( const T & list, const S & delim, bool condenseBlanks )
     {
         std::string retVal;
-        for ( typename T::const_iterator ii = list.begin(); ii != list.end(); ++ii )
-        {
-            if ( ( !condenseBlanks || !( *ii ).empty() ) && !retVal.empty() )
-                retVal += delim;
-            retVal += *ii;
-        }
+        if constexpr ( std::is_same< S, char >::value )
+            appendJoinedString( retVal, list.begin(), list.end(), std::string_view( &delim, 1 ), condenseBlanks );
+        else
+            appendJoinedString( retVal, list.begin(), list.end(), delim, condenseBlanks );
         return retVal;
     }
 
     std::string joinString( const std::pair< std::string, std::string > & pair, const std::string & delim, bool condenseBlanks )
     {
-        std::list< std::string > list = { pair.first, pair.second };
-        return joinString< std::list< std::string >, std::string >( list, delim, condenseBlanks );
+        std::string_view list[] = { pair.first, pair.second };
+        std::string retVal;
+        appendJoinedString( retVal, std::begin( list ), std::end( list ), delim, condenseBlanks );
+        return retVal;
     }
 
     std::string joinString( const std::list< std::string > & list, const std::string & delim, bool condenseBlanks )
@@ -1106,102 +1289,40 @@ namespace NStringUtils
         return joinString< std::set< std::string, noCaseStringCmp >, char >( list, delim, condenseBlanks );
     }
 
-    std::list< std::string > splitString( const std::string & string, const std::string & oneOfDelim, bool skipEmpty, bool keepQuoted, bool stripQuotes )
+    std::string joinString( const CNoCaseStringSet & list, const std::string & delim, bool condenseBlanks )
     {
-        std::list< std::string > retVal;
-        if ( string.empty() )
-            return retVal;
-        std::string delim = oneOfDelim;
-        if ( keepQuoted )
-            delim += "\"\'";
-        std::string::size_type prevPos = 0;
-        auto pos = string.find_first_of( delim );
-        while ( pos != std::string::npos )
-        {
-            if ( keepQuoted && ( ( string[ pos ] == '"' ) || ( string[ pos ] == '\'' )  ) )
-            {
-                std::string prefix;
-                if ( pos != prevPos )
-                    prefix = string.substr( prevPos, pos - prevPos );
-
-                prevPos = pos;
-                pos = string.find_first_of( "'\"", prevPos + 1 );
-                if ( pos == std::string::npos )
-                {
-                    std::string curr;
-                    if ( prefix.empty() ) // it started with a quote
-                    {
-                        if ( stripQuotes )
-                            curr = string.substr( prevPos + 1 );
-                        else
-                            curr = string.substr( prevPos );
-                    }
-                    else
-                    {
-                        // quote was embedded....
-                        pos = string.find_first_of( delim, prevPos + 1 );
-                        if ( pos == std::string::npos )
-                            curr = prefix + string.substr( prevPos );
-                        else
-                        {
-                            curr = prefix + string.substr( prevPos, pos - prevPos );
-                            if ( stripQuotes )
-                                curr = NStringUtils::stripQuotes( curr );
-                            retVal.push_back( curr );
-                            prevPos = pos + 1;
-                            pos = string.find_first_of( delim, prevPos );
-                            continue;
-                        }
-                    }
-
+        return joinString< std::vector< std::string_view >, std::string >( list.sorted(), delim, condenseBlanks );
+    }
 
-                    if ( stripQuotes )
-                        curr = NStringUtils::stripQuotes( curr );
-                    retVal.push_back( curr );
-                    prevPos = std::string::npos;
-                    break;
-                }
-                else
-                {
-                    auto curr = string.substr( prevPos, pos - prevPos + 1 );
-                    if ( stripQuotes )
-                        curr = NStringUtils::stripQuotes( curr );
-                    retVal.push_back( prefix + curr );
-                    prevPos = pos + 2;
-                    pos = string.find_first_of( delim, prevPos );
-                    continue;
-                }
-            }
+    std::string joinString( const CNoCaseStringSet & list, char delim, bool condenseBlanks )
+    {
+        return joinString< std::vector< std::string_view >, char >( list.sorted(), delim, condenseBlanks );
+    }
 
-            std::string curr = string.substr( prevPos, pos - prevPos );
-            if ( !skipEmpty || !curr.empty() )
-            {
-                if ( stripQuotes )
-                    curr = NStringUtils::stripQuotes( curr );
-                retVal.push_back( curr );
-            }
-            prevPos = pos + 1;
-            pos = string.find_first_of( delim, prevPos );
-        }
-        if ( prevPos < string.length() || ( oneOfDelim.find( *string.rbegin() ) != std::string::npos ) )
-        {
-            std::string curr = string.substr( prevPos );
-            if ( !skipEmpty || !curr.empty() )
-            {
-                if ( stripQuotes )
-                    curr = NStringUtils::stripQuotes( curr );
-                retVal.push_back( curr );
-            }
+    std::list< std::string > splitString( const std::string & string, const std::string & oneOfDelim, bool skipEmpty, bool keepQuoted, bool stripQuotes )
+    {
+        std::list< std::string > retVal;
+        CStringTokenizer tokenizer( string, oneOfDelim, skipEmpty, keepQuoted, stripQuotes );
+        std::string_view curr;
+        size_t quotedStart;
+        while ( tokenizer.nextRaw( curr, &quotedStart ) )
+        {
+            if ( !stripQuotes )
+                retVal.emplace_back( curr );
+            else if ( ( quotedStart != std::string::npos ) && ( quotedStart != 0 ) ) // only the quoted section is stripped
+                retVal.push_back( std::string( curr.substr( 0, quotedStart ) ) + NStringUtils::stripQuotes( std::string( curr.substr( quotedStart ) ) ) );
+            else
+                retVal.push_back( NStringUtils::stripQuotes( std::string( curr ) ) );
         }
-
         return retVal;
     }
 
     std::list< std::string > splitStringRegEx( const std::string & string, const std::string & pattern, bool nocase, bool skipEmpty )
     {
-        QRegularExpression regExp( QString::fromStdString( pattern ) );
-        if ( nocase )
-            regExp.setPatternOptions( QRegularExpression::CaseInsensitiveOption );
+        if ( auto byteRegExp = byteRegExFor( string, pattern, nocase ) )
+            return byteRegExp->split( string, skipEmpty );
+
+        auto regExp = CRegExCache::instance()->get( pattern, nocase );
 
         Q_ASSERT( regExp.isValid() );
         if ( !regExp.isValid() )
@@ -1225,12 +1346,7 @@ namespace NStringUtils
 
     std::list< std::string > splitString( const std::string & string, char delimChar, bool skipEmpty, bool keepQuoted, bool stripQuotes )
     {
-        if ( string.empty() )
-            return std::list< std::string >();
-
-        std::string delim( 1, delimChar );
-
-        return splitString( string, delim, skipEmpty, keepQuoted, stripQuotes );
+        return splitString( string, std::string( 1, delimChar ), skipEmpty, keepQuoted, stripQuotes );
     }
 
     std::string toupper( std::string retVal )
@@ -1312,12 +1428,18 @@ namespace NStringUtils
 
     std::string::size_type strCaseFind( const std::string & s1, const std::string & substr )
     {
-        auto pos = std::search( s1.begin(), s1.end(), substr.begin(), substr.end(),
-                                []( char ch1, char ch2 ) { return std::toupper( ch1, std::locale() ) == std::toupper( ch2, std::locale() ); }
-        );
-        if ( pos == s1.end() )
+        return NSIMDUtils::findNoCase( s1.data(), s1.length(), substr.data(), substr.length() );
+    }
+
+    std::string::size_type strCaseFind( const std::string & s1, const CMultiStringSearch & needles, size_t * which )
+    {
+        size_t pos;
+        size_t needleIdx;
+        if ( !needles.findFirst( s1, pos, needleIdx ) )
             return std::string::npos;
-        return pos - s1.begin();
+        if ( which )
+            *which = needleIdx;
+        return pos;
     }
 
     bool strCaseSuffix( const std::string & s1, const std::string & substr )
@@ -1327,7 +1449,7 @@ namespace NStringUtils
             return false;
         }
         std::string::size_type retVal = s1.length() - substr.length();
-        return strCaseCmp( s1.substr( retVal ), substr ) == 0;
+        return NSIMDUtils::equalsNoCase( s1.data() + retVal, substr.length(), substr.data(), substr.length() );
     }
 
     bool stringCompare( const std::string & s1, const std::string & s2, bool caseInsentive )
@@ -1383,169 +1505,156 @@ namespace NStringUtils
         return strNEqual( s1.c_str(), s2.c_str(), len, caseInsensitive );
     }
 
-    std::string writeEscaped( const std::string & s, bool escapeWhitespace )
+    namespace
     {
-        std::string escaped;
-        escaped.reserve( s.size() );
-        for ( size_t ii = 0; ii < s.size(); ++ii )
-        {
-            char c = s.at( ii );
-            if ( c == '<' )
-                escaped += "&lt;";
-            else if ( c == '>' )
-                escaped.append( "&gt;" );
-            else if ( c == '&' )
-                escaped.append( "&amp;" );
-            else if ( c == '\"' )
-                escaped.append( "&quot;" );
-            else if ( c == '\\' ) 
-                escaped.append( "\\\\" );
-            else if ( escapeWhitespace && ::isspace( c ) )
-            {
-                if ( c == '\n' )
-                    escaped.append( "&#10;" );
-                else if ( c == '\r' )
-                    escaped.append( "&#13;" );
-                else if ( c == '\t' )
-                    escaped.append( "&#9;" );
-                else if ( c == ' ' )
-                    escaped.append( "%20" );
-                else
-                    escaped += c;
-            }
-            else
-            {
-                escaped += c;
-            }
+        const NSIMDUtils::CByteSet & escapedChars( bool escapeWhitespace )
+        {
+            static const NSIMDUtils::CByteSet sChars( "<>&\"\\", 5 );
+            static const NSIMDUtils::CByteSet sWhitespaceChars( "<>&\"\\\n\r\t ", 9 );
+            return escapeWhitespace ? sWhitespaceChars : sChars;
         }
-        return escaped;
-    }
-    std::string writeQuotedStringForXml(const std::string & name)
-    {
-        auto retVal = NStringUtils::writeEscaped(name);
-        if (!retVal.empty() && retVal.back() == '\\')
-            retVal += " ";
-        retVal = '\"' + retVal + '\"';
-        return retVal;
-    }
-    bool extractEnvVariable( const std::string & inStr, std::string & pre, std::string & var, std::string & post )
-    {
-        std::string::size_type pos1 = inStr.find( '%' );
-        std::string::size_type pos2 = std::string::npos;
-        if ( pos1 != std::string::npos ) // has a % in it
+
+        // the replacement for a byte in escapedChars
+        std::string_view escapeFor( char ch )
         {
-            pos2 = inStr.find( '%', pos1 + 1 );
-            if ( pos2 == std::string::npos )
+            switch ( ch )
             {
-                var = inStr;
-                return true; // not an 
+                case '<': return "&lt;";
+                case '>': return "&gt;";
+                case '&': return "&amp;";
+                case '\"': return "&quot;";
+                case '\\': return "\\\\";
+                case '\n': return "&#10;";
+                case '\r': return "&#13;";
+                case '\t': return "&#9;";
+                case ' ': return "%20";
+                default: return std::string_view();
             }
-            pre = inStr.substr( 0, pos1 );
-            var = inStr.substr( pos1 + 1, pos2 - pos1 - 1 );
-            post = inStr.substr( pos2 + 1 );
-            return true;
-        }
-        pos1 = inStr.find( '$' );
-        if ( pos1 == std::string::npos )
-        {
-            var = inStr;
-            return true;
         }
-        pre = inStr.substr( 0, pos1 );
 
-        char otherChar = 0;
-        if ( *( inStr.begin() + pos1 + 1 ) == '{' )
+        // calls onText for each run copied as is, and onEscape for each byte replaced
+        // the runs are found 16 bytes at a time, so text without escapes is a single call
+        template< typename TOnText, typename TOnEscape >
+        void forEachEscapedRun( std::string_view s, bool escapeWhitespace, TOnText onText, TOnEscape onEscape )
         {
-            otherChar = '}';
+            auto && chars = escapedChars( escapeWhitespace );
+            size_t prev = 0;
+            while ( prev < s.length() )
+            {
+                auto pos = NSIMDUtils::findFirstOf( s.data(), s.length(), prev, chars );
+                if ( pos == std::string::npos )
+                    pos = s.length();
+                if ( pos > prev )
+                    onText( s.substr( prev, pos - prev ) );
+                if ( pos == s.length() )
+                    break;
+                onEscape( escapeFor( s[ pos ] ) );
+                prev = pos + 1;
+            }
         }
-        else if ( *( inStr.begin() + pos1 + 1 ) == '(' )
+
+        size_t escapedLength( std::string_view s, bool escapeWhitespace )
         {
-            otherChar = ')';
+            size_t retVal = 0;
+            forEachEscapedRun( s, escapeWhitespace, [ &retVal ]( std::string_view text ) { retVal += text.length(); }, [ &retVal ]( std::string_view text ) { retVal += text.length(); } );
+            return retVal;
         }
-        else
+
+        // out must have room for escapedLength characters
+        char * escapeInto( char * out, std::string_view s, bool escapeWhitespace )
         {
-            // is $VAR
-            pos2 = inStr.find_first_of( " \t/\\$", pos1 + 1 );
-            if ( pos2 == std::string::npos )
+            auto append = [ &out ]( std::string_view text )
             {
-                var = inStr.substr( pos1 + 1 );
-                post = std::string();
-                return true;
-            }
-            var = inStr.substr( pos1 + 1, pos2 - pos1 - 1 );
-            post = inStr.substr( pos2 );
-            return true;
+                std::memcpy( out, text.data(), text.length() );
+                out += text.length();
+            };
+            forEachEscapedRun( s, escapeWhitespace, append, append );
+            return out;
         }
+    }
 
-        // is $(VAR) or ${VAR}
-        pos2 = inStr.find( otherChar, pos1 );
-        if ( pos2 == std::string::npos )// malformed return false
-            return false;
+    bool needsEscaping( std::string_view s, bool escapeWhitespace )
+    {
+        return NSIMDUtils::findFirstOf( s.data(), s.length(), 0, escapedChars( escapeWhitespace ) ) != std::string::npos;
+    }
 
-        var = inStr.substr( pos1 + 2, pos2 - pos1 - 2 );
-        post = inStr.substr( pos2 + 1 );
+    std::string_view escapeIfNeeded( std::string_view s, std::string & buffer, bool escapeWhitespace )
+    {
+        if ( !needsEscaping( s, escapeWhitespace ) )
+            return s;
+        buffer.clear();
+        appendEscaped( buffer, s, escapeWhitespace );
+        return buffer;
+    }
 
-        return true;
+    void appendEscaped( std::string & out, std::string_view s, bool escapeWhitespace )
+    {
+        auto start = out.length();
+        out.resize( start + escapedLength( s, escapeWhitespace ) );
+        escapeInto( &out[ 0 ] + start, s, escapeWhitespace );
     }
 
-    std::string expandEnvVariable( const std::string & string, std::string * msg, bool * aOK )
+    std::string writeEscaped( const std::string & s, bool escapeWhitespace )
     {
-        if ( aOK )
-            *aOK = false;
-        if ( string.empty() )
-        {
-            if ( aOK )
-                *aOK = true;
-            return string;
-        }
+        if ( !needsEscaping( s, escapeWhitespace ) )
+            return s;
 
-        std::string pre;
-        std::string envVar;
-        std::string post;
-        if ( !extractEnvVariable( string, pre, envVar, post ) )
-        {
-            if ( msg )
-                *msg = "Malformed environmental variable";
-            return string;
-        }
+        std::string escaped;
+        appendEscaped( escaped, s, escapeWhitespace );
+        return escaped;
+    }
 
-        if ( envVar == string )
-        {
-            if ( aOK )
-                *aOK = true;
-            return string;
-        }
+    void writeEscaped( std::ostream & out, std::string_view s, bool escapeWhitespace )
+    {
+        auto write = [ &out ]( std::string_view text ) { out.write( text.data(), static_cast< std::streamsize >( text.length() ) ); };
+        forEachEscapedRun( s, escapeWhitespace, write, write );
+    }
 
-        auto tmp = qgetenv( envVar.c_str() );
-        if ( tmp == nullptr )
-        {
-            envVar = toupper( envVar );
-            tmp = qgetenv( envVar.c_str() );
-        }
+    void writeEscaped( QXmlStreamWriter & writer, std::string_view s, bool escapeWhitespace )
+    {
+        // entities go through writeEntityReference so the writer does not escape them again
+        forEachEscapedRun( s, escapeWhitespace,
+                           [ &writer ]( std::string_view text ) { writer.writeCharacters( QString::fromUtf8( text.data(), static_cast< int >( text.length() ) ) ); },
+                           [ &writer ]( std::string_view text )
+                           {
+                               if ( text.front() == '&' )
+                                   writer.writeEntityReference( QString::fromLatin1( text.data() + 1, static_cast< int >( text.length() ) - 2 ) );
+                               else
+                                   writer.writeCharacters( QString::fromLatin1( text.data(), static_cast< int >( text.length() ) ) );
+                           } );
+    }
 
-        if ( aOK )
-            *aOK = ( tmp != nullptr );
+    std::string writeQuotedStringForXml( const std::string & name )
+    {
+        // a trailing \ would escape the closing quote
+        bool trailingBackslash = !name.empty() && ( name.back() == '\\' );
         std::string retVal;
-        if ( tmp == nullptr )
-        {
-            if ( msg )
-                *msg = "Environmental variable '" + envVar + "' not found";
-            retVal = pre + "" + post;
-            if ( aOK )
-                *aOK = false;
-            return retVal;
-        }
-        else
-            retVal = pre + tmp.toStdString() + post;
-        if ( retVal.find_first_of( "%$" ) != std::string::npos )
-        {
-            return expandEnvVariable( retVal, msg, aOK );
-        }
-        if ( aOK )
-            *aOK = true;
+        retVal.resize( escapedLength( name, false ) + ( trailingBackslash ? 3 : 2 ) );
+        auto pos = &retVal[ 0 ];
+        *pos++ = '\"';
+        pos = escapeInto( pos, name, false );
+        if ( trailingBackslash )
+            *pos++ = ' ';
+        *pos = '\"';
         return retVal;
     }
 
+    void writeQuotedStringForXml( std::ostream & out, std::string_view name )
+    {
+        out.put( '\"' );
+        writeEscaped( out, name, false );
+        if ( !name.empty() && ( name.back() == '\\' ) )
+            out.put( ' ' );
+        out.put( '\"' );
+    }
+
+    std::string expandEnvVariable( const std::string & string, std::string * msg, bool * aOK )
+    {
+        // lookups are cached for this call only, so changes to the environment are always seen
+        CEnvironmentSnapshot env;
+        return CEnvVarExpander( env ).expand( string, msg, aOK );
+    }
+
 
 
 
@@ -1602,6 +1711,12 @@ namespace NStringUtils
                 }
             }
         }
+        else if ( *string == '\\' )
+        {
+            // a Verilog escaped identifier, ':' and ';' are part of it, see CIdentifierLexer (IdentifierLexer.h)
+            while ( !NStringUtils::isWhiteSpace( string ) && ( *string != '\0' ) && ( *string != '\n' ) )
+                *id++ = *string++;
+        }
         else
         {
             //Allow a semi-colon terminator
@@ -1655,7 +1770,8 @@ namespace NStringUtils
         }
         else
         {
-            pos = retVal.find_first_of( " \t\n:;" );
+            // a Verilog escaped identifier runs to the white space
+            pos = retVal.find_first_of( ( retVal[ 0 ] == '\\' ) ? " \t\n" : " \t\n:;" );
             if ( pos != std::string::npos )
             {
                 id = retVal.substr( 0, pos );
@@ -1697,7 +1813,12 @@ namespace NStringUtils
 
     bool matchKeyWord( const std::string & line, const std::string & key )
     {
-        return ( strNCaseCmp( line, key, key.length() ) == 0 ) && line.length() >= key.length();
+        return ( line.length() >= key.length() ) && ( NSIMDUtils::mismatchNoCase( line.data(), key.data(), key.length() ) == key.length() );
+    }
+
+    bool matchKeyWord( const std::string & line, const CMultiStringSearch & keys, size_t * which )
+    {
+        return keys.matchKeyWord( line, which );
     }
 
 
@@ -2096,7 +2217,7 @@ namespace NStringUtils
 
             for ( auto ii : retVal )
             {
-                QRegularExpression regExp( QString::fromStdString( ii ) );
+                auto regExp = CRegExCache::instance()->get( ii );
                 if ( !regExp.isValid() )
                 {
                     if ( msg )
@@ -2266,41 +2387,32 @@ namespace NStringUtils
             }
         }
 
+        // same padding as CReportWriter, appended into the line rather than through PadString temporaries
         QStringList headers;
         QString headerLine;
-        QTextStream ts( &headerLine );
-        for ( int ii = 0; ii < columnNames.size(); ++ii )
-            ts << NStringUtils::PadString( columnNames[ ii ], maxSize[ ii ], NStringUtils::EPadType::eCenter ) << "  ";
+        CReportWriter::appendRow( headerLine, columnNames, maxSize, EPadType::eCenter );
         headers << headerLine;
-        headerLine.clear();
+
+        QString dashLine;
         for ( int ii = 0; ii < columnNames.size(); ++ii )
-            ts << QString( maxSize[ ii ], '-' ) << "  ";
-        headers << headerLine;
+            dashLine += QString( maxSize[ ii ], '-' ) + "  ";
+        headers << dashLine;
 
         if ( !subHeader.isEmpty() )
         {
-            QString headerLine;
-            QTextStream ts( &headerLine );
-            for ( int ii = 0; ( ii < subHeader.size() ) && ( ii < static_cast< int >( maxSize.size() ) ); ++ii )
-                ts << NStringUtils::PadString( subHeader[ ii ], maxSize[ ii ], NStringUtils::EPadType::eLeftJustify ) << "  ";
-            headers << headerLine;
-
             headerLine.clear();
-            for ( int ii = 0; ii < columnNames.size(); ++ii )
-                ts << QString( maxSize[ ii ], '-' ) << "  ";
+            CReportWriter::appendRow( headerLine, subHeader, maxSize, EPadType::eLeftJustify );
             headers << headerLine;
+            headers << dashLine;
         }
-        
+
         QStringList retVal;
+        retVal.reserve( data.size() );
         for ( auto && ii : data )
         {
             Q_ASSERT( ii.size() == maxSize.size() );
             QString currLine;
-            QTextStream ts( &currLine );
-            for ( int jj = 0; ( jj < static_cast<int>( maxSize.size() ) ) && ( jj < ii.size() ); jj++ )
-            {
-                ts << NStringUtils::PadString( ii[ jj ], maxSize[ jj ], NStringUtils::EPadType::eLeftJustify ) << "  ";
-            }
+            CReportWriter::appendRow( currLine, ii, maxSize, EPadType::eLeftJustify );
             retVal << currLine;
         }
 
@@ -2313,7 +2425,7 @@ namespace NStringUtils
 
     QString encodeRegEx( QString retVal )
     {
-        QRegularExpression regEx( "([\\^\\$\\.\\*\\+\\?\\|\\(\\)\\[\\]\\{\\}\\\\])" );
+        auto regEx = CRegExCache::instance()->get( "([\\^\\$\\.\\*\\+\\?\\|\\(\\)\\[\\]\\{\\}\\\\])" );
         retVal.replace( regEx, "\\\\1" );
         return retVal;
     }
@@ -2325,82 +2437,73 @@ namespace NStringUtils
 
     std::string encodeRegEx( const std::string & inString )
     {
-        return encodeRegEx( QString::fromStdString( inString ) ).toStdString();
+        // the special characters are all ASCII, so the UTF-8 bytes can be escaped in place
+        static const NSIMDUtils::CByteSet sSpecial( "^$.*+?|()[]{}\\", 14 );
+
+        std::string retVal;
+        size_t start = 0;
+        size_t pos = NSIMDUtils::findFirstOf( inString.data(), inString.length(), 0, sSpecial );
+        if ( pos == std::string::npos )
+            return inString;
+
+        retVal.reserve( inString.length() + 8 );
+        for ( ; pos != std::string::npos; pos = NSIMDUtils::findFirstOf( inString.data(), inString.length(), start, sSpecial ) )
+        {
+            retVal.append( inString, start, pos - start );
+            retVal.push_back( '\\' );
+            retVal.push_back( inString[ pos ] );
+            start = pos + 1;
+        }
+        retVal.append( inString, start, std::string::npos );
+        return retVal;
     }
 
     bool isNumericString( const std::string &constString, uint64_t & val, unsigned int & numBits )
     {
         val = 0;
-        numBits = 0;
+        numBits = static_cast<unsigned int>( constString.size() );
+        if ( constString.empty() )
+            return true;
 
-        char bit = constString[ 0 ];
-        bool allsame = true;
-        for ( size_t i = 0; allsame && ( i < constString.size() ); i++ )
-        {
-            allsame = ( bit == constString[ i ] );
-        }
+        // at most 64 bits are converted, 16 per step, the scalar loop finishes the block with a bad character
+        auto data = constString.data();
+        size_t maxBit = std::min< size_t >( constString.size(), 64 );
+        size_t numValid = 0;
+        uint64_t value = 0;
+        for ( uint32_t bits; ( ( numValid + 16 ) <= maxBit ) && NSIMDUtils::parseBin16( data + numValid, bits ); numValid += 16 )
+            value = ( value << 16 ) | bits;
+        for ( ; ( numValid < maxBit ) && ( ( data[ numValid ] == '0' ) || ( data[ numValid ] == '1' ) ); ++numValid )
+            value = ( value << 1 ) | static_cast< uint64_t >( data[ numValid ] == '1' );
+        val = value;
+
+        // all 0s, of any length, or all 1s of at most 64
+        if ( ( numValid == maxBit ) && !value && ( NSIMDUtils::countByte( data, constString.size(), '0' ) == constString.size() ) )
+            return true;
+        if ( ( numValid == constString.size() ) && ( constString.size() <= 64 ) && ( value == ( ~0ULL >> ( 64 - constString.size() ) ) ) )
+            return true;
 
-        bool retVal = true;
-        if ( allsame && ( ( constString[ 0 ] == '0' ) || ( constString.size() <= 64 && constString[ 0 ] == '1' ) ) )
-        {
-            numBits = static_cast<unsigned int>( constString.size() );
-            retVal = true;
-            if ( constString[ 0 ] == '0' )
-                val = 0;
-            else
-            {
-                auto isSigned = ( constString.size() == 64 ) && constString[ 0 ] == '1';
-                val = NStringUtils::binToDec< uint64_t >( constString, isSigned, &retVal );
-            }
-        }
-        else
-        {
-            // 0 1 constants ?
-            size_t maxBit = 64;
-            retVal = true;
-            for ( size_t bitNum = 0; retVal && ( bitNum < constString.size() ) && ( bitNum < maxBit ); bitNum++ )
-            {
-                char bit = constString[ bitNum ];
-                retVal = ( bit == '1' ) || ( bit == '0' );
-                if ( !retVal )
-                {
-                    break;
-                }
-                val = ( val << 1 ) + ( bit == '1' );
-                numBits++;
-            }
-            if ( numBits >= maxBit )
-            {
-                retVal = false;
-            }
-            numBits = static_cast<unsigned int>( constString.size() );
-        }
-        return retVal;
+        return ( numValid == maxBit ) && ( maxBit < 64 );
     }
 
-    bool endsWith( const char * str, char ch )
+    namespace
     {
-        if ( *str == ch )
+        // "--" and "//" lines are separators/comments, not encoded data
+        bool isSeparatorLine( const char * str, size_t len )
         {
-            for( const char * nextChar = str; *nextChar; ++nextChar )
-            {
-                if ( ( *nextChar == ch ) || !*nextChar )
-                    return true;
+            if ( len < 2 )
                 return false;
-            }
+            return ( ( *str == '-' ) && ( *( str + 1 ) == '-' ) )
+                || ( ( *str == '/' ) && ( *( str + 1 ) == '/' ) );
         }
-        return false;
-    }
 
-    bool isValidEncodeChar( char ch )
-    {
-        if ( ( ch >= 'A' && ch <= 'Z' )
-             || ( ch >= 'a' && ch <= 'z' )
-             || ( ch >= '0' && ch <= '9' )
-             || ( ( ch == '+' ) || ( ch == '/' ) )
-             )
-             return true;
-        return false;
+        bool validateEncodedLine( const char * str, size_t len, ETransferEncoding encoding, bool complete )
+        {
+            CStreamDecoder decoder( encoding );
+            std::string decoded;
+            if ( !decoder.decode( str, len, decoded ) )
+                return false;
+            return !complete || decoder.finish( decoded );
+        }
     }
 
     bool validateBase64String( const char * str, size_t len )
@@ -2411,28 +2514,11 @@ namespace NStringUtils
         if ( len == std::string::npos )
             len = std::strlen( str );
 
-        if ( len >= 2 )
-        {
-            if ( *str == '-' && ( *( str + 1 ) == '-' ) )
-                return true;
-
-            if ( *str == '/' && ( *( str + 1 ) == '/' ) )
-                return true;
-        }
-
-        for ( const char * curr = str; *curr; ++curr )
-        {
-            if ( endsWith( curr, '=' ) )
-                continue;
-            if ( ( *curr == '\r' ) || ( *curr == '\n' ) )
-                continue;
+        if ( isSeparatorLine( str, len ) )
+            return true;
 
-            if ( !isValidEncodeChar( *curr ) )
-            {
-                return false;
-            }
-        }
-        return true;
+        // a line may end mid group, the rest of the group is on the next line
+        return validateEncodedLine( str, len, ETransferEncoding::eBase64, false );
     }
 
     bool validateBase64String( const std::string & str )
@@ -2448,36 +2534,18 @@ namespace NStringUtils
         if ( len == std::string::npos )
             len = std::strlen( str );
 
-        if ( len >= 2 )
-        {
-            if ( *str == '-' && ( *( str + 1 ) == '-' ) )
-                return true;
-
-            if ( *str == '/' && ( *( str + 1 ) == '/' ) )
-                return true;
-        }
+        if ( isSeparatorLine( str, len ) )
+            return true;
 
         if ( len > 76 )
             return false;
 
-        for ( const char * curr = str; *curr; ++curr )
-        {
-            if ( endsWith( curr, '=' ) )
-                continue;
-            if ( ( *curr == '\r' ) || ( *curr == '\n' ) )
-                continue;
-
-            if ( !isValidEncodeChar( *curr ) )
-            {
-                return false;
-            }
-        }
-        return true;
+        return validateEncodedLine( str, len, ETransferEncoding::eUUEncode, true );
     }
 
     bool validateUUEncodeString( const std::string & str )
     {
-        return validateBase64String( str.c_str(), str.length() );
+        return validateUUEncodeString( str.c_str(), str.length() );
     }
 
     bool validateQuotedPrintableString( const char * str, size_t len )
@@ -2491,41 +2559,10 @@ namespace NStringUtils
         if ( len > 76 )
             return false;
 
-        if ( len >= 2 )
-        {
-            if ( *str == '-' && ( *( str + 1 ) == '-' ) )
-                return true;
-
-            if ( *str == '/' && ( *( str + 1 ) == '/' ) )
-                return true;
-        }
-
-        for ( const char * curr = str; *curr; ++curr )
-        {
-            if ( ( *curr == '=' ) && *(curr+1) && *(curr+2) )
-            {
-                if ( ( *(curr+1) >= 'A' ) && ( *(curr+1) <= 'F' ) )
-                    continue;
-                if ( ( *( curr + 1 ) >= '0' ) && ( *( curr + 1 ) <= '9' ) )
-                    continue;
-
-                return false;
-            }
-            if ( ( *curr == '\r' ) || ( *curr == '\n' ) )
-                continue;
-
-            if ( ( *curr >= 33 ) && ( *curr <= 60 ) )
-                continue;
-            if ( ( *curr >= 62 ) && ( *curr <= 126 ) )
-                continue;
+        if ( isSeparatorLine( str, len ) )
+            return true;
 
-            if ( ( *curr == 9 ) && ( *curr == 32 ) )
-            {
-                if ( !*(curr+1) ) // at the end of the line
-                    return false;
-            }
-        }
-        return true;
+        return validateEncodedLine( str, len, ETransferEncoding::eQuotedPrintable, true );
     }
 
     bool validateQuotedPrintableString( const std::string & str )
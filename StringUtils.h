@@ -26,18 +26,24 @@
 #include <list>
 #include <set>
 #include <string>
+#include <string_view>
+#include <algorithm>
 #include <vector>
 #include <sstream>
 #include <iostream>
 #include <cstdarg>
 #include <climits>
+#include <type_traits>
 #include <cstdint>
 #include <chrono>
 #include <QString>
 
 #include "EnumUtils.h"
+#include "IntFormat.h"
 #include "StringComparisonClasses.h"
+#include "StringFormat.h"
 
+class QXmlStreamWriter;
 namespace NStringUtils
 {
 #if (QT_VERSION < QT_VERSION_CHECK( 5, 15, 0 ))
@@ -62,12 +68,18 @@ namespace NStringUtils
     inline bool isOperator( const std::string::iterator & s ){ return isOperator( *s ); }
     inline bool isOperator( const std::string::const_iterator & s ){ return isOperator( *s ); }
 
+    // same set of top level alternatives, regardless of order and grouping (see CRegExSet)
     bool regExEqual( const std::string & lhs, const std::string & rhs );
 
     bool isExactMatchRegEx( const std::string & data, const std::string & pattern, bool nocase );
 
+    // printf style, formatString( SAB_FORMAT( ... ) ) in StringFormat.h is the type safe alternative
     std::string getVAString( const char * fmt, va_list marker );
+#if defined( __GNUC__ ) || defined( __clang__ )
+    std::string getFMTString( const char * fmt, ... ) __attribute__( ( format( printf, 1, 2 ) ) );
+#else
     std::string getFMTString( const char * fmt, ... );
+#endif
     enum class EPadType
     {
         eLeftJustify,
@@ -89,25 +101,25 @@ namespace NStringUtils
 
     void padBinary( std::string &data, size_t maxSize, bool isSigned );
     std::string binToHex( const std::string & string );
+    // digits past the width of T repeat the sign, aOK is false when value does not fit in numDigits
     template< typename T >
     std::string intToHex( T value, int numDigits, int * aOK=nullptr )
     {
-        std::string stringRep( numDigits, '0' );
-        for ( int ii = 0; ii < numDigits; ++ii )
+        const int typeDigits = 2 * sizeof( T );
+        numDigits = std::max( numDigits, 0 );
+        auto numFormatted = std::min( numDigits, typeDigits );
+
+        std::string stringRep( 2 + numDigits, ( value < 0 ) ? 'F' : '0' );
+        stringRep[ 0 ] = '0';
+        stringRep[ 1 ] = 'x';
+        if ( numFormatted )
         {
-            T currBits = 0x0F & value;
-            char hexVal = 0;
-            if ( currBits <= 9 )
-                hexVal = currBits + '0';
-            else
-                hexVal = currBits - 10 + 'A';
-
-            stringRep[ numDigits - ii - 1 ] = hexVal;
-            value = value >> 4;
+            SIntFormat format;
+            format.fNumBits = 4 * numFormatted;
+            formatIntegers( &value, 1, format, &stringRep[ 2 + numDigits - numFormatted ] );
         }
-        stringRep = "0x" + stringRep;
         if ( aOK )
-            *aOK = ( value == 0 );
+            *aOK = ( numFormatted < typeDigits ) ? ( ( value >> ( 4 * numFormatted ) ) == 0 ) : !( value < 0 );
 
         return stringRep;
     }
@@ -169,9 +181,18 @@ namespace NStringUtils
     std::string replaceAll( const std::string& str, const std::string& from, char to );
     std::string replaceAll( const std::string& str, char from, const std::string& to );
 
+    // every pair of the table in one scan, see CMultiStringReplace
+    class CMultiStringReplace;
+    std::string replaceAll( std::string& str, const CMultiStringReplace & replacements );
+    std::string replaceAll( const std::string& str, const CMultiStringReplace & replacements );
+    std::string replaceAll( const std::string& str, const std::vector< std::pair< std::string, std::string > > & replacements );
+
+    // for many strings reuse one CEnvVarExpander and CEnvironmentSnapshot (EnvironmentSnapshot.h)
     std::string expandEnvVariable( const std::string & string, std::string * msg = nullptr, bool * aOK = nullptr );
 
+    // white space separated words, CIdentifierLexer::count (IdentifierLexer.h) counts HDL identifiers
     int count_identifiers( const char *stmt );
+    // one token per call into a caller sized buffer, NFileUtils::CLineReader (LineReader.h) returns views with line and column numbers
     bool get_string_token( FILE *fp, char *s );
     bool has_suffix( const char *str, const char *suffix );
     bool has_suffix( const std::string & str, const char *suffix );
@@ -186,6 +207,10 @@ namespace NStringUtils
 
     std::string joinString( const std::set< std::string, noCaseStringCmp > & list, const std::string & delim, bool condenseBlanks = false );
     std::string joinString( const std::set< std::string, noCaseStringCmp > & list, char delim, bool condenseBlanks = false );
+    // in noCaseStringCmp order, as the std::set versions, see NoCaseStringSet.h
+    class CNoCaseStringSet;
+    std::string joinString( const CNoCaseStringSet & list, const std::string & delim, bool condenseBlanks = false );
+    std::string joinString( const CNoCaseStringSet & list, char delim, bool condenseBlanks = false );
     std::string joinString( const std::set< std::string > & list, const std::string & delim, bool condenseBlanks = false );
     std::string joinString( const std::set< std::string > & list, char delim, bool condenseBlanks = false );
     std::string joinString( const std::list< std::string > & list, const std::string & delim, bool condenseBlanks = false );
@@ -200,20 +225,71 @@ namespace NStringUtils
     std::string joinString( const std::string & lhs, const std::string & rhs, const char * delim );
     std::string joinString( const std::string & lhs, const std::string & rhs, const std::string & delim );
 
+    // writes the join of [first, last) to out using the joinString rules, returns the end of the output
+    template< typename TIter, typename TOutIter >
+    TOutIter joinStringTo( TOutIter out, TIter first, TIter last, std::string_view delim, bool condenseBlanks = false )
+    {
+        bool hasOutput = false;
+        for ( ; first != last; ++first )
+        {
+            std::string_view curr( *first );
+            if ( hasOutput && ( !condenseBlanks || !curr.empty() ) )
+                out = std::copy( delim.begin(), delim.end(), out );
+            out = std::copy( curr.begin(), curr.end(), out );
+            hasOutput = hasOutput || !curr.empty();
+        }
+        return out;
+    }
+
+    // appends the join of [first, last) to out, sized up front so out grows at most once
+    template< typename TIter >
+    void appendJoinedString( std::string & out, TIter first, TIter last, std::string_view delim, bool condenseBlanks = false )
+    {
+        size_t length = 0;
+        bool hasOutput = false;
+        for ( auto ii = first; ii != last; ++ii )
+        {
+            std::string_view curr( *ii );
+            if ( hasOutput && ( !condenseBlanks || !curr.empty() ) )
+                length += delim.length();
+            length += curr.length();
+            hasOutput = hasOutput || !curr.empty();
+        }
+
+        auto start = out.length();
+        out.resize( start + length );
+        joinStringTo( &out[ 0 ] + start, first, last, delim, condenseBlanks );
+    }
+
+    // XML escapes <>&" and doubles \, escapeWhitespace also escapes newlines, carriage returns, tabs and spaces
+    // the input is scanned 16 bytes at a time and is returned as is when nothing needs escaping
+    bool needsEscaping( std::string_view s, bool escapeWhitespace = false );
+    // returns s when nothing needs escaping, otherwise the escaped text in buffer
+    std::string_view escapeIfNeeded( std::string_view s, std::string & buffer, bool escapeWhitespace = false );
+    void appendEscaped( std::string & out, std::string_view s, bool escapeWhitespace = false );
     std::string writeEscaped( const std::string & s, bool escapeWhitespace = false );
+    void writeEscaped( std::ostream & out, std::string_view s, bool escapeWhitespace = false );
+    // the escapes are written as entity references, so the writer does not escape them again
+    void writeEscaped( QXmlStreamWriter & writer, std::string_view s, bool escapeWhitespace = false );
     std::string writeQuotedStringForXml(const std::string & name);
+    void writeQuotedStringForXml( std::ostream & out, std::string_view name );
 
+    // bits past the width of T repeat the sign
     template< typename T >
     std::string toBinString( T val, size_t len = -1 )
     {
+        const size_t typeBits = sizeof( val ) * CHAR_BIT;
         if ( len == -1 )
-            len = sizeof( val ) * CHAR_BIT;
-        std::string retVal;
-        retVal.reserve( len );
+            len = typeBits;
 
-        for ( size_t ii = 0; ii < len; ++ii, val >>= 1 )
+        std::string retVal( len, ( val < 0 ) ? '1' : '0' );
+        auto numFormatted = std::min( len, typeBits );
+        if ( numFormatted )
         {
-            retVal.insert( retVal.begin(), ( val & 1 ) ? '1' : '0' );
+            SIntFormat format;
+            format.fRadix = ERadix::eBinary;
+            format.fNumBits = numFormatted;
+            formatIntegers( &val, 1, format, &retVal[ len - numFormatted ] );
         }
         return retVal;
     }
@@ -226,57 +302,71 @@ namespace NStringUtils
     std::string octToBin( const std::string & in, size_t len, bool * aOK = nullptr );
     std::string AsciiToBin( const std::string & in );
 
+    // arbitrary width, 4-state versions, see BitVector.h
+    class CBitVector;
+    CBitVector hexToBitVector( const std::string & in, size_t len = std::string::npos, bool * aOK = nullptr );
+    CBitVector decToBitVector( const std::string & in, size_t len = std::string::npos, bool * aOK = nullptr );
+    CBitVector octToBitVector( const std::string & in, size_t len = std::string::npos, bool * aOK = nullptr );
+    CBitVector binToBitVector( const std::string & in, size_t len = std::string::npos, bool * aOK = nullptr );
+    std::string toBinString( const CBitVector & value );
+    std::string binToHex( const CBitVector & value );
+    std::string binToOct( const CBitVector & value );
+    std::string binToDec( const CBitVector & value, bool isSigned );
+
+    // "0x" literal with optional surrounding blanks, blanks and ';' between the digits are ignored
+    // false on an invalid digit, or (with overflow set) when the value needs more than maxBits bits
+    bool parseHexLiteral( std::string_view value, uint64_t & retVal, size_t maxBits = 64, bool * overflow = nullptr );
+    // a single word from a waveform or memory initialization file, "0x" is optional and '_' separators are skipped
+    bool parseHexWord( std::string_view word, uint64_t & retVal, size_t maxBits = 64, bool * overflow = nullptr );
+    // whitespace separated words, "//" comments to the end of the line are skipped
+    // invalid words append 0 and their index to badIndexes, returns true when every word converted
+    bool parseHexWords( std::string_view text, std::vector< uint64_t > & values, size_t maxBits = 64, std::vector< size_t > * badIndexes = nullptr );
+
     int hexToInt( const char *id, bool * aOK = nullptr );
     template< typename T >
-    bool hexToInt( T & retVal, const std::string & value )
+    bool hexToInt( T & retVal, const std::string & value, bool * overflow = nullptr )
     {
+        static_assert( std::is_integral< T >::value && ( sizeof( T ) <= sizeof( uint64_t ) ), "hexToInt requires an integral type of at most 64 bits" );
         retVal = 0;
-        size_t begin = 0;
-        while ( begin < value.length() && ( ( value[ begin ] == ' ' ) || ( value[ begin ] == '\t' ) ) )
-            begin++;
-
-        if ( begin == value.length() || ( value[ begin ] != '0' ) )
-            return false;
-        ++begin;
-
-        if ( begin == value.length() || ( ( value[ begin ] != 'x' ) && ( value[ begin ] != 'X' ) ) )
+        uint64_t tmp = 0;
+        if ( !parseHexLiteral( value, tmp, sizeof( T ) * CHAR_BIT, overflow ) )
             return false;
-        ++begin;
-
-        size_t end = value.length() - 1;
-        while ( end >= begin && ( ( value[ end ] == ' ' ) || ( value[ end ] == '\t' ) || ( value[ end ] == ';' ) ) )
-        {
-            if ( end == 0 )
-                break;
-            end--;
-        }
+        retVal = static_cast< T >( tmp );
+        return true;
+    }
 
-        int index = 0;
-        while ( end >= begin )
+    // converts count literals into out, with the rules of parseHexWord and the width of T
+    // an invalid literal sets its out to 0 and adds its index to badIndexes, returns the number converted
+    template< typename T >
+    size_t hexToInts( const std::string_view * literals, size_t count, T * out, std::vector< size_t > * badIndexes = nullptr )
+    {
+        static_assert( std::is_integral< T >::value && ( sizeof( T ) <= sizeof( uint64_t ) ), "hexToInts requires an integral type of at most 64 bits" );
+        size_t retVal = 0;
+        for ( size_t ii = 0; ii < count; ++ii )
         {
-            char ch = ::tolower( value[ end ] );
-            T currVal = 0;
-            if ( ch >= '0' && ch <= '9' )
-                currVal = ch - '0';
-            else if ( ch >= 'a' && ch <= 'f' )
-                currVal = ch - 'a' + 10;
-            else if ( ( ch != ' ' ) && ( ch != '\t' ) && ( ch != ';' ) )
+            uint64_t value = 0;
+            if ( parseHexWord( literals[ ii ], value, sizeof( T ) * CHAR_BIT ) )
+            {
+                out[ ii ] = static_cast< T >( value );
+                retVal++;
+            }
+            else
             {
-                retVal = 0;
-                return false;
+                out[ ii ] = 0;
+                if ( badIndexes )
+                    badIndexes->push_back( ii );
             }
-            currVal = currVal << ( index * 4 );
-            retVal |= currVal;
-
-            if ( end == 0 )
-                break;
-            end--;
-            if ( ( ch != ' ' ) && ( ch != '\t' ) && ( ch != ';' ) )
-                index++;
         }
+        return retVal;
+    }
 
-        return true;
+    template< typename T >
+    size_t hexToInts( const std::vector< std::string_view > & literals, std::vector< T > & out, std::vector< size_t > * badIndexes = nullptr )
+    {
+        out.resize( literals.size() );
+        return hexToInts( literals.data(), literals.size(), out.data(), badIndexes );
     }
+
     bool  matchRegExpr( const char* s1, const char *s2 );
 
     bool stringCompare( const std::string & s1, const std::string & s2, bool caseInsensitive = true );
@@ -290,6 +380,9 @@ namespace NStringUtils
     int strCaseCmp( const char* s1, const std::string & s2 );
     int strCaseCmp( const std::string & s1, const std::string & s2 );
     std::string::size_type strCaseFind( const std::string & s1, const std::string & substr );
+    // first match of any of the needles, in one pass over s1
+    class CMultiStringSearch;
+    std::string::size_type strCaseFind( const std::string & s1, const CMultiStringSearch & needles, size_t * which = nullptr );
     bool strCaseSuffix( const std::string & s1, const std::string & substr );
 
     bool strEqual( const char* s1, const char* s2, bool caseInsensitive = false );
@@ -301,6 +394,8 @@ namespace NStringUtils
     bool strNEqual( const char* s1, const std::string & s2, size_t len, bool caseInsensitive = false );
     bool strNEqual( const std::string & s1, const std::string & s2, size_t len, bool caseInsensitive = false );
 
+    // the next white space, ':' or ';' terminated token, a "quoted" string or a \escaped identifier
+    // CIdentifierLexer (IdentifierLexer.h) finds the HDL identifiers of a whole buffer
     char * get_identifier_from_string( const char *string, char *id );
     std::string get_identifier_from_string_std( const std::string & string, std::string & id );
     std::string strip_terminal( const std::string & token, const std::string & term );
@@ -331,6 +426,8 @@ namespace NStringUtils
         }
     }
     bool matchKeyWord( const std::string & line, const std::string & key );
+    // true if any of the keys is a prefix of line, which is set to the longest matching key
+    bool matchKeyWord( const std::string & line, const CMultiStringSearch & keys, size_t * which = nullptr );
 
     std::string presentationFormat( const std::string & format );
 
@@ -339,6 +436,7 @@ namespace NStringUtils
     QString encodeRegEx( const char * inString );
     QString encodeRegEx( QString inString );
     std::string encodeRegEx( const std::string & inString );
+    // the alternatives of both in CRegExSet::alternation() form, CRegExSet::pattern() is the faster expression to match with
     std::string addToRegEx( std::string oldRegEx, const std::string & regEx );
 
     std::string left( std::string inString, size_t len );
@@ -410,15 +508,9 @@ namespace NStringUtils
     {
         if ( len == -1 )
             len = sizeof( val );
-        std::vector<bool> retVal;
-        retVal.reserve( len );
-
+        std::vector<bool> retVal( std::max( len, 0 ) );
         for ( int ii = 0; ii < len; ++ii, val >>= 1 )
-        {
-            bool value = ( val & 1 ) ? true : false;
-
-            retVal.insert( retVal.begin(), value );
-        }
+            retVal[ len - 1 - ii ] = ( val & 1 ) ? true : false;
         return retVal;
     }
 
@@ -0,0 +1,685 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "TransferCodecs.h"
+#include "SIMDUtils.h"
+
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace NStringUtils
+{
+    namespace
+    {
+        const char * kBase64Chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        const char * kHexChars = "0123456789ABCDEF";
+
+        const int8_t kInvalid = -1;
+        const int8_t kBlank = -2;
+        const int8_t kPadding = -3;
+
+        struct SBase64Table
+        {
+            SBase64Table()
+            {
+                for ( auto && ii : fDecode )
+                    ii = kInvalid;
+                for ( int8_t ii = 0; ii < 64; ++ii )
+                    fDecode[ static_cast< unsigned char >( kBase64Chars[ ii ] ) ] = ii;
+                fDecode[ static_cast< unsigned char >( ' ' ) ] = kBlank;
+                fDecode[ static_cast< unsigned char >( '\t' ) ] = kBlank;
+                fDecode[ static_cast< unsigned char >( '\r' ) ] = kBlank;
+                fDecode[ static_cast< unsigned char >( '\n' ) ] = kBlank;
+                fDecode[ static_cast< unsigned char >( '=' ) ] = kPadding;
+            }
+            int8_t fDecode[ 256 ];
+        };
+
+        const SBase64Table & base64Table()
+        {
+            static const SBase64Table sTable;
+            return sTable;
+        }
+
+        int hexValue( char ch )
+        {
+            if ( ( ch >= '0' ) && ( ch <= '9' ) )
+                return ch - '0';
+            if ( ( ch >= 'A' ) && ( ch <= 'F' ) )
+                return ch - 'A' + 10;
+            return -1;
+        }
+
+        bool isUUChar( char ch )
+        {
+            return ( ch >= 0x20 ) && ( ch <= 0x60 );
+        }
+
+        std::string describe( char ch )
+        {
+            if ( ( ch >= 0x20 ) && ( ch < 0x7F ) )
+                return std::string( "'" ) + ch + "'";
+            auto uch = static_cast< unsigned char >( ch );
+            return std::string( "0x" ) + kHexChars[ uch >> 4 ] + kHexChars[ uch & 0xF ];
+        }
+
+#ifdef SAB_HAS_SSE2
+        // decodes 16 alphabet characters into 12 bytes, false (and nothing written) if any byte
+        // is not in the alphabet, whitespace and padding are left to the scalar path
+        bool decodeBase64Block( const char * data, char * out )
+        {
+            auto block = _mm_loadu_si128( reinterpret_cast< const __m128i * >( data ) );
+            auto inRange = []( __m128i value, char lo, char hi )
+            {
+                return _mm_and_si128( _mm_cmpgt_epi8( value, _mm_set1_epi8( lo - 1 ) ), _mm_cmplt_epi8( value, _mm_set1_epi8( hi + 1 ) ) );
+            };
+            auto isUpper = inRange( block, 'A', 'Z' );
+            auto isLower = inRange( block, 'a', 'z' );
+            auto isDigit = inRange( block, '0', '9' );
+            auto isPlus = _mm_cmpeq_epi8( block, _mm_set1_epi8( '+' ) );
+            auto isSlash = _mm_cmpeq_epi8( block, _mm_set1_epi8( '/' ) );
+            auto valid = _mm_or_si128( _mm_or_si128( _mm_or_si128( isUpper, isLower ), _mm_or_si128( isDigit, isPlus ) ), isSlash );
+            if ( _mm_movemask_epi8( valid ) != 0xFFFF )
+                return false;
+
+            // the offset from the character to its sextet for each of the 5 ranges
+            auto offsets = _mm_or_si128(
+                _mm_or_si128( _mm_and_si128( isUpper, _mm_set1_epi8( -'A' ) ), _mm_and_si128( isLower, _mm_set1_epi8( 26 - 'a' ) ) ),
+                _mm_or_si128( _mm_and_si128( isDigit, _mm_set1_epi8( 52 - '0' ) ),
+                    _mm_or_si128( _mm_and_si128( isPlus, _mm_set1_epi8( 62 - '+' ) ), _mm_and_si128( isSlash, _mm_set1_epi8( 63 - '/' ) ) ) ) );
+            auto sextets = _mm_add_epi8( block, offsets );
+
+            // pairs of sextets into 12 bits, then pairs of those into 24 bits per 32 bit lane
+            auto pairs = _mm_or_si128( _mm_slli_epi16( _mm_and_si128( sextets, _mm_set1_epi16( 0x00FF ) ), 6 ), _mm_srli_epi16( sextets, 8 ) );
+            auto quads = _mm_or_si128( _mm_slli_epi32( _mm_and_si128( pairs, _mm_set1_epi32( 0xFFFF ) ), 12 ), _mm_srli_epi32( pairs, 16 ) );
+
+            uint32_t words[ 4 ];
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( words ), quads );
+            for ( auto && ii : words )
+            {
+                *out++ = static_cast< char >( ii >> 16 );
+                *out++ = static_cast< char >( ii >> 8 );
+                *out++ = static_cast< char >( ii );
+            }
+            return true;
+        }
+#endif
+    }
+
+    CStreamDecoder::CStreamDecoder( ETransferEncoding encoding ) :
+        fEncoding( encoding )
+    {
+    }
+
+    void CStreamDecoder::reset()
+    {
+        fError = false;
+        fOffset = 0;
+        fBits = 0;
+        fNumChars = 0;
+        fNumPadding = 0;
+        fLineState = 0;
+        fLineBytes = 0;
+        fPending.clear();
+    }
+
+    bool CStreamDecoder::setError( std::string * msg, const std::string & error, size_t offset )
+    {
+        fError = true;
+        fOffset = offset;
+        if ( msg )
+            *msg = error + " at offset " + std::to_string( offset );
+        return false;
+    }
+
+    bool CStreamDecoder::decode( const char * data, size_t len, std::string & out, std::string * msg )
+    {
+        if ( fError )
+            return false;
+
+        switch ( fEncoding )
+        {
+            case ETransferEncoding::eBase64:
+                return decodeBase64( data, len, out, msg );
+            case ETransferEncoding::eUUEncode:
+                return decodeUU( data, len, out, msg );
+            case ETransferEncoding::eQuotedPrintable:
+                return decodeQP( data, len, out, msg );
+        }
+        return false;
+    }
+
+    bool CStreamDecoder::decodeBase64( const char * data, size_t len, std::string & out, std::string * msg )
+    {
+        auto && table = base64Table().fDecode;
+        out.reserve( out.length() + ( ( len / 4 ) * 3 ) + 3 );
+
+        size_t ii = 0;
+        while ( ii < len )
+        {
+#ifdef SAB_HAS_SSE2
+            if ( !fNumChars && !fNumPadding )
+            {
+                for ( ; ( ii + 16 ) <= len; ii += 16 )
+                {
+                    auto start = out.length();
+                    out.resize( start + 12 );
+                    if ( !decodeBase64Block( data + ii, &out[ start ] ) )
+                    {
+                        out.resize( start );
+                        break;
+                    }
+                }
+                if ( ii == len )
+                    break;
+            }
+#endif
+            auto ch = data[ ii ];
+            auto value = table[ static_cast< unsigned char >( ch ) ];
+            if ( value >= 0 )
+            {
+                if ( fNumPadding )
+                    return setError( msg, "Base64 data after the padding", fOffset + ii );
+                fBits = ( fBits << 6 ) | static_cast< uint32_t >( value );
+                if ( ++fNumChars == 4 )
+                {
+                    out.push_back( static_cast< char >( fBits >> 16 ) );
+                    out.push_back( static_cast< char >( fBits >> 8 ) );
+                    out.push_back( static_cast< char >( fBits ) );
+                    fBits = 0;
+                    fNumChars = 0;
+                }
+            }
+            else if ( value == kPadding )
+            {
+                if ( ( fNumChars < 2 ) || ( ( fNumChars + fNumPadding ) >= 4 ) )
+                    return setError( msg, "Misplaced base64 padding", fOffset + ii );
+                if ( ( fNumChars + ++fNumPadding ) == 4 )
+                {
+                    auto bits = fBits << ( 6 * fNumPadding );
+                    out.push_back( static_cast< char >( bits >> 16 ) );
+                    if ( fNumChars == 3 )
+                        out.push_back( static_cast< char >( bits >> 8 ) );
+                }
+            }
+            else if ( value != kBlank )
+                return setError( msg, "Invalid base64 character " + describe( ch ), fOffset + ii );
+            ++ii;
+        }
+        fOffset += len;
+        return true;
+    }
+
+    // fLineState values for uuencode
+    namespace
+    {
+        const int kUULineStart = 0;
+        const int kUUData = 1;
+        const int kUULineEnd = 2;
+        const int kUUSkipLine = 3;
+        const int kUUDone = 4;
+        const int kUUWord = 5;
+    }
+
+    bool CStreamDecoder::decodeUU( const char * data, size_t len, std::string & out, std::string * msg )
+    {
+        out.reserve( out.length() + ( ( len / 4 ) * 3 ) );
+        for ( size_t ii = 0; ii < len; ++ii )
+        {
+            auto ch = data[ ii ];
+            switch ( fLineState )
+            {
+                case kUULineStart:
+                    if ( ( ch == '\n' ) || ( ch == '\r' ) )
+                        break;
+                    if ( ( ch >= 'a' ) && ( ch <= 'z' ) )
+                    {
+                        fPending.assign( 1, ch );
+                        fLineState = kUUWord;
+                        break;
+                    }
+                    if ( !isUUChar( ch ) )
+                        return setError( msg, "Invalid uuencode line length " + describe( ch ), fOffset + ii );
+                    fLineBytes = ( ch - 0x20 ) & 0x3F;
+                    fLineState = fLineBytes ? kUUData : kUULineEnd;
+                    break;
+                case kUUData:
+                    if ( !isUUChar( ch ) )
+                        return setError( msg, ( ( ch == '\n' ) || ( ch == '\r' ) ) ? std::string( "Truncated uuencode line" ) : ( "Invalid uuencode character " + describe( ch ) ), fOffset + ii );
+                    fBits = ( fBits << 6 ) | ( ( ch - 0x20 ) & 0x3F );
+                    if ( ++fNumChars == 4 )
+                    {
+                        for ( int jj = 16; ( jj >= 0 ) && fLineBytes; jj -= 8, --fLineBytes )
+                            out.push_back( static_cast< char >( fBits >> jj ) );
+                        fBits = 0;
+                        fNumChars = 0;
+                        if ( !fLineBytes )
+                            fLineState = kUULineEnd;
+                    }
+                    break;
+                case kUULineEnd:
+                    if ( ch == '\n' )
+                        fLineState = kUULineStart;
+                    else if ( !isUUChar( ch ) && ( ch != '\r' ) )
+                        return setError( msg, "Invalid uuencode character " + describe( ch ), fOffset + ii );
+                    break;
+                case kUUSkipLine:
+                    if ( ch == '\n' )
+                        fLineState = kUULineStart;
+                    break;
+                case kUUDone:
+                    break;
+                case kUUWord:
+                    if ( ( ch != ' ' ) && ( ch != '\t' ) && ( ch != '\r' ) && ( ch != '\n' ) )
+                    {
+                        if ( fPending.length() > 8 )
+                            return setError( msg, "Invalid uuencode line", fOffset + ii );
+                        fPending.push_back( ch );
+                        break;
+                    }
+                    if ( fPending == "end" )
+                        fLineState = kUUDone;
+                    else if ( fPending == "begin" )
+                        fLineState = ( ch == '\n' ) ? kUULineStart : kUUSkipLine;
+                    else
+                        return setError( msg, "Invalid uuencode line '" + fPending + "'", fOffset + ii );
+                    break;
+            }
+        }
+        fOffset += len;
+        return true;
+    }
+
+    // fLineState values for quoted-printable
+    namespace
+    {
+        const int kQPText = 0;
+        const int kQPEscape = 1;
+        const int kQPEscapeHex = 2;
+        const int kQPSoftBreak = 3;
+        const int kQPCarriageReturn = 4;
+    }
+
+    bool CStreamDecoder::decodeQP( const char * data, size_t len, std::string & out, std::string * msg )
+    {
+        out.reserve( out.length() + len );
+        for ( size_t ii = 0; ii < len; ++ii )
+        {
+            auto ch = data[ ii ];
+            switch ( fLineState )
+            {
+                case kQPText:
+                    if ( ( ch == ' ' ) || ( ch == '\t' ) )
+                    {
+                        // held back until it is known not to be trailing
+                        if ( fPending.length() >= 1024 )
+                        {
+                            out += fPending;
+                            fPending.clear();
+                        }
+                        fPending.push_back( ch );
+                        break;
+                    }
+                    if ( ch == '\n' )
+                    {
+                        fPending.clear();
+                        out.push_back( '\n' );
+                        break;
+                    }
+                    if ( ch == '\r' )
+                    {
+                        fLineState = kQPCarriageReturn;
+                        break;
+                    }
+                    if ( ( ch < 33 ) || ( ch > 126 ) )
+                        return setError( msg, "Invalid quoted-printable character " + describe( ch ), fOffset + ii );
+                    if ( !fPending.empty() )
+                    {
+                        out += fPending;
+                        fPending.clear();
+                    }
+                    if ( ch == '=' )
+                        fLineState = kQPEscape;
+                    else
+                        out.push_back( ch );
+                    break;
+                case kQPEscape:
+                    if ( hexValue( ch ) >= 0 )
+                    {
+                        fBits = static_cast< uint32_t >( hexValue( ch ) );
+                        fLineState = kQPEscapeHex;
+                    }
+                    else if ( ch == '\n' )
+                        fLineState = kQPText;
+                    else if ( ( ch == ' ' ) || ( ch == '\t' ) || ( ch == '\r' ) )
+                        fLineState = kQPSoftBreak;
+                    else
+                        return setError( msg, "Invalid quoted-printable escape " + describe( ch ), fOffset + ii );
+                    break;
+                case kQPEscapeHex:
+                    if ( hexValue( ch ) < 0 )
+                        return setError( msg, "Invalid quoted-printable escape " + describe( ch ), fOffset + ii );
+                    out.push_back( static_cast< char >( ( fBits << 4 ) | static_cast< uint32_t >( hexValue( ch ) ) ) );
+                    fLineState = kQPText;
+                    break;
+                case kQPSoftBreak:
+                    if ( ch == '\n' )
+                        fLineState = kQPText;
+                    else if ( ( ch != ' ' ) && ( ch != '\t' ) && ( ch != '\r' ) )
+                        return setError( msg, "Invalid quoted-printable soft line break", fOffset + ii );
+                    break;
+                case kQPCarriageReturn:
+                    if ( ch != '\n' )
+                        return setError( msg, "Quoted-printable carriage return without a line feed", fOffset + ii );
+                    fPending.clear();
+                    out.push_back( '\n' );
+                    fLineState = kQPText;
+                    break;
+            }
+        }
+        fOffset += len;
+        return true;
+    }
+
+    bool CStreamDecoder::finish( std::string & out, std::string * msg )
+    {
+        if ( fError )
+            return false;
+
+        switch ( fEncoding )
+        {
+            case ETransferEncoding::eBase64:
+                if ( fNumPadding )
+                {
+                    if ( ( fNumChars + fNumPadding ) != 4 )
+                        return setError( msg, "Incomplete base64 padding", fOffset );
+                }
+                else if ( fNumChars == 1 )
+                    return setError( msg, "Truncated base64 data", fOffset );
+                else if ( fNumChars )
+                {
+                    // unpadded final group
+                    auto bits = fBits << ( 6 * ( 4 - fNumChars ) );
+                    out.push_back( static_cast< char >( bits >> 16 ) );
+                    if ( fNumChars == 3 )
+                        out.push_back( static_cast< char >( bits >> 8 ) );
+                    fNumChars = 0;
+                }
+                break;
+            case ETransferEncoding::eUUEncode:
+                if ( fLineState == kUUData )
+                    return setError( msg, "Truncated uuencode line", fOffset );
+                if ( ( fLineState == kUUWord ) && ( fPending != "end" ) && ( fPending != "begin" ) )
+                    return setError( msg, "Invalid uuencode line '" + fPending + "'", fOffset );
+                break;
+            case ETransferEncoding::eQuotedPrintable:
+                if ( fLineState == kQPEscapeHex )
+                    return setError( msg, "Truncated quoted-printable escape", fOffset );
+                if ( fLineState == kQPCarriageReturn )
+                    out.push_back( '\n' );
+                fPending.clear();
+                fLineState = kQPText;
+                break;
+        }
+        return true;
+    }
+
+    CStreamEncoder::CStreamEncoder( ETransferEncoding encoding, size_t lineLength ) :
+        fEncoding( encoding ),
+        fLineLength( lineLength )
+    {
+        // room for a base64 quad, or a quoted-printable escape and the soft break
+        if ( fLineLength && ( fLineLength < 4 ) )
+            fLineLength = 4;
+    }
+
+    void CStreamEncoder::reset()
+    {
+        fColumn = 0;
+        fGroupLen = 0;
+        fPendingBlank = 0;
+    }
+
+    void CStreamEncoder::encode( const char * data, size_t len, std::string & out )
+    {
+        switch ( fEncoding )
+        {
+            case ETransferEncoding::eBase64:
+                encodeBase64( data, len, out );
+                break;
+            case ETransferEncoding::eUUEncode:
+                encodeUU( data, len, out );
+                break;
+            case ETransferEncoding::eQuotedPrintable:
+                encodeQP( data, len, out );
+                break;
+        }
+    }
+
+    void CStreamEncoder::encodeBase64( const char * data, size_t len, std::string & out )
+    {
+        out.reserve( out.length() + ( ( len + 2 ) / 3 ) * 4 + ( fLineLength ? ( len / fLineLength + 1 ) : 0 ) );
+
+        auto writeQuad = [ this, &out ]( uint32_t bits, size_t numChars )
+        {
+            if ( fLineLength && fColumn && ( ( fColumn + 4 ) > fLineLength ) )
+            {
+                out.push_back( '\n' );
+                fColumn = 0;
+            }
+            for ( size_t ii = 0; ii < 4; ++ii )
+                out.push_back( ( ii < numChars ) ? kBase64Chars[ ( bits >> ( 18 - 6 * ii ) ) & 0x3F ] : '=' );
+            fColumn += 4;
+        };
+
+        size_t ii = 0;
+        while ( fGroupLen && ( fGroupLen < 3 ) && ( ii < len ) )
+            fGroup[ fGroupLen++ ] = static_cast< unsigned char >( data[ ii++ ] );
+        if ( fGroupLen == 3 )
+        {
+            writeQuad( ( fGroup[ 0 ] << 16 ) | ( fGroup[ 1 ] << 8 ) | fGroup[ 2 ], 4 );
+            fGroupLen = 0;
+        }
+
+        auto udata = reinterpret_cast< const unsigned char * >( data );
+        for ( ; ( ii + 3 ) <= len; ii += 3 )
+            writeQuad( ( udata[ ii ] << 16 ) | ( udata[ ii + 1 ] << 8 ) | udata[ ii + 2 ], 4 );
+        for ( ; ii < len; ++ii )
+            fGroup[ fGroupLen++ ] = udata[ ii ];
+    }
+
+    void CStreamEncoder::flushUULine( std::string & out )
+    {
+        out.push_back( static_cast< char >( 0x20 + fGroupLen ) );
+        for ( size_t ii = 0; ii < fGroupLen; ii += 3 )
+        {
+            uint32_t bits = fGroup[ ii ] << 16;
+            if ( ( ii + 1 ) < fGroupLen )
+                bits |= fGroup[ ii + 1 ] << 8;
+            if ( ( ii + 2 ) < fGroupLen )
+                bits |= fGroup[ ii + 2 ];
+            for ( int jj = 18; jj >= 0; jj -= 6 )
+            {
+                auto value = ( bits >> jj ) & 0x3F;
+                out.push_back( value ? static_cast< char >( 0x20 + value ) : '`' );
+            }
+        }
+        out.push_back( '\n' );
+        fGroupLen = 0;
+    }
+
+    void CStreamEncoder::encodeUU( const char * data, size_t len, std::string & out )
+    {
+        out.reserve( out.length() + ( ( len + 2 ) / 3 ) * 4 + ( len / 45 + 1 ) * 2 );
+        for ( size_t ii = 0; ii < len; ++ii )
+        {
+            fGroup[ fGroupLen++ ] = static_cast< unsigned char >( data[ ii ] );
+            if ( fGroupLen == sizeof( fGroup ) )
+                flushUULine( out );
+        }
+    }
+
+    void CStreamEncoder::appendQP( std::string & out, const char * token, size_t len )
+    {
+        // leave room for the = of a soft break
+        if ( fLineLength && ( ( fColumn + len ) >= fLineLength ) )
+        {
+            out += "=\n";
+            fColumn = 0;
+        }
+        out.append( token, len );
+        fColumn += len;
+    }
+
+    void CStreamEncoder::encodeQP( const char * data, size_t len, std::string & out )
+    {
+        out.reserve( out.length() + len + ( len / 8 ) );
+        char escape[ 3 ] = { '=', 0, 0 };
+        for ( size_t ii = 0; ii < len; ++ii )
+        {
+            auto ch = data[ ii ];
+            if ( fPendingBlank )
+            {
+                if ( ch == '\n' )
+                {
+                    escape[ 1 ] = kHexChars[ fPendingBlank >> 4 ];
+                    escape[ 2 ] = kHexChars[ fPendingBlank & 0xF ];
+                    appendQP( out, escape, 3 );
+                }
+                else
+                    appendQP( out, &fPendingBlank, 1 );
+                fPendingBlank = 0;
+            }
+
+            if ( ch == '\n' )
+            {
+                out.push_back( '\n' );
+                fColumn = 0;
+            }
+            else if ( ( ch == ' ' ) || ( ch == '\t' ) )
+                fPendingBlank = ch;
+            else if ( ( ch >= 33 ) && ( ch <= 126 ) && ( ch != '=' ) )
+                appendQP( out, &ch, 1 );
+            else
+            {
+                auto uch = static_cast< unsigned char >( ch );
+                escape[ 1 ] = kHexChars[ uch >> 4 ];
+                escape[ 2 ] = kHexChars[ uch & 0xF ];
+                appendQP( out, escape, 3 );
+            }
+        }
+    }
+
+    void CStreamEncoder::finish( std::string & out )
+    {
+        switch ( fEncoding )
+        {
+            case ETransferEncoding::eBase64:
+                if ( fGroupLen )
+                {
+                    uint32_t bits = fGroup[ 0 ] << 16;
+                    if ( fGroupLen == 2 )
+                        bits |= fGroup[ 1 ] << 8;
+                    if ( fLineLength && fColumn && ( ( fColumn + 4 ) > fLineLength ) )
+                    {
+                        out.push_back( '\n' );
+                        fColumn = 0;
+                    }
+                    for ( size_t ii = 0; ii < 4; ++ii )
+                        out.push_back( ( ii <= fGroupLen ) ? kBase64Chars[ ( bits >> ( 18 - 6 * ii ) ) & 0x3F ] : '=' );
+                    fColumn += 4;
+                    fGroupLen = 0;
+                }
+                if ( fLineLength && fColumn )
+                    out.push_back( '\n' );
+                break;
+            case ETransferEncoding::eUUEncode:
+                if ( fGroupLen )
+                    flushUULine( out );
+                out += "`\n";
+                break;
+            case ETransferEncoding::eQuotedPrintable:
+                if ( fPendingBlank )
+                {
+                    // trailing at the end of the data
+                    char escape[ 3 ] = { '=', kHexChars[ fPendingBlank >> 4 ], kHexChars[ fPendingBlank & 0xF ] };
+                    appendQP( out, escape, 3 );
+                }
+                break;
+        }
+        reset();
+    }
+
+    bool decodeStream( std::istream & in, std::ostream & out, ETransferEncoding encoding, std::string * msg, size_t chunkSize )
+    {
+        CStreamDecoder decoder( encoding );
+        std::vector< char > buffer( chunkSize ? chunkSize : 1 );
+        std::string decoded;
+        while ( in )
+        {
+            in.read( buffer.data(), static_cast< std::streamsize >( buffer.size() ) );
+            decoded.clear();
+            bool aOK = decoder.decode( buffer.data(), static_cast< size_t >( in.gcount() ), decoded, msg );
+            out.write( decoded.data(), static_cast< std::streamsize >( decoded.length() ) );
+            if ( !aOK )
+                return false;
+        }
+        decoded.clear();
+        bool aOK = decoder.finish( decoded, msg );
+        out.write( decoded.data(), static_cast< std::streamsize >( decoded.length() ) );
+        return aOK && !out.fail();
+    }
+
+    void encodeStream( std::istream & in, std::ostream & out, ETransferEncoding encoding, size_t chunkSize )
+    {
+        CStreamEncoder encoder( encoding );
+        std::vector< char > buffer( chunkSize ? chunkSize : 1 );
+        std::string encoded;
+        while ( in )
+        {
+            in.read( buffer.data(), static_cast< std::streamsize >( buffer.size() ) );
+            encoded.clear();
+            encoder.encode( buffer.data(), static_cast< size_t >( in.gcount() ), encoded );
+            out.write( encoded.data(), static_cast< std::streamsize >( encoded.length() ) );
+        }
+        encoded.clear();
+        encoder.finish( encoded );
+        out.write( encoded.data(), static_cast< std::streamsize >( encoded.length() ) );
+    }
+
+    bool decodeString( const std::string & in, std::string & out, ETransferEncoding encoding, std::string * msg )
+    {
+        out.clear();
+        CStreamDecoder decoder( encoding );
+        return decoder.decode( in.data(), in.length(), out, msg ) && decoder.finish( out, msg );
+    }
+
+    std::string encodeString( const std::string & in, ETransferEncoding encoding, size_t lineLength )
+    {
+        std::string retVal;
+        CStreamEncoder encoder( encoding, lineLength );
+        encoder.encode( in.data(), in.length(), retVal );
+        encoder.finish( retVal );
+        return retVal;
+    }
+}
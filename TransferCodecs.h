@@ -0,0 +1,113 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __TRANSFERCODECS_H
+#define __TRANSFERCODECS_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace NStringUtils
+{
+    enum class ETransferEncoding
+    {
+        eBase64,
+        eUUEncode,
+        eQuotedPrintable
+    };
+
+    // Streaming decoder, the input can be split into chunks at any byte
+    // Validation is part of decoding, decode() stops at the first invalid byte and returns false.
+    // State is a few bytes, so memory is constant regardless of the input size.
+    //
+    // Base64 - RFC 4648 alphabet, whitespace is ignored, padding is optional but must be
+    //          correct when present and ends the data
+    // UUEncode - length prefixed lines of ' ' to '`', "begin" lines are skipped and "end" ends the data
+    // QuotedPrintable - RFC 2045, =XX escapes (upper case hex), = at the end of a line is a soft
+    //          break, trailing blanks are dropped and hard line breaks decode to '\n'
+    class CStreamDecoder
+    {
+    public:
+        explicit CStreamDecoder( ETransferEncoding encoding );
+
+        // appends the decoded bytes to out
+        bool decode( const char * data, size_t len, std::string & out, std::string * msg = nullptr );
+        // flushes the final partial group, false if the input was truncated
+        bool finish( std::string & out, std::string * msg = nullptr );
+        void reset();
+
+        bool hasError() const { return fError; }
+        // number of input bytes consumed
+        size_t offset() const { return fOffset; }
+    private:
+        bool decodeBase64( const char * data, size_t len, std::string & out, std::string * msg );
+        bool decodeUU( const char * data, size_t len, std::string & out, std::string * msg );
+        bool decodeQP( const char * data, size_t len, std::string & out, std::string * msg );
+        bool setError( std::string * msg, const std::string & error, size_t offset );
+
+        ETransferEncoding fEncoding;
+        bool fError{ false };
+        size_t fOffset{ 0 };
+
+        uint32_t fBits{ 0 };
+        uint32_t fNumChars{ 0 };
+        uint32_t fNumPadding{ 0 };
+
+        int fLineState{ 0 };
+        uint32_t fLineBytes{ 0 }; // UUEncode, bytes left on the current line
+        std::string fPending; // UUEncode, the first word of a line; QuotedPrintable, blanks that may be trailing
+    };
+
+    // Streaming encoder, lines are wrapped at lineLength (0 for no wrapping, not used for UUEncode)
+    class CStreamEncoder
+    {
+    public:
+        explicit CStreamEncoder( ETransferEncoding encoding, size_t lineLength = 76 );
+
+        void encode( const char * data, size_t len, std::string & out );
+        void finish( std::string & out );
+        void reset();
+    private:
+        void encodeBase64( const char * data, size_t len, std::string & out );
+        void encodeUU( const char * data, size_t len, std::string & out );
+        void encodeQP( const char * data, size_t len, std::string & out );
+        void flushUULine( std::string & out );
+        void appendQP( std::string & out, const char * token, size_t len );
+
+        ETransferEncoding fEncoding;
+        size_t fLineLength{ 76 };
+        size_t fColumn{ 0 };
+        unsigned char fGroup[ 45 ]{ 0 };
+        size_t fGroupLen{ 0 };
+        char fPendingBlank{ 0 };
+    };
+
+    // chunked conversions between streams, memory use is bounded by chunkSize
+    bool decodeStream( std::istream & in, std::ostream & out, ETransferEncoding encoding, std::string * msg = nullptr, size_t chunkSize = 64 * 1024 );
+    void encodeStream( std::istream & in, std::ostream & out, ETransferEncoding encoding, size_t chunkSize = 64 * 1024 );
+
+    bool decodeString( const std::string & in, std::string & out, ETransferEncoding encoding, std::string * msg = nullptr );
+    std::string encodeString( const std::string & in, ETransferEncoding encoding, size_t lineLength = 76 );
+}
+
+#endif
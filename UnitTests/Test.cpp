@@ -21,13 +21,42 @@
 // SOFTWARE.
 
 #include "../utils.h"
+#include "../StringUtils.h"
+#include "../StringTokenizer.h"
 #include "../WordExp.h"
+#include "../RegExCache.h"
+#include "../WildcardPatternSet.h"
+#include "../BitVector.h"
+#include "../StringComparisonClasses.h"
+#include "../MultiStringSearch.h"
+#include "../ReportWriter.h"
+#include "../HierNameStore.h"
+#include "../StringFormat.h"
+#include "../MultiStringReplace.h"
+#include "../EnvironmentSnapshot.h"
+#include "../TransferCodecs.h"
+#include "../LineReader.h"
+#include "../FromString.h"
+#include "../ByteRegEx.h"
+#include "../RegExSet.h"
+#include "../CSVReader.h"
+#include "../HtmlEntities.h"
+#include "../DateTimeParser.h"
+#include "../IntFormat.h"
+#include "../IdentifierLexer.h"
+#include "../NoCaseStringSet.h"
 #include "../QtUtils.h"
 
 #include <QCoreApplication>
+#include <QBuffer>
+#include <QXmlStreamWriter>
 #include <string>
 #include <memory>
+#include <unordered_set>
+#include <sstream>
 #include <filesystem>
+#include <fstream>
+#include <tuple>
 #include "gtest/gtest.h"
 #include "../FileUtils.h"
 
@@ -775,6 +804,1096 @@ namespace
         EXPECT_EQ( "FOOBAR", *envVars.begin() );
     }
 
+    TEST( TestStringUtils, splitString )
+    {
+        EXPECT_EQ( std::list< std::string >( { "a", "b", "", "c" } ), NStringUtils::splitString( "a,b,,c", ',' ) );
+        EXPECT_EQ( std::list< std::string >( { "a", "b", "c" } ), NStringUtils::splitString( "a,b,,c", ',', true ) );
+        EXPECT_EQ( std::list< std::string >( { "a", "b", "c", "" } ), NStringUtils::splitString( "a b;c;", " ;" ) );
+        EXPECT_EQ( std::list< std::string >( { "a", "\"b c\"", "d" } ), NStringUtils::splitString( "a \"b c\" d", ' ', false, true ) );
+        EXPECT_EQ( std::list< std::string >( { "a", "b c", "d" } ), NStringUtils::splitString( "a \"b c\" d", ' ', false, true, true ) );
+        EXPECT_EQ( std::list< std::string >( { "b c" } ), NStringUtils::splitString( "'b c", ' ', false, true, true ) );
+        EXPECT_TRUE( NStringUtils::splitString( "", ',' ).empty() );
+    }
+
+    TEST( TestStringUtils, StringTokenizer )
+    {
+        std::string source = "top.u1.\"a b\".u2..leaf";
+        NStringUtils::CStringTokenizer tokenizer( source, '.', true, true, true );
+        auto tokens = tokenizer.all();
+        ASSERT_EQ( 5, tokens.size() );
+        EXPECT_EQ( "top", tokens[ 0 ] );
+        EXPECT_EQ( "u1", tokens[ 1 ] );
+        EXPECT_EQ( "a b", tokens[ 2 ] );
+        EXPECT_EQ( "u2", tokens[ 3 ] );
+        EXPECT_EQ( "leaf", tokens[ 4 ] );
+        for ( auto && ii : tokens )
+        {
+            EXPECT_GE( ii.data(), source.data() );
+            EXPECT_LE( ii.data() + ii.length(), source.data() + source.length() );
+        }
+
+        std::list< std::string > fromIter;
+        for ( auto && ii : NStringUtils::CStringTokenizer( "x;y;;z", ";" ) )
+            fromIter.emplace_back( ii );
+        EXPECT_EQ( NStringUtils::splitString( "x;y;;z", ";" ), fromIter );
+
+        // longer than one vector block, delimiter past the first 16 bytes
+        std::string longString = std::string( 40, 'a' ) + "," + std::string( 20, 'b' ) + "|c";
+        EXPECT_EQ( std::list< std::string >( { std::string( 40, 'a' ), std::string( 20, 'b' ), "c" } ), NStringUtils::splitString( longString, ",|" ) );
+    }
+
+    TEST( TestStringUtils, RegExCache )
+    {
+        NStringUtils::CRegExCache cache( 4, 2 );
+        auto regExp = cache.get( "a.*b", true );
+        EXPECT_TRUE( regExp.isValid() );
+        EXPECT_TRUE( regExp.match( "AxxB" ).hasMatch() );
+        EXPECT_EQ( 0, cache.hits() );
+        EXPECT_EQ( 1, cache.misses() );
+
+        cache.get( "a.*b", true );
+        EXPECT_EQ( 1, cache.hits() );
+        cache.get( "a.*b", false ); // different options, different entry
+        EXPECT_EQ( 2, cache.misses() );
+
+        for ( int ii = 0; ii < 10; ++ii )
+            cache.get( "pattern" + std::to_string( ii ) );
+        EXPECT_LE( cache.size(), 4 );
+
+        EXPECT_FALSE( cache.get( "(unbalanced" ).isValid() );
+        EXPECT_TRUE( cache.getWildcard( "top*" ).match( "top.u1" ).hasMatch() );
+        EXPECT_FALSE( cache.getWildcard( "top*" ).match( "xtop.u1" ).hasMatch() );
+        EXPECT_TRUE( cache.getWildcard( "top?u[0-9]*" ).match( "top/u1/reg" ).hasMatch() );
+        EXPECT_TRUE( cache.getWildcard( "top?u[!a-z]*" ).match( "top\\u1\\reg" ).hasMatch() );
+        EXPECT_FALSE( cache.getWildcard( "top?u[!0-9]*" ).match( "top\\u1\\reg" ).hasMatch() );
+        EXPECT_TRUE( cache.getWildcard( "a.b[c(*" ).match( "a.b[c(d" ).hasMatch() );
+        EXPECT_FALSE( cache.getWildcard( "a.b*" ).match( "axb" ).hasMatch() );
+
+        EXPECT_TRUE( NStringUtils::isExactMatchRegEx( "top.U1", "top\\.u\\d", true ) );
+        EXPECT_FALSE( NStringUtils::isExactMatchRegEx( "top.U1", "top\\.u\\d", false ) );
+        auto hits = NStringUtils::CRegExCache::instance()->hits();
+        EXPECT_TRUE( NStringUtils::isExactMatchRegEx( "top.U2", "top\\.u\\d", true ) );
+        EXPECT_EQ( hits + 1, NStringUtils::CRegExCache::instance()->hits() );
+
+        EXPECT_TRUE( NStringUtils::hasPrefixSubString( "top.u1", "top" ) );
+        EXPECT_TRUE( NStringUtils::hasSuffixSubString( "top.u1", "u1" ) );
+        EXPECT_FALSE( NStringUtils::hasSuffixSubString( "top.u1", "u2" ) );
+        EXPECT_TRUE( NStringUtils::hasPrefixSubString( "top/u1/reg", "top*" ) );
+        EXPECT_TRUE( NStringUtils::hasPrefixSubString( "top/u1/reg", "top?u?/" ) );
+        EXPECT_TRUE( NStringUtils::hasPrefixSubString( "top\\u1\\reg", "top\\u" ) );
+        EXPECT_FALSE( NStringUtils::hasPrefixSubString( "top/u1/reg", "u1*" ) );
+        EXPECT_TRUE( NStringUtils::hasSuffixSubString( "top/u1/reg", "*reg" ) );
+        EXPECT_TRUE( NStringUtils::hasSuffixSubString( "top\\u1\\reg", "u?\\reg" ) );
+        EXPECT_FALSE( NStringUtils::hasSuffixSubString( "top/u1/reg", "*u1" ) );
+    }
+
+    TEST( TestStringUtils, WildcardPatternSet )
+    {
+        NStringUtils::CWildcardPatternSet patterns;
+        EXPECT_EQ( 0, patterns.addPattern( "top.u*" ) );
+        EXPECT_EQ( 1, patterns.addPattern( "top.u?" ) );
+        EXPECT_EQ( 2, patterns.addPattern( "*.clk" ) );
+        EXPECT_EQ( 3, patterns.addPattern( "top.u1" ) );
+        EXPECT_EQ( 4, patterns.addPattern( "a**b" ) );
+
+        EXPECT_EQ( std::vector< size_t >( { 0, 1, 3 } ), patterns.match( "top.u1" ) );
+        EXPECT_EQ( std::vector< size_t >( { 0 } ), patterns.match( "top.u12" ) );
+        EXPECT_EQ( std::vector< size_t >( { 0, 2 } ), patterns.match( "top.u12.clk" ) );
+        EXPECT_EQ( std::vector< size_t >( { 4 } ), patterns.match( "ab" ) );
+        EXPECT_EQ( std::vector< size_t >( { 4 } ), patterns.match( "axxxb" ) );
+        EXPECT_TRUE( patterns.match( "TOP.U1" ).empty() );
+        EXPECT_FALSE( patterns.matchesAny( "bottom" ) );
+        EXPECT_TRUE( patterns.matchesAny( ".clk" ) );
+
+        // a tiny DFA cache must give the same answers
+        patterns.setMaxDFAStates( 2 );
+        EXPECT_EQ( std::vector< size_t >( { 0, 2 } ), patterns.match( "top.u12.clk" ) );
+        EXPECT_EQ( std::vector< size_t >( { 0, 1, 3 } ), patterns.match( "top.u1" ) );
+
+        NStringUtils::CWildcardPatternSet nocase( true );
+        nocase.addPattern( "top.U?" );
+        EXPECT_EQ( std::vector< size_t >( { 0 } ), nocase.match( "TOP.u1" ) );
+
+        NStringUtils::CWildcardPatternSet hier;
+        bool aOK = false;
+        EXPECT_EQ( 0, hier.addSDCPattern( "top/u*/reg?", "/", aOK ) );
+        EXPECT_TRUE( aOK );
+        EXPECT_EQ( 1, hier.addSDCPattern( "top/*", "/", aOK ) );
+        EXPECT_EQ( std::vector< size_t >( { 0 } ), hier.matchHierarchical( "top/u1/reg0", "/" ) );
+        EXPECT_EQ( std::vector< size_t >( { 1 } ), hier.matchHierarchical( "top/u1", "/" ) );
+        EXPECT_TRUE( hier.matchHierarchical( "top/u1/x/reg0", "/" ).empty() ); // * does not cross the hierarchy
+        EXPECT_EQ( std::vector< size_t >( { 1 } ), hier.matchHierarchical( std::list< std::string >( { "top", "u1" } ) ) );
+    }
+
+    TEST( TestStringUtils, BitVector )
+    {
+        bool aOK = false;
+        auto value = NStringUtils::hexToBitVector( "1234_5678_9abc_def0_1234_5678_9abc_def0", std::string::npos, &aOK );
+        EXPECT_TRUE( aOK );
+        EXPECT_EQ( 128, value.width() );
+        EXPECT_TRUE( value.isKnown() );
+        EXPECT_EQ( "123456789abcdef0123456789abcdef0", NStringUtils::binToHex( value ) );
+        EXPECT_EQ( "24197857203266734864793317670504947440", NStringUtils::binToDec( value, false ) );
+        EXPECT_EQ( value, NStringUtils::decToBitVector( "24197857203266734864793317670504947440", 128, &aOK ) );
+        EXPECT_TRUE( aOK );
+        EXPECT_EQ( value, NStringUtils::binToBitVector( NStringUtils::toBinString( value ), std::string::npos, &aOK ) );
+        EXPECT_EQ( value, NStringUtils::octToBitVector( NStringUtils::binToOct( value ), 128, &aOK ) );
+
+        auto wide = NStringUtils::decToBitVector( "-1", 512, &aOK );
+        EXPECT_TRUE( aOK );
+        EXPECT_EQ( std::string( 128, 'f' ), NStringUtils::binToHex( wide ) );
+        EXPECT_EQ( "-1", NStringUtils::binToDec( wide, true ) );
+        EXPECT_EQ( std::string( 512, '1' ), NStringUtils::decToBin( "-1", 512, &aOK ) );
+        EXPECT_TRUE( aOK );
+        EXPECT_EQ( "", NStringUtils::decToBin( "12a", 128, &aOK ) );
+        EXPECT_FALSE( aOK );
+        EXPECT_EQ( "", NStringUtils::decToBin( "12a", 32, &aOK ) );
+        EXPECT_FALSE( aOK );
+
+        auto fourState = NStringUtils::hexToBitVector( "xz1?", 20, &aOK );
+        EXPECT_TRUE( aOK );
+        EXPECT_EQ( "xxxxzzzz0001xxxx", NStringUtils::toBinString( fourState ).substr( 4 ) );
+        EXPECT_EQ( "xxz1x", NStringUtils::binToHex( fourState ) ); // leading x fills the extra width
+        EXPECT_EQ( "X", NStringUtils::binToDec( fourState, false ) );
+        EXPECT_EQ( NStringUtils::CBitVector::EBitValue::eZ, fourState.bit( 8 ) );
+        EXPECT_FALSE( fourState.isKnown() );
+
+        NStringUtils::hexToBitVector( "12g4", std::string::npos, &aOK );
+        EXPECT_FALSE( aOK );
+
+        uint64_t intValue = 0;
+        EXPECT_TRUE( NStringUtils::CBitVector::fromInt< int16_t >( -2, 70 ).toUInt64( intValue ) == false );
+        EXPECT_TRUE( NStringUtils::binToBitVector( "1010", 70 ).toUInt64( intValue ) );
+        EXPECT_EQ( 10, intValue );
+    }
+
+    TEST( TestStringUtils, NoCaseHashAndEq )
+    {
+        NStringUtils::noCaseStringHash hash;
+        NStringUtils::noCaseStringEq eq;
+        NStringUtils::noCaseStringCmp cmp;
+
+        std::string lower = "/usr/lib/x86_64-linux-gnu/libstdc++.so.6";
+        std::string mixed = "/USR/Lib/X86_64-Linux-GNU/LIBSTDC++.so.6";
+        EXPECT_EQ( hash( lower ), hash( mixed ) );
+        EXPECT_TRUE( eq( lower, mixed ) );
+        EXPECT_FALSE( eq( lower, mixed + "x" ) );
+        EXPECT_FALSE( eq( "[abc]", "{abc}" ) ); // only A-Z fold
+        EXPECT_FALSE( cmp( lower, mixed ) );
+        EXPECT_FALSE( cmp( mixed, lower ) );
+        EXPECT_TRUE( cmp( "ABC", "abd" ) );
+        EXPECT_TRUE( cmp( "abc", "ABCD" ) );
+        EXPECT_TRUE( cmp( "_", "A" ) ); // same order as strcasecmp, '_' sorts before 'a'
+
+        std::unordered_set< std::string, NStringUtils::noCaseStringHash, NStringUtils::noCaseStringEq > names = { "Top.U1.CLK", "top.u2.clk" };
+        EXPECT_EQ( 1, names.count( "TOP.u1.clk" ) );
+        EXPECT_EQ( 0, names.count( "top.u3.clk" ) );
+
+        NStringUtils::noCaseQStringHash qStrHash;
+        NStringUtils::noCaseQStringEq qEq;
+        EXPECT_EQ( qStrHash( "Hello World" ), qStrHash( "HELLO world" ) );
+        auto upper = QString::fromUtf8( "\xC3\x84" "BC\xC3\x89" ); // ÄBCÉ
+        auto lowerCase = QString::fromUtf8( "\xC3\xA4" "bc\xC3\xA9" ); // äbcé
+        EXPECT_TRUE( qEq( upper, lowerCase ) );
+        EXPECT_EQ( qStrHash( upper ), qStrHash( lowerCase ) );
+        EXPECT_NE( qStrHash( "abc" ), qStrHash( "abd" ) );
+    }
+
+    TEST( TestStringUtils, CaseInsensitiveSearch )
+    {
+        std::string line = "2021-03-04 12:00:01 Warning: Net TOP.U1.CLK has no driver, ERROR count 3";
+        EXPECT_EQ( 20, NStringUtils::strCaseFind( line, "WARNING" ) );
+        EXPECT_EQ( 33, NStringUtils::strCaseFind( line, "top.u1.clk" ) );
+        EXPECT_EQ( std::string::npos, NStringUtils::strCaseFind( line, "fatal" ) );
+        EXPECT_EQ( 0, NStringUtils::strCaseFind( line, "" ) );
+        EXPECT_EQ( std::string::npos, NStringUtils::strCaseFind( "abc", "abcd" ) );
+        EXPECT_TRUE( NStringUtils::strCaseSuffix( line, "COUNT 3" ) );
+        EXPECT_FALSE( NStringUtils::strCaseSuffix( line, "count 4" ) );
+        EXPECT_TRUE( NStringUtils::matchKeyWord( "INCLUDE foo.v", "include" ) );
+        EXPECT_FALSE( NStringUtils::matchKeyWord( "INC", "include" ) );
+
+        NStringUtils::CMultiStringSearch keywords( { "error", "warning", "info", "err" } );
+        size_t which = 0;
+        EXPECT_EQ( 20, NStringUtils::strCaseFind( line, keywords, &which ) );
+        EXPECT_EQ( 1, which );
+        EXPECT_FALSE( keywords.containsAny( "all clean" ) );
+
+        auto all = keywords.findAll( line );
+        ASSERT_EQ( 3, all.size() );
+        EXPECT_EQ( std::make_pair( size_t( 20 ), size_t( 1 ) ), all[ 0 ] );
+        EXPECT_EQ( std::make_pair( size_t( 59 ), size_t( 3 ) ), all[ 1 ] ); // err ends before error
+        EXPECT_EQ( std::make_pair( size_t( 59 ), size_t( 0 ) ), all[ 2 ] );
+
+        EXPECT_TRUE( NStringUtils::matchKeyWord( "ERROR: bad", keywords, &which ) );
+        EXPECT_EQ( 0, which ); // the longest key wins
+        EXPECT_TRUE( NStringUtils::matchKeyWord( "Errata", keywords, &which ) );
+        EXPECT_EQ( 3, which );
+        EXPECT_FALSE( NStringUtils::matchKeyWord( "no keyword", keywords ) );
+
+        // a blank keyword matches every line, as NStringUtils::matchKeyWord( line, "" ) does
+        NStringUtils::CMultiStringSearch withBlank( { "error", "" } );
+        EXPECT_TRUE( NStringUtils::matchKeyWord( "no keyword", "" ) );
+        EXPECT_TRUE( NStringUtils::matchKeyWord( "no keyword", withBlank, &which ) );
+        EXPECT_EQ( 1, which );
+        EXPECT_TRUE( NStringUtils::matchKeyWord( "", withBlank ) );
+        EXPECT_TRUE( NStringUtils::matchKeyWord( "Error: bad", withBlank, &which ) );
+        EXPECT_EQ( 0, which );
+        EXPECT_FALSE( withBlank.containsAny( "no keyword" ) );
+
+        NStringUtils::CMultiStringSearch caseSensitive( { "Error" }, false );
+        EXPECT_FALSE( caseSensitive.containsAny( "ERROR" ) );
+        EXPECT_TRUE( caseSensitive.containsAny( "an Error" ) );
+
+        EXPECT_TRUE( NStringUtils::hasPrefixSubString( "top.u1.clk", "top.u1" ) );
+        EXPECT_FALSE( NStringUtils::hasPrefixSubString( "top.u1.clk", "top.u2" ) );
+        EXPECT_TRUE( NStringUtils::hasSuffixSubString( "top.u1.clk", "clk" ) );
+        EXPECT_TRUE( NStringUtils::containsSubString( "top.u1.clk", "*u1*" ) );
+    }
+
+    TEST( TestStringUtils, ReportWriter )
+    {
+        QStringList header = { "Name", "Count", "Description" };
+        QStringList subHeader = { "(cell)", "#", "" };
+        QList< QStringList > data;
+        for ( int ii = 0; ii < 50; ++ii )
+            data << QStringList( { QString( "inst_%1" ).arg( ( ii * 37 ) % 50 ), QString::number( ii * ii ), QString( ii % 7, 'x' ) } );
+
+        for ( auto && sortData : { false, true } )
+        {
+            auto expected = NStringUtils::asReport( header, subHeader, data, sortData ).join( "\n" ) + "\n";
+
+            std::ostringstream oss;
+            NStringUtils::CReportWriter writer( oss, header, subHeader, sortData );
+            writer.setMaxRowsInMemory( 8 ); // forces the merge of sorted runs
+            for ( auto && ii : data )
+                EXPECT_TRUE( writer.addRow( ii ) );
+            QString msg;
+            EXPECT_TRUE( writer.finish( &msg ) ) << msg.toStdString();
+            EXPECT_EQ( expected.toStdString(), oss.str() );
+
+            QBuffer buffer;
+            buffer.open( QIODevice::WriteOnly );
+            NStringUtils::CReportWriter sampled( &buffer, header, subHeader, sortData );
+            sampled.setSampleSize( 100 ); // whole report fits in the sample
+            for ( auto && ii : data )
+                EXPECT_TRUE( sampled.addRow( ii ) );
+            EXPECT_TRUE( sampled.finish() );
+            EXPECT_EQ( expected, QString::fromUtf8( buffer.data() ) );
+        }
+
+        // sampled widths are fixed after the sample, wider cells push the line over
+        std::ostringstream oss;
+        NStringUtils::CReportWriter writer( oss, { "A", "B" } );
+        writer.setSampleSize( 1 );
+        writer.addRow( { "a", "b" } );
+        writer.addRow( { "abcd", "b" } );
+        writer.finish();
+        EXPECT_EQ( "A   B   \n--  --  \na   b   \nabcd  b   \n", oss.str() );
+    }
+
+    TEST( TestStringUtils, HierNameStore )
+    {
+        NStringUtils::CHierNameStore store( "/." );
+        auto clk = store.add( "top/u1/u2.clk" );
+        EXPECT_EQ( 4, store.depth( clk ) );
+        EXPECT_EQ( "top/u1/u2/clk", store.toString( clk ) );
+        EXPECT_EQ( "top.u1.u2.clk", store.toString( clk, '.' ) );
+        EXPECT_EQ( clk, store.find( "top.u1.u2/clk" ) );
+        EXPECT_EQ( clk, store.find( "/top//u1/u2/clk/" ) );
+        EXPECT_EQ( NStringUtils::CHierNameStore::kInvalid, store.find( "top/u1/u3" ) );
+        EXPECT_EQ( "clk", store.leaf( clk ) );
+
+        auto u1 = store.find( "top/u1" );
+        ASSERT_NE( NStringUtils::CHierNameStore::kInvalid, u1 );
+        EXPECT_EQ( u1, store.add( "top/u1" ) );
+        EXPECT_EQ( u1, store.parent( store.parent( clk ) ) );
+        EXPECT_EQ( u1, store.ancestor( clk, 2 ) );
+        EXPECT_TRUE( store.isPrefixOf( u1, clk ) );
+        EXPECT_FALSE( store.isPrefixOf( clk, u1 ) );
+        EXPECT_EQ( u1, store.findLongestPrefix( "top/u1/u9/q" ) );
+
+        // separators inside of escaped identifiers do not split
+        auto escaped = store.add( "top/\\bus/a.b\\/q" );
+        EXPECT_EQ( 3, store.depth( escaped ) );
+        EXPECT_EQ( "\\bus/a.b\\", store.leaf( store.parent( escaped ) ) );
+        EXPECT_EQ( "top/\\bus/a.b\\/q", store.toString( escaped ) );
+
+        // segments are shared
+        EXPECT_EQ( 6, store.numNames() );
+        EXPECT_EQ( 6, store.numSegments() );
+        auto path = store.path( clk );
+        ASSERT_EQ( 4, path.size() );
+        EXPECT_EQ( "u2", store.segment( path[ 2 ] ) );
+        EXPECT_EQ( path[ 0 ], store.findSegment( "top" ) );
+    }
+
+    TEST( TestStringUtils, JoinAndFormat )
+    {
+        std::vector< std::string > list = { "a", "", "b", "" };
+        EXPECT_EQ( "a||b|", NStringUtils::joinString( list, '|' ) );
+        EXPECT_EQ( "a, b", NStringUtils::joinString( list, ", ", true ) );
+        EXPECT_EQ( "b", NStringUtils::joinString( std::vector< std::string >( { "", "b" } ), "|" ) );
+        EXPECT_EQ( "a/b", NStringUtils::joinString( "a/", "/b", '/' ) );
+        EXPECT_EQ( "a/b", NStringUtils::joinString( "a", "b", "/" ) );
+
+        std::string buffer = "list: ";
+        NStringUtils::appendJoinedString( buffer, list.begin(), list.end(), "-", true );
+        EXPECT_EQ( "list: a-b", buffer );
+
+        char chars[ 16 ] = { 0 };
+        auto end = NStringUtils::joinStringTo( chars, list.begin(), list.end(), "+" );
+        EXPECT_EQ( "a++b+", std::string( chars, end ) );
+
+        EXPECT_EQ( "12 items at 0x1f", NStringUtils::getFMTString( "%d items at 0x%x", 12, 31 ) );
+        EXPECT_EQ( std::string( 2000, 'x' ), NStringUtils::getFMTString( "%s", std::string( 2000, 'x' ).c_str() ) );
+
+        EXPECT_EQ( "12 items at 0x1f", NStringUtils::formatString( SAB_FORMAT( "{} items at 0x{:x}" ), 12, 31 ) );
+        EXPECT_EQ( "top.v: -0042 {ok} 37.3%", NStringUtils::formatString( SAB_FORMAT( "{}: {:05} {{{}}} {:.1f}%" ), std::string( "top.v" ), -42, "ok", 37.25 + 0.05 ) );
+        EXPECT_EQ( "|  ab|ab  | ab |", NStringUtils::formatString( SAB_FORMAT( "|{:>4}|{:4}|{:^4}|" ), "ab", QString( "ab" ), "ab" ) );
+        EXPECT_EQ( "true 255 FF 11111111", NStringUtils::formatString( SAB_FORMAT( "{} {} {:X} {:b}" ), true, uint8_t( 255 ), 255, 255u ) );
+
+        buffer.clear();
+        EXPECT_TRUE( NStringUtils::formatTo( buffer, "{}-{}", 1, 2 ) );
+        EXPECT_EQ( "1-2", buffer );
+        EXPECT_FALSE( NStringUtils::formatTo( buffer, "{}-{}", 1 ) );
+        EXPECT_FALSE( NStringUtils::formatTo( buffer, "{:q}", 1 ) );
+        EXPECT_FALSE( NStringUtils::formatTo( buffer, "{:99999999999}", 1 ) );
+        EXPECT_FALSE( NStringUtils::formatTo( buffer, "{:.99999999999f}", 1.0 ) );
+        EXPECT_EQ( "1-2", buffer );
+
+        // longer than the stack buffer
+        EXPECT_EQ( "1." + std::string( 600, '0' ), NStringUtils::formatString( SAB_FORMAT( "{:.600f}" ), 1.0 ) );
+        auto big = NStringUtils::formatString( SAB_FORMAT( "{:.300f}" ), 1e300 );
+        EXPECT_EQ( 602U, big.length() );
+        EXPECT_EQ( "." + std::string( 300, '0' ), big.substr( 301 ) );
+        EXPECT_EQ( std::string( 1000, ' ' ) + "1.5", NStringUtils::formatString( SAB_FORMAT( "{:1003}" ), 1.5 ) );
+    }
+
+    TEST( TestStringUtils, MultiStringReplace )
+    {
+        NStringUtils::CMultiStringReplace sanitize( { { "/", "_" }, { "[", "_" }, { "]", "" }, { ".", "_" } } );
+        EXPECT_TRUE( sanitize.neverGrows() );
+        EXPECT_EQ( "top_u1_bus_3_", sanitize.replace( "top/u1.bus[3]." ) );
+
+        std::string name = "top/u1.bus[3]";
+        EXPECT_EQ( 4, sanitize.replaceInPlace( name ) );
+        EXPECT_EQ( "top_u1_bus_3", name );
+
+        // the longest key wins, replaced text is not scanned again
+        NStringUtils::CMultiStringReplace escapes( { { "&", "&amp;" }, { "<", "&lt;" }, { "<=", "&le;" }, { "abcd", "X" }, { "bc", "Y" } } );
+        EXPECT_FALSE( escapes.neverGrows() );
+        size_t numReplaced = 0;
+        EXPECT_EQ( "a &le; b &amp;&amp; c &lt; d", escapes.replace( "a <= b && c < d", &numReplaced ) );
+        EXPECT_EQ( 4, numReplaced );
+        EXPECT_EQ( "XaY", escapes.replace( "abcdabc" ) );
+
+        std::string buffer = "> ";
+        escapes.replaceInto( buffer, "<&" );
+        EXPECT_EQ( "> &lt;&amp;", buffer );
+
+        EXPECT_EQ( "one 2 3", NStringUtils::replaceAll( std::string( "1 two three" ), { { "1", "one" }, { "two", "2" }, { "three", "3" } } ) );
+        NStringUtils::CMultiStringReplace noCase( { { "error", "E" }, { "x", "-" } }, true );
+        EXPECT_EQ( "E: E -", noCase.replace( "ERROR: Error X" ) );
+    }
+
+    TEST( TestStringUtils, EnvVarExpander )
+    {
+        qputenv( "SAB_TEST_HOME", "/home/sab" );
+        qputenv( "SAB_TEST_PROJ", "$SAB_TEST_HOME/proj" );
+        qputenv( "SAB_TEST_LOOP", "x${SAB_TEST_LOOP}" );
+
+        bool aOK = false;
+        std::string msg;
+        EXPECT_EQ( "/home/sab/proj/top.v", NStringUtils::expandEnvVariable( "${SAB_TEST_PROJ}/top.v", &msg, &aOK ) );
+        EXPECT_TRUE( aOK );
+        EXPECT_EQ( "/home/sab\\a /home/sab/b", NStringUtils::expandEnvVariable( "%SAB_TEST_HOME%\\a $(sab_test_home)/b", &msg, &aOK ) );
+        EXPECT_TRUE( aOK );
+        EXPECT_EQ( "${SAB_TEST_HOME/b", NStringUtils::expandEnvVariable( "${SAB_TEST_HOME/b", &msg, &aOK ) );
+        EXPECT_FALSE( aOK );
+        EXPECT_EQ( "Malformed environmental variable", msg );
+
+        NStringUtils::CEnvironmentSnapshot env;
+        NStringUtils::CEnvVarExpander expander( env );
+        EXPECT_EQ( "/b", expander.expand( "$SAB_TEST_NOT_SET/b", &msg, &aOK ) );
+        EXPECT_FALSE( aOK );
+        EXPECT_EQ( "Environmental variable 'SAB_TEST_NOT_SET' not found", msg );
+        expander.expand( "$SAB_TEST_LOOP", &msg, &aOK );
+        EXPECT_FALSE( aOK );
+        EXPECT_EQ( "Environmental variable 'SAB_TEST_LOOP' references itself", msg );
+
+        std::vector< std::string > fileList = { "a.v", "$SAB_TEST_HOME/b.v", "${SAB_TEST_PROJ}/c.v" };
+        EXPECT_TRUE( expander.expandAll( fileList, &msg ) );
+        EXPECT_EQ( std::vector< std::string >( { "a.v", "/home/sab/b.v", "/home/sab/proj/c.v" } ), fileList );
+
+        // the snapshot only changes when invalidated
+        qputenv( "SAB_TEST_HOME", "/home/other" );
+        EXPECT_EQ( "/home/sab", expander.expand( "$SAB_TEST_HOME" ) );
+        env.invalidate();
+        EXPECT_EQ( "/home/other", expander.expand( "$SAB_TEST_HOME" ) );
+        env.setValue( "SAB_TEST_HOME", "/override" );
+        EXPECT_EQ( "/override/proj", expander.expand( "$SAB_TEST_PROJ" ) );
+    }
+
+    TEST( TestStringUtils, TransferCodecs )
+    {
+        using NStringUtils::ETransferEncoding;
+        std::string decoded;
+        std::string msg;
+        EXPECT_EQ( "SGVsbG8sIFdvcmxkIQ==\n", NStringUtils::encodeString( "Hello, World!", ETransferEncoding::eBase64 ) );
+        EXPECT_TRUE( NStringUtils::decodeString( "SGVsbG8s\r\nIFdvcmxkIQ==", decoded, ETransferEncoding::eBase64, &msg ) );
+        EXPECT_EQ( "Hello, World!", decoded );
+        EXPECT_EQ( "#86)C\n`\n", NStringUtils::encodeString( "abc", ETransferEncoding::eUUEncode ) );
+        EXPECT_TRUE( NStringUtils::decodeString( "begin 644 abc.txt\n#86)C\n`\nend\n", decoded, ETransferEncoding::eUUEncode, &msg ) );
+        EXPECT_EQ( "abc", decoded );
+        EXPECT_EQ( "a=3Db c=\nd=20\n=E9", NStringUtils::encodeString( "a=b cd \n\xE9", ETransferEncoding::eQuotedPrintable, 8 ) );
+        EXPECT_TRUE( NStringUtils::decodeString( "a=3Db c=\r\nd  \r\n=E9", decoded, ETransferEncoding::eQuotedPrintable, &msg ) );
+        EXPECT_EQ( "a=b cd\n\xE9", decoded );
+
+        // the decoders keep their state across arbitrary chunk boundaries
+        std::string data;
+        for ( int ii = 0; ii < 1000; ++ii )
+            data.push_back( static_cast< char >( ii * 7 ) );
+        for ( auto && encoding : { ETransferEncoding::eBase64, ETransferEncoding::eUUEncode, ETransferEncoding::eQuotedPrintable } )
+        {
+            auto encoded = NStringUtils::encodeString( data, encoding );
+            NStringUtils::CStreamDecoder decoder( encoding );
+            decoded.clear();
+            for ( size_t pos = 0; pos < encoded.length(); pos += 7 )
+                EXPECT_TRUE( decoder.decode( encoded.data() + pos, std::min< size_t >( 7, encoded.length() - pos ), decoded, &msg ) );
+            EXPECT_TRUE( decoder.finish( decoded, &msg ) );
+            EXPECT_EQ( data, decoded );
+
+            std::istringstream in( encoded );
+            std::ostringstream out;
+            EXPECT_TRUE( NStringUtils::decodeStream( in, out, encoding, &msg, 64 ) );
+            EXPECT_EQ( data, out.str() );
+        }
+
+        EXPECT_FALSE( NStringUtils::decodeString( "SGVs*G8s", decoded, ETransferEncoding::eBase64, &msg ) );
+        EXPECT_EQ( "Invalid base64 character '*' at offset 4", msg );
+        EXPECT_FALSE( NStringUtils::decodeString( "SG==bG8s", decoded, ETransferEncoding::eBase64, &msg ) );
+        EXPECT_EQ( "Base64 data after the padding at offset 4", msg );
+        EXPECT_FALSE( NStringUtils::decodeString( "#86)\n", decoded, ETransferEncoding::eUUEncode, &msg ) );
+        EXPECT_EQ( "Truncated uuencode line at offset 4", msg );
+        EXPECT_FALSE( NStringUtils::decodeString( "a=3", decoded, ETransferEncoding::eQuotedPrintable, &msg ) );
+        EXPECT_EQ( "Truncated quoted-printable escape at offset 3", msg );
+
+        EXPECT_TRUE( NStringUtils::validateBase64String( "SGVsbG8sIFdvcmxkIQ==" ) );
+        EXPECT_FALSE( NStringUtils::validateBase64String( "SGVsbG8s=IFdvcmxkIQ" ) );
+        EXPECT_TRUE( NStringUtils::validateBase64String( "-- not encoded" ) );
+        EXPECT_TRUE( NStringUtils::validateUUEncodeString( "#86)C" ) );
+        EXPECT_FALSE( NStringUtils::validateUUEncodeString( "#86)" ) );
+        EXPECT_TRUE( NStringUtils::validateQuotedPrintableString( "a=3Db c=" ) );
+        EXPECT_FALSE( NStringUtils::validateQuotedPrintableString( "a=3db" ) );
+    }
+
+    TEST( TestStringUtils, LineReader )
+    {
+        std::string text = "module top; // comment\r\n  wire a/b;\n\n//full line\nendmodule";
+        NFileUtils::CLineReader reader( text );
+        std::string_view curr;
+        std::vector< std::string > lines;
+        while ( reader.nextLine( curr ) )
+            lines.emplace_back( curr );
+        EXPECT_EQ( std::vector< std::string >( { "module top; // comment", "  wire a/b;", "", "//full line", "endmodule" } ), lines );
+        EXPECT_EQ( 5, reader.lineNumber() );
+
+        reader.rewind();
+        std::vector< std::tuple< std::string, size_t, size_t > > tokens;
+        while ( reader.nextToken( curr ) )
+            tokens.emplace_back( curr, reader.lineNumber(), reader.column() );
+        using TToken = std::tuple< std::string, size_t, size_t >;
+        EXPECT_EQ( std::vector< TToken >( { TToken( "module", 1, 1 ), TToken( "top;", 1, 8 ), TToken( "wire", 2, 3 ), TToken( "a/b;", 2, 8 ), TToken( "endmodule", 5, 1 ) } ), tokens );
+
+        EXPECT_EQ( 5, reader.numLines() );
+        EXPECT_EQ( "  wire a/b;", reader.line( 2 ) );
+        EXPECT_EQ( "", reader.line( 6 ) );
+        EXPECT_EQ( 2, reader.lineNumberAt( text.find( "a/b" ) ) );
+        EXPECT_EQ( 8, reader.columnAt( text.find( "a/b" ) ) );
+        EXPECT_EQ( std::vector< std::string_view >( { "", "//full line", "endmodule" } ), reader.contextLines( 4, 1, 3 ) );
+        EXPECT_TRUE( reader.seekToLine( 4 ) );
+        EXPECT_TRUE( reader.nextLine( curr ) );
+        EXPECT_EQ( "//full line", curr );
+        EXPECT_EQ( 4, reader.lineNumber() );
+
+        auto fileName = ( std::filesystem::temp_directory_path() / "sab_linereader_test.txt" ).string();
+        {
+            std::ofstream ofs( fileName, std::ios::binary );
+            ofs << text;
+        }
+        std::string msg;
+        NFileUtils::CLineReader fileReader;
+        EXPECT_TRUE( fileReader.open( fileName, &msg ) );
+        EXPECT_EQ( text, fileReader.data() );
+        EXPECT_EQ( "endmodule", fileReader.line( 5 ) );
+        fileReader.close();
+
+        auto fp = fopen( fileName.c_str(), "rb" );
+        ASSERT_NE( nullptr, fp );
+        std::string line;
+        int lineNo = 0;
+        lines.clear();
+        while ( NFileUtils::get_line_from_file( fp, line, lineNo ) )
+            lines.push_back( line );
+        fclose( fp );
+        EXPECT_EQ( 5, lineNo );
+        EXPECT_EQ( "module top; // comment", lines.front() );
+        EXPECT_EQ( "endmodule", lines.back() );
+        std::filesystem::remove( fileName );
+
+        EXPECT_FALSE( fileReader.open( fileName, &msg ) );
+    }
+
+    TEST( TestStringUtils, WriteEscaped )
+    {
+        EXPECT_EQ( "top.u1.bus[3]", NStringUtils::writeEscaped( "top.u1.bus[3]" ) );
+        EXPECT_FALSE( NStringUtils::needsEscaping( "top.u1.bus[3]" ) );
+        EXPECT_TRUE( NStringUtils::needsEscaping( "a b", true ) );
+        EXPECT_EQ( "a &lt;= b &amp;&amp; &quot;c&quot; \\\\n", NStringUtils::writeEscaped( "a <= b && \"c\" \\n" ) );
+        EXPECT_EQ( "a%20b&#10;c&#9;d&#13;", NStringUtils::writeEscaped( "a b\nc\td\r", true ) );
+        EXPECT_EQ( "\"a&gt;b\\\\ \"", NStringUtils::writeQuotedStringForXml( "a>b\\" ) );
+
+        std::string buffer;
+        std::string name = "top.u1";
+        EXPECT_EQ( name.data(), NStringUtils::escapeIfNeeded( name, buffer ).data() );
+        EXPECT_EQ( "x&lt;1", NStringUtils::escapeIfNeeded( "x<1", buffer ) );
+
+        std::string out = "name=";
+        NStringUtils::appendEscaped( out, "<top>" );
+        EXPECT_EQ( "name=&lt;top&gt;", out );
+
+        std::ostringstream oss;
+        NStringUtils::writeEscaped( oss, "a&b" );
+        oss << " ";
+        NStringUtils::writeQuotedStringForXml( oss, "c\"d" );
+        EXPECT_EQ( "a&amp;b \"c&quot;d\"", oss.str() );
+
+        QString xml;
+        QXmlStreamWriter writer( &xml );
+        writer.writeStartElement( "name" );
+        NStringUtils::writeEscaped( writer, "a<b\\c\n", true );
+        writer.writeEndElement();
+        EXPECT_EQ( "<name>a&lt;b\\\\c&#10;</name>", xml.toStdString() );
+    }
+
+    TEST( TestStringUtils, FromStringColumns )
+    {
+        int intVal = 0;
+        EXPECT_TRUE( fromString( intVal, " -42 " ) );
+        EXPECT_EQ( -42, intVal );
+        EXPECT_TRUE( fromString( intVal, "0x1F", 16 ) );
+        EXPECT_EQ( 31, intVal );
+        EXPECT_FALSE( fromString( intVal, "42abc" ) );
+        EXPECT_FALSE( fromString( intVal, "4294967296" ) );
+        EXPECT_EQ( 31, intVal );
+
+        double doubleVal = 0;
+        EXPECT_TRUE( fromString( doubleVal, "+1.5e3" ) );
+        EXPECT_EQ( 1500.0, doubleVal );
+        EXPECT_FALSE( fromString( doubleVal, "1.5.3" ) );
+        float floatVal = 1;
+        EXPECT_TRUE( fromString( floatVal, "0" ) );
+        EXPECT_EQ( 0.0f, floatVal );
+        EXPECT_TRUE( fromString( floatVal, "-2.25" ) );
+        EXPECT_EQ( -2.25f, floatVal );
+
+        bool boolVal = true;
+        EXPECT_TRUE( fromString( boolVal, "OFF" ) );
+        EXPECT_FALSE( boolVal );
+        EXPECT_TRUE( fromString( boolVal, "0.5" ) );
+        EXPECT_TRUE( boolVal );
+
+        // the template is as strict, no trailing text
+        uint64_t bigVal = 0;
+        EXPECT_TRUE( fromString( bigVal, "18446744073709551615" ) );
+        EXPECT_EQ( std::numeric_limits< uint64_t >::max(), bigVal );
+        EXPECT_FALSE( fromString( bigVal, "-1" ) );
+        EXPECT_FALSE( fromString( bigVal, "12 " ) );
+
+        std::string csv = "name,count,ratio\r\nalu,12,0.5\r\nfpu, 7 ,0.25\r\n\r\nmmu,x,1e-3\r\nbad\r\n";
+        std::vector< int > counts;
+        std::vector< NFromString::SParseError > errors;
+        EXPECT_FALSE( NFromString::parseColumn( csv, ',', 1, counts, &errors, 1 ) );
+        EXPECT_EQ( std::vector< int >( { 12, 7, 0, 0 } ), counts );
+        ASSERT_EQ( 2, errors.size() );
+        EXPECT_EQ( 5, errors[ 0 ].fLine );
+        EXPECT_EQ( 5, errors[ 0 ].fColumn );
+        EXPECT_EQ( "x", errors[ 0 ].fText );
+        EXPECT_EQ( 6, errors[ 1 ].fLine );
+
+        std::vector< double > ratios;
+        EXPECT_TRUE( NFromString::parseColumn( "alu,0.5\nfpu,0.25\n", ',', 1, ratios ) );
+        EXPECT_EQ( std::vector< double >( { 0.5, 0.25 } ), ratios );
+
+        std::vector< int64_t > values;
+        EXPECT_TRUE( NFromString::parseList( "1, -2,3", ',', values ) );
+        EXPECT_EQ( std::vector< int64_t >( { 1, -2, 3 } ), values );
+    }
+
+    TEST( TestStringUtils, HexParsing )
+    {
+        int intVal = 0;
+        EXPECT_TRUE( NStringUtils::hexToInt( intVal, " 0xFF; " ) );
+        EXPECT_EQ( 255, intVal );
+        EXPECT_TRUE( NStringUtils::hexToInt( intVal, "0xFFFFFFFF" ) );
+        EXPECT_EQ( -1, intVal );
+        bool overflow = false;
+        EXPECT_FALSE( NStringUtils::hexToInt( intVal, "0x1FFFFFFFF", &overflow ) );
+        EXPECT_TRUE( overflow );
+        EXPECT_FALSE( NStringUtils::hexToInt( intVal, "0x12G4", &overflow ) );
+        EXPECT_FALSE( overflow );
+        uint64_t bigVal = 0;
+        EXPECT_TRUE( NStringUtils::hexToInt( bigVal, "0x0000DEADbeef01234567" ) );
+        EXPECT_EQ( 0xDEADBEEF01234567ULL, bigVal );
+        EXPECT_EQ( 0x1A2B, NStringUtils::hexToInt( "0x1a 2b" ) );
+
+        std::vector< std::string_view > literals = { "ff", "0x7f", "1_00", "zz", "" };
+        std::vector< uint8_t > bytes;
+        std::vector< size_t > badIndexes;
+        EXPECT_EQ( 2, NStringUtils::hexToInts( literals, bytes, &badIndexes ) );
+        EXPECT_EQ( std::vector< uint8_t >( { 0xFF, 0x7F, 0, 0, 0 } ), bytes );
+        EXPECT_EQ( std::vector< size_t >( { 2, 3, 4 } ), badIndexes );
+
+        std::vector< uint64_t > words;
+        EXPECT_TRUE( NStringUtils::parseHexWords( "// memory image\n0001 dead_beef\r\n  FFFFFFFFFFFFFFFF // last\n", words ) );
+        EXPECT_EQ( std::vector< uint64_t >( { 1, 0xDEADBEEF, 0xFFFFFFFFFFFFFFFFULL } ), words );
+
+        uint64_t val = 0;
+        unsigned int numBits = 0;
+        EXPECT_TRUE( NStringUtils::isNumericString( "10110", val, numBits ) );
+        EXPECT_EQ( 22, val );
+        EXPECT_EQ( 5, numBits );
+        EXPECT_TRUE( NStringUtils::isNumericString( "10100101101001011010010110100101", val, numBits ) );
+        EXPECT_EQ( 0xA5A5A5A5, val );
+        EXPECT_FALSE( NStringUtils::isNumericString( "1012", val, numBits ) );
+        EXPECT_TRUE( NStringUtils::isNumericString( std::string( 100, '0' ), val, numBits ) );
+        EXPECT_EQ( 100, numBits );
+    }
+
+    TEST( TestStringUtils, ByteRegEx )
+    {
+        NStringUtils::CByteRegEx regExp( "\\s*[,;]\\s*" );
+        ASSERT_TRUE( regExp.isValid() );
+        EXPECT_EQ( std::list< std::string >( { "a", "b", "", "c" } ), regExp.split( "a , b;;c" ) );
+        EXPECT_EQ( std::list< std::string >( { "a", "b", "c" } ), regExp.split( "a , b;;c", true ) );
+
+        size_t start = 0;
+        size_t end = 0;
+        EXPECT_TRUE( regExp.search( "x ; y", 0, start, end ) );
+        EXPECT_EQ( 1U, start );
+        EXPECT_EQ( 4U, end );
+        EXPECT_FALSE( regExp.search( "x ; y", 4, start, end ) );
+
+        // the first alternative that matches, not the longest one, like PCRE
+        NStringUtils::CByteRegEx alternation( "a|ab" );
+        EXPECT_TRUE( alternation.search( "xab", 0, start, end ) );
+        EXPECT_EQ( 2U, end );
+        EXPECT_TRUE( alternation.exactMatch( "ab" ) );
+        EXPECT_TRUE( NStringUtils::CByteRegEx( "<.+?>" ).search( "<a><b>", 0, start, end ) );
+        EXPECT_EQ( 3U, end );
+        EXPECT_TRUE( NStringUtils::CByteRegEx( "x{2,3}" ).search( "xxxx", 0, start, end ) );
+        EXPECT_EQ( 3U, end );
+
+        // empty matches are handled the way QString::split handles them
+        EXPECT_EQ( std::list< std::string >( { "", "a", "b", "c", "" } ), NStringUtils::CByteRegEx( "x*" ).split( "abc" ) );
+        EXPECT_EQ( std::list< std::string >( { "a", "b", "c" } ), NStringUtils::CByteRegEx( "\\b \\b" ).split( "a b c" ) );
+
+        EXPECT_TRUE( NStringUtils::CByteRegEx( "c$" ).hasMatch( "abc\n" ) );
+        EXPECT_FALSE( NStringUtils::CByteRegEx( "c\\z" ).hasMatch( "abc\n" ) );
+        EXPECT_FALSE( NStringUtils::CByteRegEx( "a.c" ).hasMatch( "a\nc" ) );
+        EXPECT_TRUE( NStringUtils::CByteRegEx( "top\\.u\\d", true ).exactMatch( "TOP.U1" ) );
+        EXPECT_TRUE( NStringUtils::CByteRegEx( "[^a-c]x", true ).exactMatch( "dX" ) );
+        EXPECT_FALSE( NStringUtils::CByteRegEx( "[^a-c]x", true ).exactMatch( "BX" ) );
+
+        // outside of the subset, left to QRegularExpression
+        EXPECT_FALSE( NStringUtils::CByteRegEx( "(?=a)b" ).isValid() );
+        EXPECT_FALSE( NStringUtils::CByteRegEx( "(a)\\1" ).isValid() );
+        EXPECT_FALSE( NStringUtils::CByteRegEx( "(a*)*" ).isValid() );
+        EXPECT_FALSE( NStringUtils::CByteRegEx( "[a-" ).isValid() );
+        EXPECT_FALSE( NStringUtils::CByteRegEx( "\\p{L}" ).isValid() );
+
+        // ASCII data uses the byte matcher, anything else still goes through QRegularExpression
+        EXPECT_EQ( std::list< std::string >( { "a", "b", "c" } ), NStringUtils::splitStringRegEx( "a, b ,c", "\\s*,\\s*" ) );
+        EXPECT_EQ( std::list< std::string >( { "\xC3\xA9", "\xC3\xBC" } ), NStringUtils::splitStringRegEx( "\xC3\xA9, \xC3\xBC", "\\s*,\\s*" ) );
+        EXPECT_EQ( 3U, NStringUtils::splitStringRegEx( "\xC3\xA9" "b", "." ).size() ); // . is one code point, not one byte
+        EXPECT_TRUE( NStringUtils::isExactMatchRegEx( "top.u12", "top\\.(u|v)\\d+", false ) );
+        EXPECT_TRUE( NStringUtils::isExactMatchRegEx( "ab", "a|ab", false ) );
+        EXPECT_TRUE( NStringUtils::isExactMatchRegEx( "top.u1", "(?=t)top.*", false ) );
+
+        EXPECT_EQ( "a\\.b\\*\\(c\\)\\\\", NStringUtils::encodeRegEx( std::string( "a.b*(c)\\" ) ) );
+        EXPECT_EQ( "plain", NStringUtils::encodeRegEx( std::string( "plain" ) ) );
+        EXPECT_TRUE( NStringUtils::isExactMatchRegEx( "a.b*(c)", NStringUtils::encodeRegEx( std::string( "a.b*(c)" ) ), false ) );
+    }
+
+    TEST( TestStringUtils, RegExSet )
+    {
+        NStringUtils::CRegExSet regExSet( "top\\.u1|top\\.u2|(top\\.u3)|top\\.v10|bottom" );
+        EXPECT_EQ( 5U, regExSet.size() );
+        EXPECT_TRUE( regExSet.allLiterals() );
+        EXPECT_EQ( "bottom|top\\.(?:u[1-3]|v10)", regExSet.pattern() );
+        EXPECT_TRUE( regExSet.exactMatch( "top.u3" ) );
+        EXPECT_FALSE( regExSet.exactMatch( "top.u4" ) );
+        EXPECT_FALSE( regExSet.exactMatch( "top.u" ) );
+        EXPECT_TRUE( NStringUtils::isExactMatchRegEx( "top.v10", regExSet.pattern(), false ) );
+        EXPECT_FALSE( NStringUtils::isExactMatchRegEx( "top.v1", regExSet.pattern(), false ) );
+
+        // a literal that is a prefix of another one makes the rest optional
+        NStringUtils::CRegExSet prefixes;
+        prefixes.addLiteral( "a.b" );
+        prefixes.addLiteral( "a.bc" );
+        prefixes.addLiteral( "a.bcd" );
+        EXPECT_EQ( "a\\.b(?:cd?)?", prefixes.pattern() );
+
+        // only the top level '|' separate alternatives, groups around a whole alternative are dropped
+        EXPECT_EQ( std::set< std::string >( { "a", "b", "c", "(d)(e)", "[|]", "x\\|y" } ), NStringUtils::CRegExSet::splitAlternation( "(a)|((b|(?:c)))|(d)(e)|[|]|x\\|y" ) );
+        NStringUtils::CRegExSet mixed( "net\\d+|clk|(?:rst_n)" );
+        EXPECT_FALSE( mixed.allLiterals() );
+        EXPECT_TRUE( mixed.exactMatch( "net42" ) );
+        EXPECT_TRUE( mixed.exactMatch( "rst_n" ) );
+        EXPECT_FALSE( mixed.exactMatch( "net" ) );
+
+        NStringUtils::CRegExSet nocase( "Clk|RST", true );
+        EXPECT_TRUE( nocase.exactMatch( "clk" ) );
+        EXPECT_TRUE( nocase.exactMatch( "rst" ) );
+        EXPECT_EQ( "clk|rst", nocase.pattern() );
+
+        EXPECT_EQ( "(a)|(b)|(c)", NStringUtils::addToRegEx( "(b)|a", "c|(a)" ) );
+        EXPECT_EQ( "a", NStringUtils::addToRegEx( "", "a" ) );
+        EXPECT_TRUE( NStringUtils::regExEqual( "(a|b)|c", "c|(b)|a" ) );
+        EXPECT_FALSE( NStringUtils::regExEqual( "a|b", "a|b|c" ) );
+        EXPECT_FALSE( NStringUtils::regExEqual( "(a|b)c", "a|bc" ) );
+    }
+
+    TEST( TestStringUtils, CSVReader )
+    {
+        std::string text = "name,value,comment\r\n"
+                           "top.u1,1,\"a, b\"\n"
+                           "\n"
+                           "top.u2,,\"two\nlines\"\n"
+                           "top.u3,\"say \"\"hi\"\"\",\n"
+                           "\"\"";
+        NFileUtils::CCSVParser parser( text );
+        NFileUtils::CCSVRecords records;
+        EXPECT_TRUE( parser.parseAll( records ) );
+        ASSERT_EQ( 5U, records.size() );
+        EXPECT_EQ( std::vector< std::string >( { "name", "value", "comment" } ), records[ 0 ].toStrings() );
+        EXPECT_EQ( std::vector< std::string >( { "top.u1", "1", "a, b" } ), records[ 1 ].toStrings() );
+        EXPECT_EQ( std::vector< std::string >( { "top.u2", "", "two\nlines" } ), records[ 2 ].toStrings() );
+        EXPECT_EQ( std::vector< std::string >( { "top.u3", "say \"hi\"", "" } ), records[ 3 ].toStrings() );
+        EXPECT_EQ( std::vector< std::string >( { "" } ), records[ 4 ].toStrings() );
+        EXPECT_EQ( 4U, records[ 2 ].lineNumber() );
+        EXPECT_EQ( 6U, records[ 3 ].lineNumber() );
+
+        std::string msg;
+        NFileUtils::CCSVParser badParser( "a,b\nc,\"d\ne\n" );
+        records.clear();
+        EXPECT_FALSE( badParser.parseAll( records, &msg ) );
+        EXPECT_EQ( 1U, records.size() );
+        EXPECT_EQ( "Unterminated quoted field starting on line 2", msg );
+
+        EXPECT_EQ( std::vector< std::string >( { "a", "b,\"c\"", "", "d" } ), NFileUtils::CCSVParser::splitLine( "a,\"b,\"\"c\"\"\",,\"d\r\n" ) );
+        EXPECT_EQ( std::vector< std::string >( { "" } ), NFileUtils::CCSVParser::splitLine( "" ) );
+        EXPECT_EQ( std::vector< std::string >( { "a", "b" } ), NFileUtils::CCSVParser::splitLine( "a\tb", '\t' ) );
+
+        // only a quote at the start of a field opens a quoted section
+        EXPECT_EQ( std::vector< std::string >( { "12\" monitor", "50" } ), NFileUtils::CCSVParser::splitLine( "12\" monitor,50" ) );
+        EXPECT_EQ( std::vector< std::string >( { "a\"b", "c\"d" } ), NFileUtils::CCSVParser::splitLine( "a\"b,c\"d" ) );
+        EXPECT_EQ( std::vector< std::string >( { "ab\"c", "d" } ), NFileUtils::CCSVParser::splitLine( "\"ab\"\"\"c,d" ) );
+        EXPECT_EQ( QStringList( { "12\" monitor", "50" } ), NQtUtils::splitLineCSV( "12\" monitor,50" ) );
+        EXPECT_EQ( QStringList( { "a\"b", "c\"d" } ), NQtUtils::splitLineCSV( "a\"b,c\"d\n" ) );
+
+        // the chunks are speculative, the third one ends inside the quoted newline
+        auto chunks = NFileUtils::CCSVLoader::splitChunks( text, 8 );
+        ASSERT_EQ( 5U, chunks.size() );
+        EXPECT_EQ( "\ntop.u2,,\"two\n", chunks[ 2 ].fData );
+        EXPECT_EQ( 3U, chunks[ 2 ].fFirstLineNumber );
+        EXPECT_EQ( 5U, chunks[ 3 ].fFirstLineNumber );
+
+        NFileUtils::CCSVLoader loader;
+        loader.setChunkSize( 8 );
+        loader.setMaxThreads( 4 );
+        std::vector< std::vector< std::string > > loaded;
+        std::vector< size_t > lineNumbers;
+        auto addRecord = NFileUtils::CCSVLoader::perRecord( [ &loaded, &lineNumbers ]( const NFileUtils::CCSVRecord & record )
+        {
+            loaded.push_back( record.toStrings() );
+            lineNumbers.push_back( record.lineNumber() );
+            return true;
+        } );
+        EXPECT_TRUE( loader.load( text, addRecord, &msg ) );
+        ASSERT_EQ( 5U, loaded.size() );
+        EXPECT_EQ( std::vector< std::string >( { "top.u3", "say \"hi\"", "" } ), loaded[ 3 ] );
+        EXPECT_EQ( std::vector< size_t >( { 1, 2, 4, 6, 7 } ), lineNumbers );
+
+        auto fileName = ( std::filesystem::temp_directory_path() / "sab_csvreader_test.csv" ).string();
+        {
+            std::ofstream ofs( fileName, std::ios::binary );
+            ofs << text;
+        }
+        loaded.clear();
+        lineNumbers.clear();
+        EXPECT_TRUE( loader.loadFile( fileName, addRecord, &msg ) );
+        EXPECT_EQ( 5U, loaded.size() );
+        std::filesystem::remove( fileName );
+
+        // a quote inside a field neither merges records nor moves a chunk boundary
+        std::string inches = "size,name\n"
+                             "12\" monitor,50\n"
+                             "24\" monitor,\"a\n\"\"b\"\"\n\"\n"
+                             "7\",x\"y\n"
+                             "\"last\n\nline\",\"\"\n";
+        records.clear();
+        NFileUtils::CCSVParser inchParser( inches );
+        EXPECT_TRUE( inchParser.parseAll( records ) );
+        ASSERT_EQ( 5U, records.size() );
+        EXPECT_EQ( std::vector< std::string >( { "12\" monitor", "50" } ), records[ 1 ].toStrings() );
+        EXPECT_EQ( std::vector< std::string >( { "24\" monitor", "a\n\"b\"\n" } ), records[ 2 ].toStrings() );
+        EXPECT_EQ( std::vector< std::string >( { "7\"", "x\"y" } ), records[ 3 ].toStrings() );
+        EXPECT_EQ( std::vector< std::string >( { "last\n\nline", "" } ), records[ 4 ].toStrings() );
+        for ( size_t chunkSize = 1; chunkSize <= inches.length(); ++chunkSize )
+        {
+            for ( int maxThreads : { 1, 4 } )
+            {
+                loader.setChunkSize( chunkSize );
+                loader.setMaxThreads( maxThreads );
+                loaded.clear();
+                lineNumbers.clear();
+                EXPECT_TRUE( loader.load( inches, addRecord, &msg ) ) << msg;
+                ASSERT_EQ( records.size(), loaded.size() ) << "chunkSize " << chunkSize << " maxThreads " << maxThreads;
+                for ( size_t ii = 0; ii < records.size(); ++ii )
+                {
+                    EXPECT_EQ( records[ ii ].toStrings(), loaded[ ii ] );
+                    EXPECT_EQ( records[ ii ].lineNumber(), lineNumbers[ ii ] );
+                }
+            }
+        }
+
+        loaded.clear();
+        EXPECT_FALSE( loader.load( "a,b\nc,\"d\ne\n", addRecord, &msg ) );
+        EXPECT_EQ( "Unterminated quoted field starting on line 2", msg );
+    }
+
+    TEST( TestStringUtils, HtmlEntities )
+    {
+        char32_t first;
+        char32_t second;
+        EXPECT_TRUE( NStringUtils::htmlEntity( "amp", first, second ) );
+        EXPECT_EQ( U'&', first );
+        EXPECT_EQ( 0U, second );
+        EXPECT_TRUE( NStringUtils::htmlEntity( "CounterClockwiseContourIntegral", first, second ) );
+        EXPECT_EQ( 0x2233U, first );
+        EXPECT_TRUE( NStringUtils::htmlEntity( "nGt", first, second ) );
+        EXPECT_EQ( 0x226BU, first );
+        EXPECT_EQ( 0x20D2U, second );
+        EXPECT_FALSE( NStringUtils::htmlEntity( "notAnEntity", first, second ) );
+
+        EXPECT_EQ( "<a href=\"x\">&</a>", NStringUtils::fromHtmlEscaped( "&lt;a href=&quot;x&quot;&GT;&amp;&lt;/a&gt;" ) );
+        EXPECT_EQ( "&lt;", NStringUtils::fromHtmlEscaped( "&amp;lt;" ) );
+        EXPECT_EQ( "caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 'A'", NStringUtils::fromHtmlEscaped( "caf&eacute; &#x20AC; &#128512; &apos;&#65;&apos;" ) );
+        // not references, left as is
+        EXPECT_EQ( "a & b &amp &bogus; &#; &#0; &#xD800; &#1114112;", NStringUtils::fromHtmlEscaped( "a & b &amp &bogus; &#; &#0; &#xD800; &#1114112;" ) );
+
+        std::string plain = "no references";
+        std::string buffer;
+        EXPECT_EQ( &plain, &NStringUtils::fromHtmlEscaped( plain, buffer ) );
+        EXPECT_TRUE( buffer.empty() );
+
+        std::u16string wide = u"&lt;&nLt;&Afr;&gt;";
+        std::u16string out( wide.length(), 0 );
+        out.resize( NStringUtils::decodeHtmlEntities( wide.data(), wide.length(), &out[ 0 ] ) );
+        EXPECT_TRUE( out == u"<≪⃒\U0001D504>" );
+    }
+
+    TEST( TestStringUtils, DateTimeParser )
+    {
+        NQtUtils::CDateTimeParser parser;
+        EXPECT_EQ( QDateTime( QDate( 2021, 3, 4 ), QTime( 0, 0 ) ), parser.parse( QString( "2021-03-04" ) ) );
+        EXPECT_EQ( QDateTime( QDate( 2021, 3, 4 ), QTime( 0, 0 ) ), parser.parse( QString( "2021/3/04" ) ) );
+        EXPECT_EQ( QDateTime( QDate( 2021, 3, 4 ), QTime( 5, 6, 7 ) ), parser.parse( QString( "2021-3-4T5:6:7" ) ) );
+        EXPECT_EQ( QDateTime( QDate( 2021, 3, 4 ), QTime( 5, 6, 7, 123 ), Qt::UTC ), parser.parse( QString( "2021-03-04T05:06:07.123Z" ) ) );
+        EXPECT_EQ( QDateTime( QDate( 2021, 3, 4 ), QTime( 5, 6 ), Qt::OffsetFromUTC, -5 * 3600 ), parser.parse( QString( "2021-03-04T05:06-0500" ) ) );
+        EXPECT_EQ( QDateTime( QDate( 2021, 3, 5 ), QTime( 0, 0 ) ), parser.parse( QString( "2021-03-04T24:00:00" ) ) );
+        EXPECT_FALSE( parser.parse( QString( "2021-02-29" ) ).isValid() );
+        EXPECT_FALSE( parser.parse( QString( "2021-3-4T05:06" ) ).isValid() );
+        EXPECT_FALSE( parser.parse( QString() ).isValid() );
+
+        // the rest of what Qt::ISODate takes
+        EXPECT_EQ( QDateTime( QDate( 2021, 3, 4 ), QTime( 5, 6, 7 ) ), parser.parse( QString( "2021-03-04 05:06:07" ) ) );
+        EXPECT_EQ( QDateTime( QDate( 2021, 3, 4 ), QTime( 5, 6, 7 ), Qt::UTC ), parser.parse( QString( "2021-03-04t05:06:07z" ) ) );
+        EXPECT_EQ( QDateTime( QDate( 2021, 3, 4 ), QTime( 0, 0 ) ), parser.parse( QString( "2021.03.04" ) ) );
+        EXPECT_EQ( QDateTime( QDate( 2021, 3, 4 ), QTime( 5, 6 ) ), parser.parse( QString( "2021/03.04T05:06" ) ) );
+        EXPECT_FALSE( parser.parse( QString( "2021-3-4 5:6:7" ) ).isValid() );
+        EXPECT_FALSE( parser.parse( QString( "2021.3.4" ) ).isValid() );
+        for ( auto && ii : { "2021-03-04 05:06:07", "2021-03-04t05:06:07z", "2021.03.04", "2021-03-04T05:06:07+01", "2021_03_04T05:06:07.5Z" } )
+            EXPECT_EQ( QDateTime::fromString( QString( ii ), Qt::ISODate ), parser.parse( QString( ii ) ) ) << ii;
+
+        QString isoString( "1999-12-31T23:59:59" );
+        EXPECT_EQ( QDateTime::fromString( isoString, Qt::ISODate ), parser.parse( QStringRef( &isoString ) ) );
+        EXPECT_EQ( QDateTime::fromString( isoString, Qt::ISODate ), NQtUtils::getDateTime( isoString ) );
+
+        // not numeric, Qt::TextDate
+        auto textDate = QDateTime( QDate( 1998, 5, 20 ), QTime( 3, 40, 13 ) );
+        EXPECT_EQ( textDate, parser.parse( textDate.toString() ) );
+        EXPECT_EQ( textDate, NQtUtils::getDateTime( textDate.toString() ) );
+
+        // getDateTime follows the default locale
+        auto defaultLocale = QLocale();
+        auto germanDate = QDateTime( QDate( 1921, 3, 4 ), QTime( 5, 6 ) );
+        auto germanString = QLocale( QLocale::German, QLocale::Germany ).toString( germanDate, QLocale::ShortFormat );
+        EXPECT_FALSE( NQtUtils::getDateTime( germanString ).isValid() );
+        QLocale::setDefault( QLocale( QLocale::German, QLocale::Germany ) );
+        EXPECT_EQ( germanDate, NQtUtils::getDateTime( germanString ) );
+        QLocale::setDefault( defaultLocale );
+
+        auto column = parser.parseColumn( QStringList() << "2021-03-04" << textDate.toString() << "bogus" << textDate.addDays( 1 ).toString() );
+        ASSERT_EQ( 4, column.count() );
+        EXPECT_EQ( QDateTime( QDate( 2021, 3, 4 ), QTime( 0, 0 ) ), column[ 0 ] );
+        EXPECT_EQ( textDate, column[ 1 ] );
+        EXPECT_FALSE( column[ 2 ].isValid() );
+        EXPECT_EQ( textDate.addDays( 1 ), column[ 3 ] );
+    }
+
+    TEST( TestStringUtils, IntFormat )
+    {
+        EXPECT_EQ( "0x00FF", NStringUtils::intToHex( 255, 4 ) );
+        EXPECT_EQ( "0xFFFFFFFFFE", NStringUtils::intToHex( int8_t( -2 ), 10 ) );
+        EXPECT_EQ( "0xFFFFFFFE", NStringUtils::intToHex( -2 ) );
+        int aOK = 0;
+        EXPECT_EQ( "0x34", NStringUtils::intToHex( 0x1234U, 2, &aOK ) );
+        EXPECT_FALSE( aOK );
+        EXPECT_EQ( "0x00001234", NStringUtils::intToHex( 0x1234U, 8, &aOK ) );
+        EXPECT_TRUE( aOK );
+
+        EXPECT_EQ( "00000101", NStringUtils::toBinString( uint8_t( 5 ) ) );
+        EXPECT_EQ( "101", NStringUtils::toBinString( 5, 3 ) );
+        EXPECT_EQ( "1111111111", NStringUtils::toBinString( int8_t( -1 ), 10 ) );
+        EXPECT_EQ( "0100000101000010", NStringUtils::AsciiToBin( "AB" ) );
+        std::vector< bool > bits = { false, true, false, true };
+        EXPECT_EQ( bits, NStringUtils::toBoolVector( 5, 4 ) );
+
+        std::vector< uint16_t > values = { 0x0000, 0x00AB, 0xFFFF, 0x1234 };
+        NStringUtils::SIntFormat format;
+        format.fSeparator = " ";
+        EXPECT_EQ( "0000 00AB FFFF 1234", NStringUtils::formatIntegers( values.data(), values.size(), format ) );
+        format.fMinimalWidth = true;
+        format.fUpperCase = false;
+        format.fPrefix = "0x";
+        EXPECT_EQ( "0x0 0xab 0xffff 0x1234", NStringUtils::formatIntegers( values.data(), values.size(), format ) );
+        format = NStringUtils::SIntFormat();
+        format.fRadix = NStringUtils::ERadix::eOctal;
+        format.fNumBits = 9;
+        format.fSeparator = ",";
+        EXPECT_EQ( "000,253,777,064", NStringUtils::formatIntegers( values.data(), values.size(), format ) );
+        format.fRadix = NStringUtils::ERadix::eBinary;
+        format.fNumBits = 4;
+        EXPECT_EQ( "0000,1011,1111,0100", NStringUtils::formatIntegers( values.data(), values.size(), format ) );
+
+        // whole blocks followed by a partial one
+        std::vector< int64_t > wide( 5, -1 );
+        wide[ 3 ] = 0x0123456789ABCDEF;
+        EXPECT_EQ( "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF0123456789ABCDEFFFFFFFFFFFFFFFFF", NStringUtils::formatIntegers( wide.data(), wide.size(), NStringUtils::SIntFormat() ) );
+        std::string bytes( 17, 'A' );
+        std::string hexBytes;
+        for ( size_t ii = 0; ii < bytes.length(); ++ii )
+            hexBytes += "41";
+        EXPECT_EQ( hexBytes, NStringUtils::formatIntegers( bytes.data(), bytes.size(), NStringUtils::SIntFormat() ) );
+
+        std::string out = "values:";
+        NStringUtils::appendIntegers( out, values.data(), 2, NStringUtils::SIntFormat() );
+        EXPECT_EQ( "values:000000AB", out );
+        EXPECT_EQ( 0U, NStringUtils::maxFormattedLength( 0, 32, NStringUtils::SIntFormat() ) );
+    }
+
+    TEST( TestStringUtils, IdentifierLexer )
+    {
+        NStringUtils::CIdentifierLexer verilog;
+        std::vector< std::string_view > ids;
+        EXPECT_EQ( 7U, verilog.tokenize( "module top_1 ( input wire clk$x, output [7:0] q ); // not an id\n", ids ) );
+        EXPECT_EQ( std::vector< std::string_view >( { "module", "top_1", "input", "wire", "clk$x", "output", "q" } ), ids );
+
+        ids.clear();
+        verilog.tokenize( "assign \\bus[3] = 8'hFF + 'b0 + 4'sd3 + '0 + int'(x); /* a\n b */ $display(\"%d \\\" s\", y); q[$] = `WIDTH;", ids );
+        EXPECT_EQ( std::vector< std::string_view >( { "assign", "\\bus[3]", "int", "x", "$display", "y", "q", "WIDTH" } ), ids );
+        EXPECT_EQ( 2U, verilog.count( "a_very_long_identifier_name_longer_than_a_vector 1.5e3 #10ns b" ) );
+
+        NStringUtils::CIdentifierLexer vhdl( NStringUtils::EHDLSyntax::eVHDL );
+        ids.clear();
+        vhdl.tokenize( "signal \\my sig\\ : std_logic_vector( 7 downto 0 ) := X\"FF\"; -- not an id\nif clk'event and clk = '1' then y := T'('a') + 16#FF#;", ids );
+        EXPECT_EQ( std::vector< std::string_view >( { "signal", "\\my sig\\", "std_logic_vector", "downto", "if", "clk", "event", "and", "clk", "then", "y", "T" } ), ids );
+
+        std::string text = "a bb";
+        size_t pos = 0;
+        std::string_view id;
+        EXPECT_TRUE( verilog.next( text, pos, id ) );
+        EXPECT_EQ( text.data(), id.data() );
+        EXPECT_TRUE( verilog.next( text, pos, id ) );
+        EXPECT_EQ( "bb", id );
+        EXPECT_FALSE( verilog.next( text, pos, id ) );
+
+        EXPECT_EQ( 3U, verilog.identifierLength( "abc+d" ) );
+        EXPECT_EQ( 4U, verilog.identifierLength( "\\a:b c" ) );
+        EXPECT_EQ( 0U, verilog.identifierLength( "9a" ) );
+        EXPECT_EQ( 0U, vhdl.identifierLength( "\\unterminated" ) );
+
+        std::string escapedId;
+        EXPECT_EQ( " : next", NStringUtils::get_identifier_from_string_std( "  \\a:b[0] : next", escapedId ) );
+        EXPECT_EQ( "\\a:b[0]", escapedId );
+    }
+
+    TEST( TestStringUtils, NoCaseStringSet )
+    {
+        NStringUtils::CNoCaseStringSet dirs = { "vhdl_packages", "ISE", "vivado" };
+        EXPECT_EQ( 3U, dirs.size() );
+        EXPECT_TRUE( dirs.contains( "VHDL_Packages" ) );
+        EXPECT_TRUE( dirs.contains( std::string( "ise" ) ) );
+        EXPECT_TRUE( dirs.contains( std::string_view( "Vivado_2015" ).substr( 0, 6 ) ) );
+        EXPECT_FALSE( dirs.contains( "vivad" ) );
+        EXPECT_FALSE( dirs.insert( "VIVADO" ) );
+        EXPECT_EQ( "vivado", *dirs.find( "VIVADO" ) ); // the first spelling is kept
+        EXPECT_TRUE( dirs.find( "altera" ) == dirs.end() );
+        EXPECT_EQ( "ISE,vhdl_packages,vivado", NStringUtils::joinString( dirs, ',' ) );
+
+        std::set< std::string, NStringUtils::noCaseStringCmp > sorted;
+        NStringUtils::CNoCaseStringSet flat;
+        for ( int ii = 0; ii < 1000; ++ii )
+        {
+            auto name = ( ( ii % 3 ) ? "Top.U" : "top.u" ) + std::to_string( ii % 700 ) + "_CLK";
+            EXPECT_EQ( sorted.insert( name ).second, flat.insert( name ) );
+        }
+        for ( int ii = 0; ii < 700; ii += 2 )
+        {
+            auto name = "TOP.U" + std::to_string( ii ) + "_clk";
+            EXPECT_EQ( sorted.erase( name ) == 1, flat.erase( name ) );
+        }
+        EXPECT_EQ( sorted.size(), flat.size() );
+        EXPECT_EQ( NStringUtils::joinString( sorted, " " ), NStringUtils::joinString( flat, " " ) );
+        size_t numIterated = 0;
+        for ( auto && ii : flat )
+        {
+            EXPECT_EQ( 1U, sorted.count( ii ) );
+            numIterated++;
+        }
+        EXPECT_EQ( sorted.size(), numIterated );
+
+        NStringUtils::CNoCaseStringMap< int > keywords = { { "module", 1 }, { "EndModule", 2 } };
+        EXPECT_EQ( 2, keywords.find( "endmodule" )->second );
+        EXPECT_TRUE( keywords.find( "wire" ) == keywords.end() );
+        keywords[ "WIRE" ] = 3;
+        keywords[ "wire" ]++;
+        EXPECT_EQ( 4, keywords[ "Wire" ] );
+        EXPECT_FALSE( keywords.insert( "MODULE", 5 ).second );
+        EXPECT_EQ( 1, keywords.find( "module" ).value() );
+        EXPECT_FALSE( keywords.insert_or_assign( "MODULE", 5 ).second );
+        EXPECT_EQ( 5, keywords.find( "module" ).value() );
+        EXPECT_TRUE( keywords.erase( "Wire" ) );
+        EXPECT_FALSE( keywords.contains( "wire" ) );
+
+        auto ordered = keywords.sorted();
+        ASSERT_EQ( 2U, ordered.size() );
+        EXPECT_EQ( "EndModule", ordered[ 0 ].key() );
+        EXPECT_EQ( "module", ordered[ 1 ].key() );
+    }
+
     TEST( TestUtils, TestSoftenVars )
     {
         qputenv( "HOME", "/home/sbloom" );
@@ -22,6 +22,7 @@
 
 #include "UtilityModels.h"
 #include "QtUtils.h"
+#include "CSVReader.h"
 
 #include <QFileInfo>
 #include <QKeyEvent>
@@ -645,6 +646,58 @@ Qt::ItemFlags CStringTupleModel::flags( const QModelIndex & index ) const
     return retVal;
 }
 
+namespace
+{
+    QStringList toStringList( const NFileUtils::CCSVRecord & record )
+    {
+        QStringList retVal;
+        retVal.reserve( static_cast< int >( record.size() ) );
+        for ( size_t ii = 0; ii < record.size(); ++ii )
+            retVal << QString::fromUtf8( record[ ii ].data(), static_cast< int >( record[ ii ].length() ) );
+        return retVal;
+    }
+}
+
+bool CStringTupleModel::loadCSV( const QString & fileName, bool hasHeader, QString & msg, bool clearFirst )
+{
+    if ( clearFirst )
+        clear();
+
+    bool needHeader = hasHeader;
+    NFileUtils::CCSVLoader loader;
+    std::string errorMsg;
+    auto aOK = loader.loadFile( fileName.toStdString(),
+        [ this, &needHeader ]( const NFileUtils::CCSVRecords & records )
+        {
+            size_t first = 0;
+            if ( needHeader && !records.empty() )
+            {
+                needHeader = false;
+                first = 1;
+                auto columnNames = toStringList( records[ 0 ] );
+                if ( columnNames != fColumnNames )
+                {
+                    beginResetModel();
+                    fColumnNames = columnNames;
+                    endResetModel();
+                }
+            }
+            if ( first >= records.size() )
+                return true;
+
+            auto numRows = static_cast< int >( records.size() - first );
+            beginInsertRows( QModelIndex(), fData.count(), fData.count() + numRows - 1 );
+            fData.reserve( fData.count() + numRows );
+            for ( auto ii = first; ii < records.size(); ++ii )
+                fData << toStringList( records[ ii ] );
+            endInsertRows();
+            return true;
+        }, &errorMsg );
+    if ( !aOK )
+        msg = QString::fromStdString( errorMsg );
+    return aOK;
+}
+
 bool CStringTupleModel::loadXML( QXmlQuery & query, const std::list< std::pair< QString, bool > > & queries, const QDir & relToDir, QString & msg, bool clear )
 {
 #ifdef QT_XMLPATTERNS_LIB
@@ -98,6 +98,9 @@ public:
     QList< QStringList > data() const{ return fData; }
 
     bool loadXML( QXmlQuery & query, const std::list< std::pair< QString, bool > > & queries, const QDir & relToDir, QString & msg, bool clearFirst );
+    // parsed in parallel (NFileUtils::CCSVLoader), rows are inserted a chunk at a time
+    // with a header, the first record replaces the column names
+    bool loadCSV( const QString & fileName, bool hasHeader, QString & msg, bool clearFirst );
 protected:
     QStringList fColumnNames;
     bool fIsKeyEditable{ true };
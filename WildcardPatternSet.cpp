@@ -0,0 +1,277 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "WildcardPatternSet.h"
+#include "StringUtils.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace NStringUtils
+{
+    CWildcardPatternSet::CWildcardPatternSet( bool nocase ) :
+        fNoCase( nocase )
+    {
+        fNodes.emplace_back(); // root
+    }
+
+    size_t CWildcardPatternSet::addPattern( const std::string & pattern )
+    {
+        uint32_t node = 0;
+        addToLevel( node, pattern );
+        return finishPattern( node, pattern );
+    }
+
+    size_t CWildcardPatternSet::addSDCPattern( const std::string & pattern, const char * hsc, bool & aOK, std::string * msg )
+    {
+        auto levels = splitSDCPattern( pattern, false, hsc, aOK, msg );
+        if ( !aOK )
+            return std::string::npos;
+
+        uint32_t node = 0;
+        bool isFirst = true;
+        for ( auto && ii : levels )
+        {
+            if ( !isFirst )
+                node = addEdge( node, kBoundary );
+            isFirst = false;
+            addToLevel( node, ii );
+        }
+        return finishPattern( node, pattern );
+    }
+
+    size_t CWildcardPatternSet::addHierarchicalPattern( const std::list< std::string > & levels )
+    {
+        uint32_t node = 0;
+        bool isFirst = true;
+        for ( auto && ii : levels )
+        {
+            if ( !isFirst )
+                node = addEdge( node, kBoundary );
+            isFirst = false;
+            addToLevel( node, ii );
+        }
+        return finishPattern( node, joinString( levels, "/" ) );
+    }
+
+    void CWildcardPatternSet::addToLevel( uint32_t & node, const std::string & level )
+    {
+        for ( auto && ch : level )
+        {
+            if ( ch == '*' )
+            {
+                if ( fNodes[ node ].fIsStar ) // ** is the same as *
+                    continue;
+                node = addEdge( node, kStar );
+                fNodes[ node ].fIsStar = true;
+            }
+            else if ( ch == '?' )
+                node = addEdge( node, kAny );
+            else
+                node = addEdge( node, symbolFor( ch ) );
+        }
+    }
+
+    size_t CWildcardPatternSet::finishPattern( uint32_t node, const std::string & pattern )
+    {
+        auto id = fPatterns.size();
+        fPatterns.push_back( pattern );
+        fNodes[ node ].fPatterns.push_back( id );
+        clearCache();
+        return id;
+    }
+
+    uint32_t CWildcardPatternSet::addEdge( uint32_t from, uint32_t symbol )
+    {
+        auto retVal = findEdge( from, symbol );
+        if ( retVal != UINT32_MAX )
+            return retVal;
+
+        retVal = static_cast< uint32_t >( fNodes.size() );
+        fNodes.emplace_back();
+        auto & node = fNodes[ from ];
+        if ( symbol == kStar )
+            node.fStar = retVal;
+        else if ( symbol == kAny )
+            node.fAny = retVal;
+        else if ( symbol == kBoundary )
+            node.fBoundary = retVal;
+        else
+        {
+            auto value = std::make_pair( static_cast< unsigned char >( symbol ), retVal );
+            node.fChildren.insert( std::lower_bound( node.fChildren.begin(), node.fChildren.end(), value ), value );
+        }
+        return retVal;
+    }
+
+    uint32_t CWildcardPatternSet::findEdge( uint32_t from, uint32_t symbol ) const
+    {
+        auto && node = fNodes[ from ];
+        if ( symbol == kStar )
+            return node.fStar;
+        if ( symbol == kAny )
+            return node.fAny;
+        if ( symbol == kBoundary )
+            return node.fBoundary;
+
+        auto ch = static_cast< unsigned char >( symbol );
+        auto pos = std::lower_bound( node.fChildren.begin(), node.fChildren.end(), ch,
+                                     []( const std::pair< unsigned char, uint32_t > & lhs, unsigned char rhs ) { return lhs.first < rhs; } );
+        if ( ( pos == node.fChildren.end() ) || ( ( *pos ).first != ch ) )
+            return UINT32_MAX;
+        return ( *pos ).second;
+    }
+
+    uint32_t CWildcardPatternSet::symbolFor( char ch ) const
+    {
+        auto uch = static_cast< unsigned char >( ch );
+        return fNoCase ? static_cast< uint32_t >( std::tolower( uch ) ) : uch;
+    }
+
+    // a '*' may match the empty string, so entering a node also enters its star child
+    void CWildcardPatternSet::addClosure( std::vector< uint32_t > & nodes, uint32_t node ) const
+    {
+        if ( node == UINT32_MAX )
+            return;
+        nodes.push_back( node );
+        auto star = fNodes[ node ].fStar;
+        if ( star != UINT32_MAX )
+            nodes.push_back( star );
+    }
+
+    void CWildcardPatternSet::clearCache()
+    {
+        fStates.clear();
+        fStateMap.clear();
+        fTransitions.clear();
+        fStartState = -1;
+    }
+
+    uint32_t CWildcardPatternSet::startState()
+    {
+        if ( fStartState < 0 )
+        {
+            std::vector< uint32_t > nodes;
+            addClosure( nodes, 0 );
+            fStartState = static_cast< int32_t >( addState( std::move( nodes ) ) );
+        }
+        return static_cast< uint32_t >( fStartState );
+    }
+
+    uint32_t CWildcardPatternSet::addState( std::vector< uint32_t > && nodes )
+    {
+        auto pos = fStateMap.find( nodes );
+        if ( pos != fStateMap.end() )
+            return ( *pos ).second;
+
+        SState state;
+        for ( auto && ii : nodes )
+            state.fMatches.insert( state.fMatches.end(), fNodes[ ii ].fPatterns.begin(), fNodes[ ii ].fPatterns.end() );
+        std::sort( state.fMatches.begin(), state.fMatches.end() );
+        state.fNodes = std::move( nodes );
+
+        auto retVal = static_cast< uint32_t >( fStates.size() );
+        fStateMap[ state.fNodes ] = retVal;
+        fStates.push_back( std::move( state ) );
+        return retVal;
+    }
+
+    uint32_t CWildcardPatternSet::transition( uint32_t state, uint32_t symbol )
+    {
+        auto key = ( static_cast< uint64_t >( state ) << 9 ) | symbol;
+        auto next = fTransitions.find( key );
+        if ( next != fTransitions.end() )
+            return ( *next ).second;
+
+        std::vector< uint32_t > nodes;
+        for ( auto && ii : fStates[ state ].fNodes )
+        {
+            if ( symbol == kBoundary )
+            {
+                addClosure( nodes, fNodes[ ii ].fBoundary );
+                continue;
+            }
+            if ( fNodes[ ii ].fIsStar )
+                nodes.push_back( ii );
+            addClosure( nodes, findEdge( ii, symbol ) );
+            addClosure( nodes, fNodes[ ii ].fAny );
+        }
+        std::sort( nodes.begin(), nodes.end() );
+        nodes.erase( std::unique( nodes.begin(), nodes.end() ), nodes.end() );
+
+        auto pos = fStateMap.find( nodes );
+        if ( pos == fStateMap.end() && ( fStates.size() >= fMaxDFAStates ) )
+        {
+            // the cache is full, start over from the current position
+            clearCache();
+            return addState( std::move( nodes ) );
+        }
+
+        auto retVal = ( pos == fStateMap.end() ) ? addState( std::move( nodes ) ) : ( *pos ).second;
+        fTransitions[ key ] = retVal;
+        return retVal;
+    }
+
+    uint32_t CWildcardPatternSet::run( uint32_t state, std::string_view text )
+    {
+        for ( auto && ch : text )
+        {
+            if ( fStates[ state ].fNodes.empty() ) // dead, nothing can match
+                break;
+            state = transition( state, symbolFor( ch ) );
+        }
+        return state;
+    }
+
+    std::vector< size_t > CWildcardPatternSet::match( std::string_view name )
+    {
+        return fStates[ run( startState(), name ) ].fMatches;
+    }
+
+    bool CWildcardPatternSet::matchesAny( std::string_view name )
+    {
+        return !fStates[ run( startState(), name ) ].fMatches.empty();
+    }
+
+    std::vector< size_t > CWildcardPatternSet::matchHierarchical( const std::list< std::string > & levels )
+    {
+        auto state = startState();
+        bool isFirst = true;
+        for ( auto && ii : levels )
+        {
+            if ( !isFirst )
+                state = transition( state, kBoundary );
+            isFirst = false;
+            state = run( state, ii );
+        }
+        return fStates[ state ].fMatches;
+    }
+
+    std::vector< size_t > CWildcardPatternSet::matchHierarchical( const std::string & name, const char * hsc )
+    {
+        bool aOK = false;
+        auto levels = splitSDCPattern( name, false, hsc, aOK, nullptr );
+        if ( !aOK )
+            return {};
+        return matchHierarchical( levels );
+    }
+}
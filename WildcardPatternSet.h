@@ -0,0 +1,130 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020-2021 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __WILDCARDPATTERNSET_H
+#define __WILDCARDPATTERNSET_H
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace NStringUtils
+{
+    // Compiled set of '*'/'?' wildcard patterns
+    // All patterns share a single prefix trie, which is matched as an NFA and lazily
+    // converted into a DFA as names are matched.  Once the DFA states touched by a
+    // workload are built, matching a name is one table lookup per character no matter
+    // how many patterns are in the set.
+    //
+    // '*' matches any sequence (including empty), '?' matches any single character.
+    // Hierarchical patterns (see addSDCPattern) are matched level by level, a wildcard
+    // never crosses a hierarchy separator.
+    //
+    // Matching updates the DFA cache, use one set per thread
+    class CWildcardPatternSet
+    {
+    public:
+        CWildcardPatternSet( bool nocase = false );
+
+        // returns the id of the pattern, ids are assigned sequentially from 0
+        size_t addPattern( const std::string & pattern );
+        // splits the pattern with splitSDCPattern and adds it as a hierarchical pattern
+        size_t addSDCPattern( const std::string & pattern, const char * hsc, bool & aOK, std::string * msg = nullptr );
+        size_t addHierarchicalPattern( const std::list< std::string > & levels );
+
+        size_t size() const { return fPatterns.size(); }
+        bool empty() const { return fPatterns.empty(); }
+        const std::string & pattern( size_t id ) const { return fPatterns[ id ]; }
+
+        // ids of every pattern matching the name, in ascending order
+        std::vector< size_t > match( std::string_view name );
+        bool matchesAny( std::string_view name );
+
+        std::vector< size_t > matchHierarchical( const std::list< std::string > & levels );
+        // splits the name with splitSDCPattern, escaped identifiers are kept intact
+        std::vector< size_t > matchHierarchical( const std::string & name, const char * hsc );
+
+        void clearCache();
+        void setMaxDFAStates( size_t maxStates ) { fMaxDFAStates = maxStates ? maxStates : 1; }
+        size_t numDFAStates() const { return fStates.size(); }
+        size_t numNFANodes() const { return fNodes.size(); }
+    private:
+        static constexpr uint32_t kBoundary = 256; // hierarchy separator
+        static constexpr uint32_t kAny = 257;
+        static constexpr uint32_t kStar = 258;
+
+        struct SNode
+        {
+            bool fIsStar{ false };
+            uint32_t fStar{ UINT32_MAX };
+            uint32_t fAny{ UINT32_MAX };
+            uint32_t fBoundary{ UINT32_MAX };
+            std::vector< std::pair< unsigned char, uint32_t > > fChildren; // sorted on the character
+            std::vector< size_t > fPatterns;
+        };
+
+        struct SState
+        {
+            std::vector< uint32_t > fNodes;
+            std::vector< size_t > fMatches;
+        };
+
+        struct SNodeSetHash
+        {
+            size_t operator()( const std::vector< uint32_t > & nodes ) const
+            {
+                size_t retVal = nodes.size();
+                for ( auto && ii : nodes )
+                    retVal ^= ii + 0x9e3779b9 + ( retVal << 6 ) + ( retVal >> 2 );
+                return retVal;
+            }
+        };
+
+        uint32_t addEdge( uint32_t from, uint32_t symbol );
+        uint32_t findEdge( uint32_t from, uint32_t symbol ) const;
+        void addToLevel( uint32_t & node, const std::string & level );
+        size_t finishPattern( uint32_t node, const std::string & pattern );
+
+        void addClosure( std::vector< uint32_t > & nodes, uint32_t node ) const;
+        uint32_t startState();
+        uint32_t addState( std::vector< uint32_t > && nodes );
+        uint32_t transition( uint32_t state, uint32_t symbol );
+        uint32_t symbolFor( char ch ) const;
+        uint32_t run( uint32_t state, std::string_view text );
+
+        bool fNoCase{ false };
+        std::vector< std::string > fPatterns;
+        std::vector< SNode > fNodes;
+
+        size_t fMaxDFAStates{ 10000 };
+        std::vector< SState > fStates;
+        std::unordered_map< std::vector< uint32_t >, uint32_t, SNodeSetHash > fStateMap;
+        std::unordered_map< uint64_t, uint32_t > fTransitions;
+        int32_t fStartState{ -1 };
+    };
+}
+
+#endif
@@ -28,7 +28,26 @@ set(qtproject_SRCS
     MD5.cpp
     StringUtils.cpp
     StringComparisonClasses.cpp
+    StringTokenizer.cpp
+    StringFormat.cpp
+    IntFormat.cpp
+    IdentifierLexer.cpp
+    RegExCache.cpp
+    ByteRegEx.cpp
+    RegExSet.cpp
+    WildcardPatternSet.cpp
+    BitVector.cpp
+    MultiStringSearch.cpp
+    MultiStringReplace.cpp
+    EnvironmentSnapshot.cpp
+    TransferCodecs.cpp
+    HtmlEntities.cpp
+    LineReader.cpp
+    CSVReader.cpp
+    ReportWriter.cpp
+    HierNameStore.cpp
     QtUtils.cpp
+    DateTimeParser.cpp
     ScrollMessageBox.cpp
     SpinBox64.cpp
     SpinBox64U.cpp
@@ -63,8 +82,29 @@ set(project_H
     MD5.h
     SpinBox64_StepType.h
     QtUtils.h
+    DateTimeParser.h
     EnumUtils.h
     StringComparisonClasses.h
+    NoCaseStringSet.h
+    StringTokenizer.h
+    StringFormat.h
+    IntFormat.h
+    IdentifierLexer.h
+    SIMDUtils.h
+    RegExCache.h
+    ByteRegEx.h
+    RegExSet.h
+    WildcardPatternSet.h
+    BitVector.h
+    MultiStringSearch.h
+    MultiStringReplace.h
+    EnvironmentSnapshot.h
+    TransferCodecs.h
+    HtmlEntities.h
+    LineReader.h
+    CSVReader.h
+    ReportWriter.h
+    HierNameStore.h
     StringUtils.h
     WordExp.h
     QtDumper.h